@@ -1009,6 +1009,45 @@ public:
                     int src2_idx = -1,
                     SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > src2_var = NULL);
 
+    /*!
+     * \brief Compute the action of the staggered-grid Stokes operator.
+     *
+     * Sets dst_u = C src_u + div D grad src_u + grad src_p + gamma src2 and
+     * dst_p = -div src_u, where C and D are specified by the
+     * SAMRAI::solv::PoissonSpecifications object poisson_spec.
+     *
+     * The result is the same as calling grad(), laplace(), and div() in
+     * sequence, but each level is processed in a single sweep by
+     * PatchMathOps::stokes(). The only exception is the divergence on levels
+     * that are covered by finer levels, which must be computed after src_u
+     * has been synchronized at the coarse-fine interface. If C and D are both
+     * zero, the Laplacian is not evaluated, so that this routine can be
+     * combined with vc_laplace() by passing its result as src2.
+     *
+     * \note The present implementation of this operator \em requires that
+     * damping factor C and diffusivity D be spatially constant and
+     * scalar-valued.
+     *
+     * \see setPatchHierarchy
+     * \see resetLevels
+     */
+    void stokes(int dst_u_idx,
+                SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > dst_u_var,
+                bool dst_u_cf_bdry_synch,
+                int dst_p_idx,
+                SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > dst_p_var,
+                const SAMRAI::solv::PoissonSpecifications& poisson_spec,
+                int src_u_idx,
+                SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > src_u_var,
+                int src_p_idx,
+                SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > src_p_var,
+                SAMRAI::tbox::Pointer<HierarchyGhostCellInterpolation> src_ghost_fill,
+                double src_ghost_fill_time,
+                bool src_u_cf_bdry_synch = true,
+                double gamma = 0.0,
+                int src2_idx = -1,
+                SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > src2_var = NULL);
+
     /*!
      * \brief Compute dst = alpha src1 + beta src2, pointwise.
      *
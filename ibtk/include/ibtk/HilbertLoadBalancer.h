@@ -0,0 +1,111 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#ifndef included_IBTK_HilbertLoadBalancer
+#define included_IBTK_HilbertLoadBalancer
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/ibtk_utilities.h"
+
+#include "BoxArray.h"
+#include "BoxList.h"
+#include "IntVector.h"
+#include "LoadBalancer.h"
+#include "tbox/Pointer.h"
+
+#include <vector>
+
+namespace SAMRAI
+{
+namespace hier
+{
+class ProcessorMapping;
+template <int DIM>
+class PatchHierarchy;
+} // namespace hier
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class HilbertLoadBalancer assigns boxes to processors by ordering them
+ * along a Hilbert space-filling curve and cutting the curve into one segment
+ * per processor.
+ *
+ * The boxes themselves are generated by the parent class, so that the usual
+ * minimum and maximum box size constraints are respected.  The workload of
+ * each box is computed from the workload patch data index (e.g., the one
+ * populated by LDataManager::addWorkloadEstimate() and
+ * FEDataManager::addWorkloadEstimate()) on the existing patch level.  Cells
+ * not covered by the existing patch level, or all cells when no workload
+ * index has been set, are assigned a workload of one.  The curve is then cut
+ * into segments of approximately equal workload.  Because the Hilbert curve
+ * preserves locality, the boxes assigned to each processor form compact,
+ * contiguous regions, which tends to reduce the number of ghost cells and the
+ * number of Lagrangian structures split between processors.
+ *
+ * \note Since SAMRAI::mesh::LoadBalancer::setWorkloadPatchDataIndex() is not
+ * virtual, the workload patch data index must be set through a pointer to
+ * this class (as HierarchyIntegrator::registerLoadBalancer() does).
+ */
+class HilbertLoadBalancer : public SAMRAI::mesh::LoadBalancer<NDIM>
+{
+public:
+    // use parent constructor
+    using SAMRAI::mesh::LoadBalancer<NDIM>::LoadBalancer;
+
+    /*!
+     * Set the patch data index of the cell-centered workload estimate for the
+     * specified level, or for all levels when \p level_number is negative.
+     */
+    void setWorkloadPatchDataIndex(int data_id, int level_number = -1);
+
+    /*!
+     * Generate boxes using the parent class and then assign them to
+     * processors by partitioning the Hilbert curve through the box centers.
+     */
+    void loadBalanceBoxes(SAMRAI::hier::BoxArray<NDIM>& out_boxes,
+                          SAMRAI::hier::ProcessorMapping& mapping,
+                          const SAMRAI::hier::BoxList<NDIM>& in_boxes,
+                          const SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                          int level_number,
+                          const SAMRAI::hier::BoxArray<NDIM>& physical_domain,
+                          const SAMRAI::hier::IntVector<NDIM>& ratio_to_hierarchy_level_zero,
+                          const SAMRAI::hier::IntVector<NDIM>& min_size,
+                          const SAMRAI::hier::IntVector<NDIM>& max_size,
+                          const SAMRAI::hier::IntVector<NDIM>& cut_factor,
+                          const SAMRAI::hier::IntVector<NDIM>& bad_interval) const override;
+
+private:
+    /*!
+     * Compute the workload of each of the boxes from the workload data on the
+     * existing patch level with the same level number.
+     */
+    std::vector<double> computeBoxWorkloads(const SAMRAI::hier::BoxArray<NDIM>& boxes,
+                                            SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                                            int level_number) const;
+
+    /*!
+     * Workload patch data indices.
+     */
+    int d_master_workload_idx = IBTK::invalid_index;
+    std::vector<int> d_workload_idx;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_HilbertLoadBalancer
@@ -26,6 +26,7 @@
 #include "IntVector.h"
 #include "Patch.h"
 
+#include <cstdint>
 #include <functional>
 #include <vector>
 
@@ -194,6 +195,17 @@ public:
                       const int offset = 0,
                       const SAMRAI::hier::IntVector<NDIM>& periodic_shift = SAMRAI::hier::IntVector<NDIM>(0));
 
+    /*!
+     * \brief Compute the Morton (Z-order) key of an index relative to a
+     * reference lower index.
+     *
+     * Sorting indices by this key orders them along a space-filling curve, so
+     * that indices that are consecutive in the sorted order are generally
+     * nearby in index space.  Each coordinate of (i - i_lower) must be
+     * nonnegative; at most 64 / NDIM bits of each coordinate are used.
+     */
+    static std::uint64_t getMortonKey(const SAMRAI::hier::Index<NDIM>& i, const SAMRAI::hier::Index<NDIM>& i_lower);
+
     /*!
      * \brief Partition a patch box into subdomains of size \em box_size
      * and into equal number of overlapping subdomains whose overlap region
@@ -64,6 +64,16 @@ public:
      */
     void setPoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& poisson_spec) override;
 
+    /*!
+     * \brief Reset the SAMRAI::solv::PoissonSpecifications object used by the
+     * operator and preconditioner without reinitializing the solver.
+     *
+     * The update is delegated to the preconditioner.  The operator is
+     * evaluated matrix-free, and so only the form of the diffusion coefficient
+     * (constant or variable) is required to remain unchanged.
+     */
+    bool updatePoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& poisson_spec) override;
+
     /*!
      * \brief Set the SAMRAI::solv::RobinBcCoefStrategy object used to specify
      * physical boundary conditions.
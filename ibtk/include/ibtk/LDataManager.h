@@ -382,6 +382,10 @@ public:
      *
      * Unlike the standard regularized delta function spreading operation, the
      * implemented operation spreads values, \em NOT densities.
+     *
+     * \note The prolongation schedules are only used on levels that are finer
+     * than the coarsest level containing Lagrangian data, since the values
+     * that would be prolonged from coarser levels are zero.
      */
     void spread(int f_data_idx,
                 std::vector<SAMRAI::tbox::Pointer<LData> >& F_data,
@@ -428,6 +432,14 @@ public:
     /*!
      * \brief Interpolate a quantity from the Eulerian grid to the Lagrangian
      * mesh using the default interpolation kernel function.
+     *
+     * \note The synchronization schedules are only used to coarsen data onto
+     * levels that are at least as fine as the next coarser level than the
+     * coarsest level containing Lagrangian data (which provides the coarse
+     * values at the coarse-fine interfaces of that level), and the ghost fill
+     * schedules are only used on levels that contain Lagrangian data.  When
+     * all of the Lagrangian data are assigned to the finest level, the data
+     * are only coarsened from the finest level before a single ghost fill.
      */
     void interp(int f_data_idx,
                 std::vector<SAMRAI::tbox::Pointer<LData> >& F_data,
@@ -473,6 +485,38 @@ public:
      */
     void freeLInitStrategy();
 
+    /*!
+     * \brief Set whether the local nodes on each patch are ordered by the
+     * Morton (Z-order) index of the Cartesian grid cell that contains them.
+     *
+     * When enabled, the local PETSc ordering assigned during redistribution
+     * and the traversal order of the cached patch indices both follow the
+     * Morton curve, so that nodes that are adjacent in memory also tend to
+     * share Eulerian grid data during spreading and interpolation.  The new
+     * ordering takes effect the next time the Lagrangian data are
+     * redistributed.  Disabled by default.
+     */
+    void setSortLocalNodes(bool sort_local_nodes);
+
+    /*!
+     * \brief Set whether redistributions in which no Lagrangian node changes
+     * its owning processor are handled incrementally.
+     *
+     * Whether any node has migrated to another processor is determined
+     * locally in beginDataRedistribution() and is combined across processors
+     * by a single reduction in endDataRedistribution().  If no node migrated,
+     * the patch levels have not changed since the last redistribution, and no
+     * structures were displaced, the existing application ordering and the
+     * local PETSc ordering are kept: only the ghost node indices are
+     * recomputed from the neighbor-only ghost fill of the node index data and
+     * the local parts of the LData vectors are copied in place.  Otherwise,
+     * the full redistribution algorithm is used.  The incremental path does
+     * not re-sort the local nodes, so the full algorithm is always used when
+     * the local nodes are sorted (see setSortLocalNodes()).  Enabled by
+     * default.
+     */
+    void setIncrementalRedistribution(bool incremental_redistribution);
+
     /*!
      * \brief Register a VisIt data writer with the manager.
      */
@@ -1005,6 +1049,18 @@ private:
      */
     static void computeNodeOffsets(unsigned int& num_nodes, unsigned int& node_offset, unsigned int num_local_nodes);
 
+    /*!
+     * Updates the local and global PETSc indices of the nodes in each patch of
+     * the specified level, along with the nonlocal Lagrangian and PETSc
+     * indices, when the set of nodes owned by this processor is unchanged.
+     *
+     * \note This function keeps the present application ordering and local
+     * PETSc ordering.  The global PETSc indices of the nonlocal nodes are
+     * taken from the copies of the nodes that are communicated when filling
+     * the ghost cell region of the node index data.
+     */
+    void updateNodeDistribution(int level_number);
+
     /*!
      * Read object state from the restart file and initialize class data
      * members.  The database from which the restart data is read is determined
@@ -1112,6 +1168,18 @@ private:
      */
     bool d_error_if_points_leave_domain;
 
+    /*
+     * Whether to order the local nodes on each patch by the Morton index of
+     * the cell that contains them.
+     */
+    bool d_sort_local_nodes = false;
+
+    /*
+     * Whether to redistribute the data incrementally when no nodes migrate
+     * between processors.
+     */
+    bool d_incremental_redistribution = true;
+
     /*
      * SAMRAI::hier::IntVector object that determines the ghost cell width of
      * the LNodeData SAMRAI::hier::PatchData objects.
@@ -1172,6 +1240,13 @@ private:
      */
     std::vector<bool> d_needs_synch;
 
+    /*!
+     * Indicates whether the next redistribution must use the full
+     * redistribution algorithm, e.g., because the patch level has changed or
+     * because local nodes have migrated to other processors.
+     */
+    std::vector<bool> d_needs_full_redistribution;
+
     /*!
      * PETSc AO objects provide mappings between the fixed global Lagrangian
      * node IDs and the ever-changing global PETSc ordering.
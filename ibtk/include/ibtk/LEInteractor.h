@@ -16,12 +16,18 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include "ibtk/ibtk_enums.h"
+
 #include "Box.h"
 #include "IntVector.h"
 #include "tbox/Pointer.h"
 
+#include <array>
+#include <deque>
 #include <iosfwd>
+#include <map>
 #include <string>
+#include <tuple>
 #include <vector>
 
 namespace boost
@@ -84,6 +90,50 @@ public:
 
     /*!
      * \brief Set configuration options from a user-supplied database.
+     *
+     * IBAMR::IBMethod and IBAMR::IBFEMethod call this function with the
+     * <code>LEInteractor</code> sub-database of their input databases.
+     *
+     * The following options are recognized:
+     * <ul>
+     * <li><code>num_threads</code>: the number of threads used by each MPI
+     * process to spread and interpolate data on a single patch (default: 1).
+     * When more than one thread is requested, interpolation splits the
+     * Lagrangian points into contiguous chunks, and spreading partitions the
+     * points into spatial tiles that are colored so that tiles whose kernel
+     * footprints may overlap are never spread concurrently.  Threaded
+     * spreading accumulates values in a fixed order and hence is reproducible,
+     * but its roundoff generally differs from that of the serial code path.
+     * The threads are created once, when this function is called, and are
+     * reused by all subsequent operations.  The masked spreading and
+     * interpolation operators, which compute moving least-squares corrected
+     * weights point by point, are unaffected by this option and always run
+     * serially.</li>
+     * <li><code>kernel_implementation</code>: either <code>"FORTRAN"</code>
+     * (default) or <code>"TEMPLATE"</code>.  The latter selects C++
+     * implementations of the IB_4 and IB_6 kernels that are specialized at
+     * compile time on the stencil width and that compute the 1D weights for
+     * batches of Lagrangian points in loops amenable to vectorization.  All
+     * other kernel functions always use the Fortran implementations.</li>
+     * <li><code>use_interaction_plans</code>: whether to cache the interaction
+     * weights between the Lagrangian points on a patch and the patch data
+     * (default: FALSE).  When enabled, the first spreading or interpolation
+     * operation that uses a given LData object for the point positions
+     * records the cell offsets and kernel weights for each point, and
+     * subsequent operations with the same positions reduce to sparse gathers
+     * and scatters.  Cached plans are validated against the current point
+     * positions and patch geometry before each use and are rebuilt
+     * automatically when either changes.  Plans are only used by the member
+     * functions that take the positions as LData; the functions that take
+     * plain arrays (e.g., those used by FEDataManager) never build plans.
+     * This is intended for solvers that apply the spreading and interpolation
+     * operators many times with fixed point positions, e.g., implicit IB and
+     * mobility solvers.  Plans are applied serially and take precedence over
+     * <code>num_threads</code>.</li>
+     * <li><code>max_interaction_plans</code>: the maximum number of cached
+     * interaction plans (default: 256).  When the limit is reached, the oldest
+     * plans are discarded.</li>
+     * </ul>
      */
     static void setFromDatabase(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db);
 
@@ -92,6 +142,24 @@ public:
      */
     static void printClassData(std::ostream& os);
 
+    /*!
+     * \brief Free all cached interaction plans.
+     *
+     * Cached plans are validated before they are used, so calling this
+     * function is never required for correctness.  It is called by
+     * LDataManager and FEDataManager after the Lagrangian data are
+     * redistributed to release plans that can no longer be reused.
+     */
+    static void clearInteractionPlans();
+
+    /*!
+     * \brief Return the number of interaction plans that have been built (or
+     * rebuilt) on this process.
+     *
+     * \note This function is mainly intended for testing.
+     */
+    static int getNumberOfInteractionPlanBuilds();
+
     /*!
      * \brief Returns the interpolation/spreading stencil corresponding to the
      * specified kernel function.
@@ -1228,6 +1296,88 @@ private:
      */
     LEInteractor& operator=(const LEInteractor& that) = delete;
 
+    /*!
+     * \brief Number of threads used to spread and interpolate data on a
+     * single patch.
+     */
+    static int s_num_threads;
+
+    /*!
+     * \brief Implementation used for the kernel functions that have
+     * compile-time specialized implementations.
+     */
+    static LEKernelImplementation s_kernel_implementation;
+
+    /*!
+     * \brief Whether to cache and reuse interaction plans.
+     */
+    static bool s_use_interaction_plans;
+
+    /*!
+     * \brief Cached description of the interaction between a list of
+     * Lagrangian points and the data on a single patch.
+     *
+     * The weights are stored in compressed sparse row format: the cells
+     * influenced by the point local_indices[l] are cell_offsets[k] for
+     * point_ptr[l] <= k < point_ptr[l + 1], in which cell_offsets are linear
+     * offsets into a single component of the ghosted patch data array.
+     */
+    struct InteractionPlan
+    {
+        // Values used to construct the plan.
+        SAMRAI::hier::IntVector<NDIM> q_gcw;
+        std::array<double, NDIM> x_lower, dx;
+        std::vector<int> local_indices;
+        std::vector<double> X;
+
+        // Interaction weights.
+        int depth_stride = 0;
+        std::vector<int> point_ptr, cell_offsets;
+        std::vector<double> weights;
+    };
+
+    /*!
+     * \brief Cached interaction plans, indexed by the LData object that stores
+     * the positions, the kernel function, the data axis, and the extents of
+     * the patch data box.
+     *
+     * At most s_max_interaction_plans plans are kept; the keys of the cached
+     * plans are stored in the order in which the plans were created so that
+     * the oldest plans can be discarded first.  The state of the underlying
+     * PETSc Vec cannot be used to detect changes to the positions because the
+     * positions are usually modified through the ghosted local form of the
+     * Vec.  Each plan is therefore validated against the point positions and
+     * patch geometry before it is used.
+     */
+    using InteractionPlanKey = std::tuple<const LData*, std::string, int, std::array<int, 2 * NDIM> >;
+    static int s_max_interaction_plans;
+    static std::map<InteractionPlanKey, InteractionPlan> s_interaction_plans;
+    static std::deque<InteractionPlanKey> s_interaction_plan_keys;
+    static int s_num_interaction_plan_builds;
+
+    /*!
+     * \brief The LData object that stores the positions passed to the current
+     * spreading or interpolation operation, or nullptr if the positions were
+     * passed as a plain array.
+     */
+    static const LData* s_interaction_plan_X_data;
+
+    /*!
+     * \brief Return the interaction plan for the specified points and patch
+     * data, building or rebuilding it if the cached plan is missing or out of
+     * date.
+     */
+    static const InteractionPlan& getInteractionPlan(const double* X_data,
+                                                     const SAMRAI::hier::Box<NDIM>& q_data_box,
+                                                     const SAMRAI::hier::IntVector<NDIM>& q_gcw,
+                                                     const double* x_lower,
+                                                     const double* x_upper,
+                                                     const double* dx,
+                                                     const std::vector<int>& local_indices,
+                                                     const std::vector<double>& periodic_shifts,
+                                                     const std::string& kernel_fcn,
+                                                     int axis);
+
     /*!
      * Implementation of the IB interpolation operation.
      */
@@ -1268,6 +1418,75 @@ private:
                        const std::string& spread_fcn,
                        int axis = 0);
 
+    /*!
+     * \brief The kernel functions implemented by this class.
+     *
+     * Kernel function names are converted to this type once per spreading or
+     * interpolation operation rather than once per chunk of Lagrangian points.
+     */
+    enum KernelFunction
+    {
+        PIECEWISE_CONSTANT_KERNEL,
+        DISCONTINUOUS_LINEAR_KERNEL,
+        PIECEWISE_LINEAR_KERNEL,
+        PIECEWISE_CUBIC_KERNEL,
+        IB_3_KERNEL,
+        IB_4_KERNEL,
+        IB_4_W8_KERNEL,
+        IB_5_KERNEL,
+        IB_6_KERNEL,
+        BSPLINE_3_KERNEL,
+        BSPLINE_4_KERNEL,
+        BSPLINE_5_KERNEL,
+        BSPLINE_6_KERNEL,
+        USER_DEFINED_KERNEL
+    };
+
+    /*!
+     * \brief Convert a kernel function name to the corresponding
+     * KernelFunction value.  An unrecognized name is an error.
+     */
+    static KernelFunction getKernelFunction(const std::string& kernel_fcn);
+
+    /*!
+     * Apply the IB interpolation kernel to a contiguous list of Lagrangian
+     * points.
+     */
+    static void interpolateKernel(double* Q_data,
+                                  int Q_depth,
+                                  const double* X_data,
+                                  const double* q_data,
+                                  const SAMRAI::hier::Box<NDIM>& q_data_box,
+                                  const SAMRAI::hier::IntVector<NDIM>& q_gcw,
+                                  int q_depth,
+                                  const double* x_lower,
+                                  const double* x_upper,
+                                  const double* dx,
+                                  const int* local_indices,
+                                  const double* periodic_shifts,
+                                  int num_local_indices,
+                                  KernelFunction interp_kernel,
+                                  int axis);
+
+    /*!
+     * Apply the IB spreading kernel to a contiguous list of Lagrangian points.
+     */
+    static void spreadKernel(double* q_data,
+                             const SAMRAI::hier::Box<NDIM>& q_data_box,
+                             const SAMRAI::hier::IntVector<NDIM>& q_gcw,
+                             int q_depth,
+                             const double* Q_data,
+                             int Q_depth,
+                             const double* X_data,
+                             const double* x_lower,
+                             const double* x_upper,
+                             const double* dx,
+                             const int* local_indices,
+                             const double* periodic_shifts,
+                             int num_local_indices,
+                             KernelFunction spread_kernel,
+                             int axis);
+
     /*!
      * \brief Compute the local PETSc indices located within the provided box
      * based on the LNodeIndexSetData values.
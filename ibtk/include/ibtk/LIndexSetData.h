@@ -63,9 +63,15 @@ public:
 
     /*!
      * \brief Update the cached indexing data.
+     *
+     * If \em morton_order is true, the cached indices are generated by
+     * visiting the cells of the patch data in the order defined by
+     * IndexUtilities::getMortonKey() (relative to the lower corner of the
+     * ghost box) rather than in the default index-set order.
      */
     void cacheLocalIndices(SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
-                           const SAMRAI::hier::IntVector<NDIM>& periodic_shift);
+                           const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                           bool morton_order = false);
 
     /*!
      * \return A constant reference to the set of Lagrangian data indices that
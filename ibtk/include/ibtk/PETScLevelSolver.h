@@ -272,6 +272,17 @@ protected:
      */
     virtual void setupNullspace();
 
+    /*!
+     * \brief Refresh the KSP solver and its preconditioner after the values
+     * (but not the nonzero structure) of the system matrix have been modified
+     * in place.
+     *
+     * Submatrices used by the shell preconditioners are updated by reusing
+     * their existing storage, and preconditioner setup is repeated without
+     * regenerating subdomains, index sets, or scatters.
+     */
+    void resetKSPOperators();
+
     /*!
      * \brief Associated hierarchy.
      */
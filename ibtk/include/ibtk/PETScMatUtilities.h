@@ -102,6 +102,23 @@ public:
                                                int dof_index_idx,
                                                SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
 
+    /*!
+     * \brief Reset the values of a parallel PETSc Mat object previously
+     * constructed by constructPatchLevelSCLaplaceOp() for the same patch level
+     * and DOF indexing.
+     *
+     * The nonzero structure of the matrix does not depend on the Poisson
+     * specifications, so the existing storage is reused and only the matrix
+     * entries are overwritten.
+     */
+    static void updatePatchLevelSCLaplaceOp(Mat& mat,
+                                            const SAMRAI::solv::PoissonSpecifications& poisson_spec,
+                                            const std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*>& bc_coefs,
+                                            double data_time,
+                                            const std::vector<int>& num_dofs_per_proc,
+                                            int dof_index_idx,
+                                            SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
+
     /*!
      * \brief Construct a parallel PETSc Mat object corresponding to the
      * side-centered viscous operator of a side-centered velocity variable
@@ -243,6 +243,13 @@ private:
 
     static PetscErrorCode VecDotNorm2_SAMRAI(Vec s, Vec t, PetscScalar* dp, PetscScalar* nm);
 
+    /*
+     * Compute the local parts of the inner products of x with each of the
+     * vectors y.  When possible, all of the inner products are computed in a
+     * single pass over the data of x.
+     */
+    static void computeLocalMDot(Vec x, PetscInt nv, const Vec* y, PetscScalar* val);
+
     /*
      * Vector data is maintained in the SAMRAI vector structure.
      */
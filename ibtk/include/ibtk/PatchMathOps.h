@@ -481,6 +481,28 @@ public:
                     int m = 0,
                     int n = 0) const;
 
+    /*!
+     * \brief Computes dst_u = alpha L src_u + beta src_u + grad src_p + gamma
+     * src2 and dst_p = -div src_u in a single sweep over the patch.
+     *
+     * This is equivalent to calling grad(), laplace(), and div() in sequence
+     * but reads and writes each array only once. If alpha and beta are both
+     * zero, the Laplacian is not evaluated. If dst_p is NULL, the divergence
+     * is not computed. src2 may be the same as dst_u.
+     *
+     * Uses the standard 5 point stencil in 2D (7 point stencil in 3D) for the
+     * Laplacian.
+     */
+    void stokes(SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > dst_u,
+                SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > dst_p,
+                double alpha,
+                double beta,
+                SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > src_u,
+                SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > src_p,
+                double gamma,
+                SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > src2,
+                SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch) const;
+
     /*!
      * \brief Compute dst_i = alpha src1_j + beta src2_k, pointwise.
      */
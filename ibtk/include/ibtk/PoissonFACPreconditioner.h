@@ -75,6 +75,12 @@ public:
      */
     void setPoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& poisson_spec) override;
 
+    /*!
+     * \brief Reset the SAMRAI::solv::PoissonSpecifications object used by the
+     * FAC strategy without reinitializing the preconditioner.
+     */
+    bool updatePoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& poisson_spec) override;
+
     /*!
      * \brief Set the SAMRAI::solv::RobinBcCoefStrategy object used to specify
      * physical boundary conditions.
@@ -117,6 +117,17 @@ public:
      */
     virtual void setPoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& poisson_spec);
 
+    /*!
+     * \brief Reset the SAMRAI::solv::PoissonSpecifications object used by an
+     * initialized operator.
+     *
+     * \return \p true if the hierarchy-dependent operator state is consistent
+     * with the new coefficients, or \p false if the operator state must be
+     * reinitialized.  The default implementation returns \p true only if the
+     * operator state is not initialized.
+     */
+    virtual bool updatePoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& poisson_spec);
+
     /*!
      * \brief Set the SAMRAI::solv::RobinBcCoefStrategy object used to specify
      * physical boundary conditions.
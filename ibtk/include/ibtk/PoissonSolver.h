@@ -60,6 +60,23 @@ public:
      */
     virtual void setPoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& poisson_spec);
 
+    /*!
+     * \brief Reset the SAMRAI::solv::PoissonSpecifications object used by an
+     * initialized solver without deallocating and reinitializing the solver
+     * state.
+     *
+     * Implementations that can refresh their hierarchy-dependent data in place
+     * (e.g., by updating the values of an existing matrix and recomputing the
+     * associated preconditioner) should do so and return \p true.  A return
+     * value of \p false indicates that the new coefficients have been stored
+     * but that the caller must call initializeSolverState() before the solver
+     * is next used.
+     *
+     * The default implementation sets the Poisson specifications and returns
+     * \p true only if the solver is not initialized.
+     */
+    virtual bool updatePoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& poisson_spec);
+
     /*!
      * \brief Set the SAMRAI::solv::RobinBcCoefStrategy object used to specify
      * physical boundary conditions.
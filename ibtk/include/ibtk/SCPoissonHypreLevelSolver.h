@@ -138,6 +138,13 @@ public:
         return new SCPoissonHypreLevelSolver(object_name, input_db, default_options_prefix);
     } // allocate_solver
 
+    /*!
+     * \brief Reset the Poisson specifications of an initialized solver by
+     * overwriting the values of the existing hypre matrix and repeating the
+     * hypre solver setup.  The hypre grid, stencil, and graph are reused.
+     */
+    bool updatePoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& poisson_spec) override;
+
     /*!
      * \name Linear solver functionality.
      */
@@ -116,6 +116,13 @@ public:
         return new SCPoissonPETScLevelSolver(object_name, input_db, default_options_prefix);
     } // allocate_solver
 
+    /*!
+     * \brief Reset the Poisson specifications of an initialized solver by
+     * overwriting the values of the existing PETSc matrix and recomputing the
+     * preconditioner.
+     */
+    bool updatePoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& poisson_spec) override;
+
 protected:
     /*!
      * \brief Generate IS/subdomains for Schwartz type preconditioners.
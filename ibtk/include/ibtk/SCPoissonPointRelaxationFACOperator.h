@@ -133,6 +133,17 @@ public:
      */
     void setCoarseSolverType(const std::string& coarse_solver_type) override;
 
+    /*!
+     * \brief Reset the Poisson specifications of an initialized operator.
+     *
+     * The smoothers and residual evaluation read the coefficients when they are
+     * applied, so only the coarse level solver needs to be updated.  The
+     * operator must be reinitialized if the form of the diffusion coefficient
+     * (constant or variable) changes, because it determines the ghost cell fill
+     * pattern.
+     */
+    bool updatePoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& poisson_spec) override;
+
     //\}
 
     /*!
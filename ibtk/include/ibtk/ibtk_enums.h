@@ -175,6 +175,35 @@ enum_to_string<VCInterpType>(VCInterpType val)
     return "UNKNOWN_VC_INTERP_TYPE";
 } // enum_to_string
 
+/*!
+ * \brief Enumerated type for the different implementations of the kernel
+ * functions used by LEInteractor.
+ */
+enum LEKernelImplementation
+{
+    FORTRAN_LE_KERNEL = 1,
+    TEMPLATE_LE_KERNEL = 2,
+    UNKNOWN_LE_KERNEL_IMPLEMENTATION = -1
+};
+
+template <>
+inline LEKernelImplementation
+string_to_enum<LEKernelImplementation>(const std::string& val)
+{
+    if (strcasecmp(val.c_str(), "FORTRAN") == 0) return FORTRAN_LE_KERNEL;
+    if (strcasecmp(val.c_str(), "TEMPLATE") == 0) return TEMPLATE_LE_KERNEL;
+    return UNKNOWN_LE_KERNEL_IMPLEMENTATION;
+} // string_to_enum
+
+template <>
+inline std::string
+enum_to_string<LEKernelImplementation>(LEKernelImplementation val)
+{
+    if (val == FORTRAN_LE_KERNEL) return "FORTRAN";
+    if (val == TEMPLATE_LE_KERNEL) return "TEMPLATE";
+    return "UNKNOWN_LE_KERNEL_IMPLEMENTATION";
+} // enum_to_string
+
 } // namespace IBTK
 
 //////////////////////////////////////////////////////////////////////////////
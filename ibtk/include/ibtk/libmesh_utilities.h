@@ -224,6 +224,24 @@ using TensorMeshFcnPtr =
              double data_time,
              void* ctx);
 
+/*!
+ * Batched version of TensorMeshFcnPtr that evaluates a tensor-valued function
+ * at the n_points quadrature points of a single element in one call.  Entry i
+ * of each of the arrays F, FF, x, and X (and of system_var_data and
+ * system_grad_var_data) corresponds to quadrature point i.
+ */
+using TensorMeshBatchFcnPtr =
+    void (*)(libMesh::TensorValue<double>* F,
+             const libMesh::TensorValue<double>* FF,
+             const libMesh::Point* x,
+             const libMesh::Point* X,
+             unsigned int n_points,
+             libMesh::Elem* elem,
+             const std::vector<std::vector<const std::vector<double>*> >& system_var_data,
+             const std::vector<std::vector<const std::vector<libMesh::VectorValue<double> >*> >& system_grad_var_data,
+             double data_time,
+             void* ctx);
+
 using ScalarSurfaceFcnPtr =
     void (*)(double& F,
              const libMesh::VectorValue<double>& n,
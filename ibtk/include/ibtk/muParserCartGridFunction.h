@@ -19,12 +19,15 @@
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/ibtk_utilities.h"
 
+#include "ArrayData.h"
+#include "Box.h"
 #include "CartesianGridGeometry.h"
 #include "PatchLevel.h"
 #include "tbox/Pointer.h"
 
 #include "muParser.h"
 
+#include <array>
 #include <map>
 #include <string>
 #include <vector>
@@ -53,6 +56,13 @@ namespace IBTK
  * class CartGridFunction that allows for the run-time specification of
  * (possibly spatially- and temporally-varying) functions which are used to set
  * double precision values on standard SAMRAI SAMRAI::hier::PatchData objects.
+ *
+ * The functions are evaluated using the bulk mode of muParser, i.e., all of the
+ * values in a patch data box are computed by a single call to the parser.
+ * Functions that do not depend on the time variable (t or T) are evaluated
+ * only once per patch: the values are cached and reused for later calls until
+ * the patch box or the grid spacing changes (e.g., after regridding). Values
+ * computed to set initial data are not cached.
  */
 class muParserCartGridFunction : public CartGridFunction
 {
@@ -122,6 +132,32 @@ private:
      */
     muParserCartGridFunction& operator=(const muParserCartGridFunction& that) = delete;
 
+    /*!
+     * \brief Set the values of the specified depth of the array data on the
+     * provided index box.
+     *
+     * The position associated with index i of the array data is determined
+     * by shifting the index components by \p permutation (for face-centered
+     * data) and then adding \p centering to the shifted cell index.
+     */
+    void setDataOnArrayData(SAMRAI::pdat::ArrayData<NDIM, double>& data,
+                            int data_depth,
+                            int function_depth,
+                            const SAMRAI::hier::Box<NDIM>& index_box,
+                            const std::array<double, NDIM>& centering,
+                            unsigned int permutation,
+                            int cache_id,
+                            const SAMRAI::hier::Patch<NDIM>& patch,
+                            double data_time,
+                            bool use_cache);
+
+    /*!
+     * \brief Ensure that the bulk evaluation buffers can hold at least \p n
+     * values. The parser variables are rebound when the buffers are
+     * reallocated.
+     */
+    void reserveBulkBuffers(int n);
+
     /*!
      * The Cartesian grid geometry object provides the extents of the
      * computational domain.
@@ -145,10 +181,30 @@ private:
     std::vector<mu::Parser> d_parsers;
 
     /*!
-     * Time and position variables.
+     * Whether each of the data-setting functions depends on time.
+     */
+    std::vector<bool> d_time_dependent;
+
+    /*!
+     * Time and position variables, stored as arrays for bulk evaluation, and
+     * the corresponding function values.
+     */
+    std::vector<double> d_bulk_time;
+    std::array<std::vector<double>, NDIM> d_bulk_posn;
+    std::vector<double> d_bulk_vals;
+
+    /*!
+     * Cached values of the time-independent functions, indexed by the patch
+     * level number, the patch number, the data centering and axis, and the
+     * function index.
      */
-    double d_parser_time = 0.0;
-    Point d_parser_posn;
+    struct CachedValues
+    {
+        SAMRAI::hier::Box<NDIM> box;
+        std::array<double, NDIM> x_lower, dx;
+        std::vector<double> vals;
+    };
+    std::map<std::array<int, 4>, CachedValues> d_cached_vals;
 };
 } // namespace IBTK
 
@@ -25,6 +25,7 @@
 
 #include "muParser.h"
 
+#include <array>
 #include <map>
 #include <string>
 #include <vector>
@@ -164,25 +165,29 @@ private:
     muParserRobinBcCoefs& operator=(const muParserRobinBcCoefs& that) = delete;
 
     /*!
-     * Current time value used by the mu::Parser instances.
-     *
-     * This value is mutable since the mu::Parser objects each store a pointer
-     * to it but its specific value (the present time) changes during each
-     * call to muParserRobinBcCoefs::setBcCoefs. The alternative would be to
-     * rebuild the mu::Parser objects during each call to
-     * muParserRobinBcCoefs::setBcCoefs, which is much more expensive. Since
-     * this variable is only written to and subsequently read from in that
-     * function this is reasonable.
+     * \brief Ensure that the bulk evaluation buffers can hold at least \p n
+     * values. The parser variables are rebound when the buffers are
+     * reallocated.
      */
-    mutable double d_parser_time = 0.0;
+    void reserveBulkBuffers(int n) const;
 
     /*!
-     * Current space point used by the mu::Parser instances.
+     * Time and position values used by the mu::Parser instances, stored as
+     * arrays so that all of the coefficients along a boundary box are
+     * evaluated by a single call to the parser, and the corresponding
+     * coefficient values.
      *
-     * This value is mutable for the same reasons that
-     * muParserRobinBcCoefs::d_parser_time is mutable.
+     * These values are mutable since the mu::Parser objects each store a
+     * pointer to them but their specific values change during each call to
+     * muParserRobinBcCoefs::setBcCoefs. The alternative would be to rebuild
+     * the mu::Parser objects during each call to
+     * muParserRobinBcCoefs::setBcCoefs, which is much more expensive. Since
+     * these variables are only written to and subsequently read from in that
+     * function this is reasonable.
      */
-    mutable Point d_parser_posn;
+    mutable std::vector<double> d_bulk_time;
+    mutable std::array<std::vector<double>, NDIM> d_bulk_posn;
+    mutable std::vector<double> d_bulk_vals;
 
     /*!
      * The Cartesian grid geometry object provides the extents of the
@@ -205,10 +210,13 @@ private:
 
     /*!
      * The mu::Parser objects which evaluate the data-setting functions.
+     *
+     * These objects are mutable since bulk evaluation and rebinding the
+     * parser variables are non-const operations.
      */
-    std::array<mu::Parser, 2 * NDIM> d_acoef_parsers;
-    std::array<mu::Parser, 2 * NDIM> d_bcoef_parsers;
-    std::array<mu::Parser, 2 * NDIM> d_gcoef_parsers;
+    mutable std::array<mu::Parser, 2 * NDIM> d_acoef_parsers;
+    mutable std::array<mu::Parser, 2 * NDIM> d_bcoef_parsers;
+    mutable std::array<mu::Parser, 2 * NDIM> d_gcoef_parsers;
 };
 } // namespace IBTK
 
@@ -184,6 +184,22 @@ IndexUtilities::mapIndexToInteger(const SAMRAI::hier::Index<NDIM>& i,
 
 } // mapIndexToInteger
 
+inline std::uint64_t
+IndexUtilities::getMortonKey(const SAMRAI::hier::Index<NDIM>& i, const SAMRAI::hier::Index<NDIM>& i_lower)
+{
+    static const int num_bits = 64 / NDIM;
+    std::uint64_t key = 0;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        const auto i_d = static_cast<std::uint64_t>(i(d) - i_lower(d));
+        for (int b = 0; b < num_bits; ++b)
+        {
+            key |= ((i_d >> b) & std::uint64_t(1)) << (NDIM * b + d);
+        }
+    }
+    return key;
+} // getMortonKey
+
 inline SAMRAI::hier::IntVector<NDIM>
 IndexUtilities::partitionPatchBox(std::vector<SAMRAI::hier::Box<NDIM> >& overlap_boxes,
                                   std::vector<SAMRAI::hier::Box<NDIM> >& nonoverlap_boxes,
@@ -225,12 +225,11 @@ LSet<T>::unpackStream(SAMRAI::tbox::AbstractStream& stream, const SAMRAI::hier::
     d_offset = offset;
     int num_idx;
     stream.unpack(&num_idx, 1);
-    d_set.resize(num_idx);
+    typename LSet<T>::DataSet(num_idx).swap(d_set); // allocate exactly num_idx entries
     for (unsigned int k = 0; k < d_set.size(); ++k)
     {
         d_set[k] = new T(stream, offset);
     }
-    typename LSet<T>::DataSet(d_set).swap(d_set); // trim-to-fit
     return;
 } // unpackStream
 
@@ -88,12 +88,13 @@ StreamableManager::unpackStream(SAMRAI::tbox::AbstractStream& stream,
 {
     int num_data;
     stream.unpack(&num_data, 1);
-    data_items.resize(num_data);
+    // Allocate exactly num_data entries up front instead of trimming (and
+    // thereby copying all of the reference-counted pointers) afterwards.
+    std::vector<SAMRAI::tbox::Pointer<Streamable> >(num_data).swap(data_items);
     for (auto& data_item : data_items)
     {
         data_item = unpackStream(stream, offset);
     }
-    std::vector<SAMRAI::tbox::Pointer<Streamable> >(data_items).swap(data_items); // trim-to-fit
     return;
 } // unpackStream
 
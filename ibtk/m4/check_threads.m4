@@ -0,0 +1,42 @@
+## ---------------------------------------------------------------------
+##
+## Copyright (c) 2020 - 2020 by the IBAMR developers
+## All rights reserved.
+##
+## This file is part of IBAMR.
+##
+## IBAMR is free software and is distributed under the 3-clause BSD
+## license. The full text of the license can be found in the file
+## COPYRIGHT at the top level directory of IBAMR.
+##
+## ---------------------------------------------------------------------
+
+AC_DEFUN([CHECK_THREADS],[
+AC_MSG_CHECKING([for the compiler flags needed to use std::thread])
+check_threads_CXXFLAGS="$CXXFLAGS"
+check_threads_LIBS="$LIBS"
+CXXFLAGS="$check_threads_CXXFLAGS -pthread"
+LIBS="$check_threads_LIBS -pthread"
+AC_LINK_IFELSE([AC_LANG_PROGRAM([[
+#include <thread>
+]], [[
+    int i = 0;
+    std::thread t([&i]() { i = 1; });
+    t.join();
+    return i == 1 ? 0 : 1;
+]])],[
+AC_MSG_RESULT(-pthread)],[
+CXXFLAGS="$check_threads_CXXFLAGS"
+LIBS="$check_threads_LIBS"
+AC_LINK_IFELSE([AC_LANG_PROGRAM([[
+#include <thread>
+]], [[
+    int i = 0;
+    std::thread t([&i]() { i = 1; });
+    t.join();
+    return i == 1 ? 0 : 1;
+]])],[
+AC_MSG_RESULT(none needed)],[
+AC_MSG_RESULT(no)
+AC_MSG_ERROR([could not link a program that uses std::thread])])])
+])
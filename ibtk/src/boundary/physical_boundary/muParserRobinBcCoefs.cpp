@@ -265,19 +265,10 @@ muParserRobinBcCoefs::muParserRobinBcCoefs(const std::string& object_name,
         {
             parser->DefineConst(constant.first, constant.second);
         }
-
-        // Variables.
-        parser->DefineVar("T", &d_parser_time);
-        parser->DefineVar("t", &d_parser_time);
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            const std::string postfix = std::to_string(d);
-            parser->DefineVar("X" + postfix, d_parser_posn.data() + d);
-            parser->DefineVar("x" + postfix, d_parser_posn.data() + d);
-            parser->DefineVar("X_" + postfix, d_parser_posn.data() + d);
-            parser->DefineVar("x_" + postfix, d_parser_posn.data() + d);
-        }
     }
+
+    // Variables.
+    reserveBulkBuffers(1);
     return;
 } // muParserRobinBcCoefs
 
@@ -309,29 +300,40 @@ muParserRobinBcCoefs::setBcCoefs(Pointer<ArrayData<NDIM, double> >& acoef_data,
     TBOX_ASSERT(!gcoef_data || bc_coef_box == gcoef_data->getBox());
 #endif
 
-    const mu::Parser& acoef_parser = d_acoef_parsers[location_index];
-    const mu::Parser& bcoef_parser = d_bcoef_parsers[location_index];
-    const mu::Parser& gcoef_parser = d_gcoef_parsers[location_index];
-    d_parser_time = fill_time;
-    for (Box<NDIM>::Iterator b(bc_coef_box); b; b++)
+    // Compute the positions at which the coefficients are evaluated.
+    const int n = bc_coef_box.size();
+    reserveBulkBuffers(n);
+    std::fill(d_bulk_time.begin(), d_bulk_time.begin() + n, fill_time);
+    int k = 0;
+    for (Box<NDIM>::Iterator b(bc_coef_box); b; b++, ++k)
     {
         const hier::Index<NDIM>& i = b();
         for (unsigned int d = 0; d < NDIM; ++d)
         {
             if (d != bdry_normal_axis)
             {
-                d_parser_posn[d] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
+                d_bulk_posn[d][k] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
             }
             else
             {
-                d_parser_posn[d] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
+                d_bulk_posn[d][k] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
             }
         }
+    }
+
+    // Evaluate the coefficients along the entire boundary box at once.
+    std::array<std::pair<ArrayData<NDIM, double>*, mu::Parser*>, 3> coefs = {
+        { std::make_pair(acoef_data.getPointer(), &d_acoef_parsers[location_index]),
+          std::make_pair(bcoef_data.getPointer(), &d_bcoef_parsers[location_index]),
+          std::make_pair(gcoef_data.getPointer(), &d_gcoef_parsers[location_index]) }
+    };
+    for (const auto& coef : coefs)
+    {
+        ArrayData<NDIM, double>* const coef_data = coef.first;
+        if (!coef_data) continue;
         try
         {
-            if (acoef_data) (*acoef_data)(i, 0) = acoef_parser.Eval();
-            if (bcoef_data) (*bcoef_data)(i, 0) = bcoef_parser.Eval();
-            if (gcoef_data) (*gcoef_data)(i, 0) = gcoef_parser.Eval();
+            coef.second->Eval(d_bulk_vals.data(), n);
         }
         catch (mu::ParserError& e)
         {
@@ -344,6 +346,11 @@ muParserRobinBcCoefs::setBcCoefs(Pointer<ArrayData<NDIM, double> >& acoef_data,
             TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
                        << "  unrecognized exception generated by muParser library.\n");
         }
+        k = 0;
+        for (Box<NDIM>::Iterator b(bc_coef_box); b; b++, ++k)
+        {
+            (*coef_data)(b(), 0) = d_bulk_vals[k];
+        }
     }
     return;
 } // setBcCoefs
@@ -358,6 +365,41 @@ muParserRobinBcCoefs::numberOfExtensionsFillable() const
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+muParserRobinBcCoefs::reserveBulkBuffers(const int n) const
+{
+    if (n <= static_cast<int>(d_bulk_time.size())) return;
+    d_bulk_time.resize(n);
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        d_bulk_posn[d].resize(n);
+    }
+    d_bulk_vals.resize(n);
+
+    // In bulk mode, muParser reads the value of each variable at the offset of
+    // the value being computed, so the variables must be rebound whenever the
+    // buffers are reallocated.
+    for (int location_index = 0; location_index < 2 * NDIM; ++location_index)
+    {
+        for (mu::Parser* parser : { &d_acoef_parsers[location_index],
+                                    &d_bcoef_parsers[location_index],
+                                    &d_gcoef_parsers[location_index] })
+        {
+            parser->DefineVar("T", d_bulk_time.data());
+            parser->DefineVar("t", d_bulk_time.data());
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                const std::string postfix = std::to_string(d);
+                parser->DefineVar("X" + postfix, d_bulk_posn[d].data());
+                parser->DefineVar("x" + postfix, d_bulk_posn[d].data());
+                parser->DefineVar("X_" + postfix, d_bulk_posn[d].data());
+                parser->DefineVar("x_" + postfix, d_bulk_posn[d].data());
+            }
+        }
+    }
+    return;
+} // reserveBulkBuffers
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBTK
@@ -527,6 +527,9 @@ FEDataManager::reinitElementMappings()
     d_system_ghost_vec.clear();
     d_system_ib_ghost_vec.clear();
 
+    // Cached interaction plans refer to the old distribution of the data.
+    LEInteractor::clearInteractionPlans();
+
     // Reset the mappings between grid patches and active mesh
     // elements. collectActivePatchElements will populate d_active_elem_bboxes
     // and use it.
@@ -106,6 +106,7 @@ IBTK_ENABLE_EXTRA_WARNINGS
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <limits>
 #include <map>
 #include <memory>
@@ -113,6 +114,7 @@ IBTK_ENABLE_EXTRA_WARNINGS
 #include <ostream>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -150,6 +152,8 @@ static Timer* t_begin_nonlocal_data_fill;
 static Timer* t_end_nonlocal_data_fill;
 static Timer* t_compute_node_distribution;
 static Timer* t_compute_node_offsets;
+static Timer* t_update_node_distribution;
+static Timer* t_sort_local_nodes;
 
 // Assume max(U)dt/dx <= 2.
 static const int CFL_WIDTH = 2;
@@ -280,6 +284,7 @@ LDataManager::setPatchLevels(const int coarsest_ln, const int finest_ln)
     d_lag_mesh.resize(d_finest_ln + 1);
     d_lag_mesh_data.resize(d_finest_ln + 1);
     d_needs_synch.resize(d_finest_ln + 1, false);
+    d_needs_full_redistribution.resize(d_finest_ln + 1, true);
     d_ao.resize(d_finest_ln + 1);
     d_num_nodes.resize(d_finest_ln + 1);
     d_node_offset.resize(d_finest_ln + 1);
@@ -604,13 +609,23 @@ LDataManager::spread(const int f_data_idx,
         if (X_data_ghost_node_update) X_data[ln]->beginGhostUpdate();
     }
 
+    // Determine the coarsest level that contains Lagrangian data.  The Eulerian
+    // data on all levels have been zeroed, so prolonging data to levels that
+    // are not finer than this level would only communicate zeros.
+    int coarsest_lag_ln = finest_ln + 1;
+    for (int ln = finest_ln; ln >= coarsest_ln; --ln)
+    {
+        if (levelContainsLagrangianData(ln)) coarsest_lag_ln = ln;
+    }
+
     // Spread data from the Lagrangian mesh to the Eulerian grid.
     Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
-        // If there are coarser levels in the patch hierarchy, prolong data from
-        // the coarser levels before spreading data on this level.
-        if (ln > coarsest_ln && ln < static_cast<int>(f_prolongation_scheds.size()) && f_prolongation_scheds[ln])
+        // If there are coarser levels in the patch hierarchy that contain
+        // spread data, prolong data from the coarser levels before spreading
+        // data on this level.
+        if (ln > coarsest_lag_ln && ln < static_cast<int>(f_prolongation_scheds.size()) && f_prolongation_scheds[ln])
         {
             f_prolongation_scheds[ln]->fillData(fill_data_time);
         }
@@ -726,8 +741,18 @@ LDataManager::interp(const int f_data_idx,
     const bool sc_data = f_sc_var;
     TBOX_ASSERT(cc_data || ec_data || nc_data || sc_data);
 
+    // Determine the coarsest level that contains Lagrangian data.  Eulerian
+    // values only need to be synchronized on that level and finer levels, and
+    // on the next coarser level, from which the ghost cells of that level are
+    // filled at coarse-fine interfaces.
+    int coarsest_lag_ln = finest_ln + 1;
+    for (int ln = finest_ln; ln >= coarsest_ln; --ln)
+    {
+        if (levelContainsLagrangianData(ln)) coarsest_lag_ln = ln;
+    }
+
     // Synchronize Eulerian values.
-    for (int ln = finest_ln; ln > coarsest_ln; --ln)
+    for (int ln = finest_ln; ln >= std::max(coarsest_lag_ln, coarsest_ln + 1); --ln)
     {
         if (ln < static_cast<int>(f_synch_scheds.size()) && f_synch_scheds[ln])
         {
@@ -832,6 +857,20 @@ LDataManager::freeLInitStrategy()
     return;
 } // freeLInitStrategy
 
+void
+LDataManager::setSortLocalNodes(const bool sort_local_nodes)
+{
+    d_sort_local_nodes = sort_local_nodes;
+    return;
+} // setSortLocalNodes
+
+void
+LDataManager::setIncrementalRedistribution(const bool incremental_redistribution)
+{
+    d_incremental_redistribution = incremental_redistribution;
+    return;
+} // setIncrementalRedistribution
+
 void
 LDataManager::registerVisItDataWriter(Pointer<VisItDataWriter<NDIM> > visit_writer)
 {
@@ -1447,6 +1486,14 @@ LDataManager::beginDataRedistribution(const int coarsest_ln_in, const int finest
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_number);
         const Pointer<CartesianGridGeometry<NDIM> > grid_geom = level->getGridGeometry();
         const IntVector<NDIM>& ratio = level->getRatio();
+
+        // Keep track of whether any nodes migrate to or from this processor.
+        // Because all of the local nodes precede the nonlocal nodes in the
+        // local PETSc ordering, a node that was previously owned by another
+        // processor is identified by its local PETSc index.
+        const auto num_old_local_nodes = static_cast<int>(d_local_lag_indices[level_number].size());
+        int num_new_local_nodes = 0;
+        bool nonlocal_nodes_migrated = false;
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
@@ -1499,11 +1546,21 @@ LDataManager::beginDataRedistribution(const int coarsest_ln_in, const int finest
                 std::sort(node_set.begin(), node_set.end(), LNodeIndexLagrangianIndexComp());
                 node_set.erase(std::unique(node_set.begin(), node_set.end(), LNodeIndexLagrangianIndexEqual()),
                                node_set.end());
+                num_new_local_nodes += static_cast<int>(node_set.size());
+                for (const auto& node_idx : node_set)
+                {
+                    nonlocal_nodes_migrated =
+                        nonlocal_nodes_migrated || node_idx->getLocalPETScIndex() >= num_old_local_nodes;
+                }
             }
             patch->setPatchData(d_lag_node_index_current_idx, new_idx_data);
         }
         d_lag_mesh_data[level_number][POSN_DATA_NAME]->restoreArrays();
         d_needs_synch[level_number] = true;
+        if (nonlocal_nodes_migrated || num_new_local_nodes != num_old_local_nodes)
+        {
+            d_needs_full_redistribution[level_number] = true;
+        }
     }
 
     IBTK_TIMER_STOP(t_begin_data_redistribution);
@@ -1533,6 +1590,25 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
         }
     }
 
+    // Cached interaction plans refer to the old distribution of the data.
+    LEInteractor::clearInteractionPlans();
+
+    // Determine which levels require the full redistribution algorithm.  The
+    // remaining levels are updated incrementally: no nodes have migrated
+    // between processors, so the application ordering and the local PETSc
+    // ordering remain valid and only the ghost nodes need to be recomputed.
+    // The incremental update keeps the old local ordering, so it is not used
+    // when the local nodes are to be re-sorted.
+    std::vector<int> use_full_redistribution(finest_ln + 1, 1);
+    for (int level_number = coarsest_ln; level_number <= finest_ln; ++level_number)
+    {
+        if (!d_level_contains_lag_data[level_number]) continue;
+        use_full_redistribution[level_number] = !d_incremental_redistribution || d_sort_local_nodes ||
+                                                d_needs_full_redistribution[level_number] ||
+                                                !d_displaced_strct_ids[level_number].empty();
+    }
+    SAMRAI_MPI::maxReduction(&use_full_redistribution[0], finest_ln + 1);
+
     // Update parallel data structures to account for any displaced nodes.
     for (int level_number = coarsest_ln; level_number <= finest_ln; ++level_number)
     {
@@ -1725,6 +1801,41 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
         dst_vec[level_number].resize(num_data);
         scatter[level_number].resize(num_data);
 
+        if (!use_full_redistribution[level_number])
+        {
+            // Update the ghost node indices for the level.
+            updateNodeDistribution(level_number);
+            num_local_nodes[level_number] = static_cast<int>(d_local_lag_indices[level_number].size());
+            num_nonlocal_nodes[level_number] = static_cast<int>(d_nonlocal_lag_indices[level_number].size());
+
+            // The layout of the local data is unchanged, so the local values
+            // are simply copied into new Vec objects with the new ghost
+            // indices.
+            std::map<std::string, Pointer<LData> >::iterator it;
+            int i;
+            for (it = level_data.begin(), i = 0; it != level_data.end(); ++it, ++i)
+            {
+                Pointer<LData> data = it->second;
+#if !defined(NDEBUG)
+                TBOX_ASSERT(data);
+#endif
+                const int depth = data->getDepth();
+                src_vec[level_number][i] = data->getVec();
+                ierr = VecCreateGhostBlock(
+                    PETSC_COMM_WORLD,
+                    depth,
+                    depth * num_local_nodes[level_number],
+                    PETSC_DECIDE,
+                    num_nonlocal_nodes[level_number],
+                    num_nonlocal_nodes[level_number] > 0 ? &d_nonlocal_petsc_indices[level_number][0] : nullptr,
+                    &dst_vec[level_number][i]);
+                IBTK_CHKERRQ(ierr);
+                ierr = VecCopy(src_vec[level_number][i], dst_vec[level_number][i]);
+                IBTK_CHKERRQ(ierr);
+            }
+            continue;
+        }
+
         // Get the new distribution of nodes for the level.
         //
         // NOTE: This process updates the local PETSc indices of the LNodeSet
@@ -1856,7 +1967,7 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
-            idx_data->cacheLocalIndices(patch, periodic_shift);
+            idx_data->cacheLocalIndices(patch, periodic_shift, d_sort_local_nodes);
             const Box<NDIM>& ghost_box = idx_data->getGhostBox();
             for (LNodeSetData::DataIterator it = idx_data->data_begin(ghost_box); it != idx_data->data_end(); ++it)
             {
@@ -1898,14 +2009,17 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
         int i;
         for (it = level_data.begin(), i = 0; it != level_data.end(); ++it, ++i)
         {
-            ierr = VecScatterEnd(scatter[level_number][i],
-                                 src_vec[level_number][i],
-                                 dst_vec[level_number][i],
-                                 INSERT_VALUES,
-                                 SCATTER_FORWARD);
-            IBTK_CHKERRQ(ierr);
-            ierr = VecScatterDestroy(&scatter[level_number][i]);
-            IBTK_CHKERRQ(ierr);
+            if (use_full_redistribution[level_number])
+            {
+                ierr = VecScatterEnd(scatter[level_number][i],
+                                     src_vec[level_number][i],
+                                     dst_vec[level_number][i],
+                                     INSERT_VALUES,
+                                     SCATTER_FORWARD);
+                IBTK_CHKERRQ(ierr);
+                ierr = VecScatterDestroy(&scatter[level_number][i]);
+                IBTK_CHKERRQ(ierr);
+            }
             Pointer<LData> data = it->second;
             data->resetData(dst_vec[level_number][i], d_nonlocal_petsc_indices[level_number]);
         }
@@ -1920,6 +2034,10 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
     for (int level_number = coarsest_ln; level_number <= finest_ln; ++level_number)
     {
         d_needs_synch[level_number] = false;
+        d_needs_full_redistribution[level_number] = false;
+
+        // The application ordering is unchanged by an incremental update.
+        if (!use_full_redistribution[level_number]) continue;
 
         if (d_ao[level_number])
         {
@@ -2121,6 +2239,7 @@ LDataManager::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM> > hiera
         d_lag_mesh.resize(level_number + 1);
         d_lag_mesh_data.resize(level_number + 1);
         d_needs_synch.resize(level_number + 1, false);
+        d_needs_full_redistribution.resize(level_number + 1, true);
         d_ao.resize(level_number + 1);
         d_num_nodes.resize(level_number + 1);
         d_node_offset.resize(level_number + 1);
@@ -2248,7 +2367,7 @@ LDataManager::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM> > hiera
 
             node_count_data->fillAll(0.0);
 
-            idx_data->cacheLocalIndices(patch, periodic_shift);
+            idx_data->cacheLocalIndices(patch, periodic_shift, d_sort_local_nodes);
             for (LNodeSetData::SetIterator it(*idx_data); it; it++)
             {
                 const CellIndex<NDIM>& i = it.getIndex();
@@ -2340,6 +2459,13 @@ LDataManager::resetHierarchyConfiguration(const Pointer<BasePatchHierarchy<NDIM>
     setPatchHierarchy(hierarchy);
     setPatchLevels(0, finest_hier_level);
 
+    // The node distributions on the reset levels cannot be updated
+    // incrementally.
+    for (int level_number = coarsest_ln; level_number <= finest_hier_level; ++level_number)
+    {
+        d_needs_full_redistribution[level_number] = true;
+    }
+
     // Reset the Silo data writer.
     if (d_silo_writer)
     {
@@ -2692,7 +2818,10 @@ LDataManager::LDataManager(std::string object_name,
         t_end_nonlocal_data_fill = TimerManager::getManager()->getTimer("IBTK::LDataManager::endNonlocalDataFill()");
         t_compute_node_distribution =
             TimerManager::getManager()->getTimer("IBTK::LDataManager::computeNodeDistribution()");
-        t_compute_node_offsets = TimerManager::getManager()->getTimer("IBTK::LDataManager::computeNodeOffsets()"););
+        t_compute_node_offsets = TimerManager::getManager()->getTimer("IBTK::LDataManager::computeNodeOffsets()");
+        t_update_node_distribution =
+            TimerManager::getManager()->getTimer("IBTK::LDataManager::updateNodeDistribution()");
+        t_sort_local_nodes = TimerManager::getManager()->getTimer("IBTK::LDataManager::sortLocalNodes()"););
     return;
 } // LDataManager
 
@@ -2877,14 +3006,44 @@ LDataManager::computeNodeDistribution(AO& ao,
     unsigned int local_offset = 0;
     std::map<int, int> lag_idx_to_petsc_idx;
 #if 1
+    std::vector<std::pair<std::uint64_t, LNode*> > sorted_nodes;
     for (PatchLevel<NDIM>::Iterator p(level); p; p++)
     {
         const Pointer<Patch<NDIM> > patch = level->getPatch(p());
         const Box<NDIM>& patch_box = patch->getBox();
         const Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
-        for (LNodeSetData::DataIterator it = idx_data->data_begin(patch_box); it != idx_data->data_end(); ++it)
+        sorted_nodes.clear();
+        if (d_sort_local_nodes)
+        {
+            // Order the local nodes on each patch along a Morton curve through
+            // the cells that contain them.  Because all LData vectors share
+            // this ordering, consecutive nodes generally touch nearby Eulerian
+            // data during spreading and interpolation.
+            IBTK_TIMER_START(t_sort_local_nodes);
+            const hier::Index<NDIM>& ghost_lower = idx_data->getGhostBox().lower();
+            for (LNodeSetData::DataIterator it = idx_data->data_begin(patch_box); it != idx_data->data_end(); ++it)
+            {
+                LNode* const node_idx = *it;
+                sorted_nodes.emplace_back(IndexUtilities::getMortonKey(it.getCellIndex(), ghost_lower), node_idx);
+            }
+            std::stable_sort(sorted_nodes.begin(),
+                             sorted_nodes.end(),
+                             [](const std::pair<std::uint64_t, LNode*>& a, const std::pair<std::uint64_t, LNode*>& b) {
+                                 return a.first < b.first;
+                             });
+            IBTK_TIMER_STOP(t_sort_local_nodes);
+        }
+        else
         {
-            LNode* const node_idx = *it;
+            for (LNodeSetData::DataIterator it = idx_data->data_begin(patch_box); it != idx_data->data_end(); ++it)
+            {
+                LNode* const node_idx = *it;
+                sorted_nodes.emplace_back(0, node_idx);
+            }
+        }
+        for (const auto& key_node_pair : sorted_nodes)
+        {
+            LNode* const node_idx = key_node_pair.second;
             const int lag_idx = node_idx->getLagrangianIndex();
             local_lag_indices.push_back(lag_idx);
             const int petsc_idx = local_offset++;
@@ -3048,6 +3207,69 @@ LDataManager::computeNodeOffsets(unsigned int& num_nodes, unsigned int& node_off
     return;
 } // computeNodeOffsets
 
+void
+LDataManager::updateNodeDistribution(const int level_number)
+{
+    IBTK_TIMER_START(t_update_node_distribution);
+
+#if !defined(NDEBUG)
+    TBOX_ASSERT(level_number >= d_coarsest_ln && level_number <= d_finest_ln);
+#endif
+
+    const std::vector<int>& local_lag_indices = d_local_lag_indices[level_number];
+    const std::vector<int>& local_petsc_indices = d_local_petsc_indices[level_number];
+    std::vector<int>& nonlocal_lag_indices = d_nonlocal_lag_indices[level_number];
+    std::vector<int>& nonlocal_petsc_indices = d_nonlocal_petsc_indices[level_number];
+    nonlocal_lag_indices.clear();
+    nonlocal_petsc_indices.clear();
+
+    // The local nodes keep their positions in the local PETSc ordering.
+    const auto num_local_nodes = static_cast<int>(local_lag_indices.size());
+    std::unordered_map<int, int> lag_idx_to_petsc_idx;
+    lag_idx_to_petsc_idx.reserve(num_local_nodes);
+    for (int k = 0; k < num_local_nodes; ++k)
+    {
+        lag_idx_to_petsc_idx[local_lag_indices[k]] = k;
+    }
+
+    // Assign local PETSc indices to the nodes in the ghost cell regions of the
+    // patches.  Nodes that are not owned by this processor are appended to the
+    // local ordering in the order in which they are encountered, as in
+    // computeNodeDistribution().  Their global PETSc indices are unchanged
+    // because the distribution on the owning processor is also unchanged.
+    int local_offset = num_local_nodes;
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_number);
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        const Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        const Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
+        const Box<NDIM>& ghost_box = idx_data->getGhostBox();
+        for (LNodeSetData::DataIterator it = idx_data->data_begin(ghost_box); it != idx_data->data_end(); ++it)
+        {
+            LNode* const node_idx = *it;
+            const int lag_idx = node_idx->getLagrangianIndex();
+            auto idx_it = lag_idx_to_petsc_idx.find(lag_idx);
+            if (idx_it == lag_idx_to_petsc_idx.end())
+            {
+#if !defined(NDEBUG)
+                TBOX_ASSERT(!patch->getBox().contains(it.getCellIndex()));
+#endif
+                nonlocal_lag_indices.push_back(lag_idx);
+                nonlocal_petsc_indices.push_back(node_idx->getGlobalPETScIndex());
+                idx_it = lag_idx_to_petsc_idx.insert(std::make_pair(lag_idx, local_offset++)).first;
+            }
+            const int local_petsc_idx = idx_it->second;
+            node_idx->setLocalPETScIndex(local_petsc_idx);
+            node_idx->setGlobalPETScIndex(local_petsc_idx < num_local_nodes ?
+                                              local_petsc_indices[local_petsc_idx] :
+                                              nonlocal_petsc_indices[local_petsc_idx - num_local_nodes]);
+        }
+    }
+
+    IBTK_TIMER_STOP(t_update_node_distribution);
+    return;
+} // updateNodeDistribution
+
 void
 LDataManager::getFromRestart()
 {
@@ -3088,6 +3310,7 @@ LDataManager::getFromRestart()
     d_lag_mesh.resize(d_finest_ln + 1);
     d_lag_mesh_data.resize(d_finest_ln + 1);
     d_needs_synch.resize(d_finest_ln + 1, false);
+    d_needs_full_redistribution.resize(d_finest_ln + 1, true);
     d_ao.resize(d_finest_ln + 1);
     d_num_nodes.resize(d_finest_ln + 1);
     d_node_offset.resize(d_finest_ln + 1);
@@ -49,9 +49,18 @@ IBTK_ENABLE_EXTRA_WARNINGS
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
 #include <ostream>
 #include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 // FORTRAN ROUTINES
@@ -1312,14 +1321,442 @@ spread_data(const int stencil_sz,
     }
 #endif
 } // spread_data
+
+// Compile-time specialized implementations of selected kernel functions.
+//
+// Each kernel class provides its stencil width and a function that, given the
+// position of a point relative to the patch data (in units of the grid
+// spacing), computes the lower index of the stencil and the corresponding 1D
+// weights.  The formulas are identical to those used by the Fortran routines.
+struct IB4Kernel
+{
+    static constexpr int width = 4;
+
+    static inline int stencil_lower(const double X_o_dx, const int ilower)
+    {
+        return NINT(X_o_dx) + ilower - 2;
+    }
+
+    static inline void weights(const double X_o_dx, const int ic_lower, const int ilower, double* const w)
+    {
+        const double r = X_o_dx - (static_cast<double>(ic_lower + 1 - ilower) + 0.5);
+        const double q = std::sqrt(1.0 + 4.0 * r * (1.0 - r));
+        w[0] = 0.125 * (3.0 - 2.0 * r - q);
+        w[1] = 0.125 * (3.0 - 2.0 * r + q);
+        w[2] = 0.125 * (1.0 + 2.0 * r + q);
+        w[3] = 0.125 * (1.0 + 2.0 * r - q);
+    }
+};
+
+// The constant K that appears in the IB_6 kernel, (59/60) * (1 - sqrt(1 -
+// 3220/3481)), rounded to the same double precision value as the expression
+// used by the Fortran routines.  Because K < 3/2, the positive root of the
+// quadratic equation for the outermost weight is always used.
+constexpr double IB6_K = 0.714075092976608;
+
+struct IB6Kernel
+{
+    static constexpr int width = 6;
+
+    static inline int stencil_lower(const double X_o_dx, const int ilower)
+    {
+        return NINT(X_o_dx) + ilower - 3;
+    }
+
+    static inline void weights(const double X_o_dx, const int ic_lower, const int ilower, double* const w)
+    {
+        constexpr double K = IB6_K;
+        const double r = 1.0 - X_o_dx + (static_cast<double>(ic_lower + 2 - ilower) + 0.5);
+        const double r2 = r * r;
+        const double r3 = r2 * r;
+        const double alpha = 28.0;
+        const double beta = (9.0 / 4.0) - (3.0 / 2.0) * (K + r2) + ((22.0 / 3.0) - 7.0 * K) * r - (7.0 / 3.0) * r3;
+        const double gamma = 0.25 * (((161.0 / 36.0) - (59.0 / 6.0) * K + 5.0 * K * K) * 0.5 * r2 +
+                                     (-(109.0 / 24.0) + 5.0 * K) * (1.0 / 3.0) * r2 * r2 + (5.0 / 18.0) * r3 * r3);
+        const double discr = beta * beta - 4.0 * alpha * gamma;
+        const double pm3 = (-beta + std::sqrt(discr)) / (2.0 * alpha);
+        w[0] = pm3;
+        w[1] = -3.0 * pm3 - (1.0 / 16.0) + (1.0 / 8.0) * (K + r2) + (1.0 / 12.0) * (3.0 * K - 1.0) * r +
+               (1.0 / 12.0) * r3;
+        w[2] = 2.0 * pm3 + (1.0 / 4.0) + (1.0 / 6.0) * (4.0 - 3.0 * K) * r - (1.0 / 6.0) * r3;
+        w[3] = 2.0 * pm3 + (5.0 / 8.0) - (1.0 / 4.0) * (K + r2);
+        w[4] = -3.0 * pm3 + (1.0 / 4.0) - (1.0 / 6.0) * (4.0 - 3.0 * K) * r + (1.0 / 6.0) * r3;
+        w[5] = pm3 - (1.0 / 16.0) + (1.0 / 8.0) * (K + r2) - (1.0 / 12.0) * (3.0 * K - 1.0) * r - (1.0 / 12.0) * r3;
+    }
+};
+
+// Number of points whose weights are computed together.  The weights for a
+// batch are computed in loops over the points in the batch, which allows the
+// compiler to vectorize the (comparatively expensive) weight evaluations.
+static const int LE_KERNEL_BATCH_SIZE = 8;
+
+template <class Kernel>
+struct KernelBatch
+{
+    int num_points;
+    std::array<int, LE_KERNEL_BATCH_SIZE> s;
+    std::array<std::array<int, LE_KERNEL_BATCH_SIZE>, NDIM> ic_lower;
+    std::array<std::array<std::array<double, Kernel::width>, LE_KERNEL_BATCH_SIZE>, NDIM> w;
+};
+
+template <class Kernel>
+inline void
+compute_kernel_batch(KernelBatch<Kernel>& batch,
+                     const int l_begin,
+                     const int l_end,
+                     const double* const X,
+                     const double* const X_shift,
+                     const int* const local_indices,
+                     const double* const x_lower,
+                     const double* const dx,
+                     const int* const ilower)
+{
+    batch.num_points = l_end - l_begin;
+    std::array<double, LE_KERNEL_BATCH_SIZE> X_o_dx;
+    for (int k = 0; k < batch.num_points; ++k) batch.s[k] = local_indices[l_begin + k];
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        for (int k = 0; k < batch.num_points; ++k)
+        {
+            X_o_dx[k] = (X[d + batch.s[k] * NDIM] + X_shift[d + (l_begin + k) * NDIM] - x_lower[d]) / dx[d];
+            batch.ic_lower[d][k] = Kernel::stencil_lower(X_o_dx[k], ilower[d]);
+        }
+        for (int k = 0; k < batch.num_points; ++k)
+        {
+            Kernel::weights(X_o_dx[k], batch.ic_lower[d][k], ilower[d], batch.w[d][k].data());
+        }
+    }
+    return;
+} // compute_kernel_batch
+
+template <class Kernel>
+void
+interpolate_template_kernel(double* const V,
+                            const double* const u,
+                            const int depth,
+                            const int* const ilower,
+                            const int* const iupper,
+                            const int* const nugc,
+                            const double* const X,
+                            const double* const X_shift,
+                            const int* const local_indices,
+                            const int num_local_indices,
+                            const double* const x_lower,
+                            const double* const dx)
+{
+    static constexpr int W = Kernel::width;
+    std::array<int, NDIM> ig_lower, ig_upper, ig_extent;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        ig_lower[d] = ilower[d] - nugc[d];
+        ig_upper[d] = iupper[d] + nugc[d];
+        ig_extent[d] = ig_upper[d] - ig_lower[d] + 1;
+    }
+#if (NDIM == 2)
+    const int depth_stride = ig_extent[0] * ig_extent[1];
+#endif
+#if (NDIM == 3)
+    const int depth_stride = ig_extent[0] * ig_extent[1] * ig_extent[2];
+#endif
+    KernelBatch<Kernel> batch;
+    std::array<int, NDIM> istart, istop;
+    for (int l_begin = 0; l_begin < num_local_indices; l_begin += LE_KERNEL_BATCH_SIZE)
+    {
+        const int l_end = std::min(l_begin + LE_KERNEL_BATCH_SIZE, num_local_indices);
+        compute_kernel_batch(batch, l_begin, l_end, X, X_shift, local_indices, x_lower, dx, ilower);
+        for (int k = 0; k < batch.num_points; ++k)
+        {
+            const int s = batch.s[k];
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                istart[d] = std::max(ig_lower[d] - batch.ic_lower[d][k], 0);
+                istop[d] = W - 1 - std::max(batch.ic_lower[d][k] + W - 1 - ig_upper[d], 0);
+            }
+            const double* const w0 = batch.w[0][k].data();
+            const double* const w1 = batch.w[1][k].data();
+#if (NDIM == 3)
+            const double* const w2 = batch.w[2][k].data();
+#endif
+            const int offset0 = batch.ic_lower[0][k] - ig_lower[0];
+            const int offset1 = batch.ic_lower[1][k] - ig_lower[1];
+#if (NDIM == 3)
+            const int offset2 = batch.ic_lower[2][k] - ig_lower[2];
+#endif
+            for (int comp = 0; comp < depth; ++comp)
+            {
+                const double* const u_comp = u + comp * depth_stride;
+                double V_comp = 0.0;
+#if (NDIM == 3)
+                for (int i2 = istart[2]; i2 <= istop[2]; ++i2)
+                {
+#endif
+                    for (int i1 = istart[1]; i1 <= istop[1]; ++i1)
+                    {
+#if (NDIM == 2)
+                        const double wy = w1[i1];
+                        const double* const u_row = u_comp + (offset1 + i1) * ig_extent[0] + offset0;
+#endif
+#if (NDIM == 3)
+                        const double wy = w1[i1] * w2[i2];
+                        const double* const u_row =
+                            u_comp + ((offset2 + i2) * ig_extent[1] + (offset1 + i1)) * ig_extent[0] + offset0;
+#endif
+                        for (int i0 = istart[0]; i0 <= istop[0]; ++i0)
+                        {
+                            V_comp += w0[i0] * wy * u_row[i0];
+                        }
+                    }
+#if (NDIM == 3)
+                }
+#endif
+                V[comp + s * depth] = V_comp;
+            }
+        }
+    }
+    return;
+} // interpolate_template_kernel
+
+template <class Kernel>
+void
+spread_template_kernel(double* const u,
+                       const int depth,
+                       const int* const ilower,
+                       const int* const iupper,
+                       const int* const nugc,
+                       const double* const V,
+                       const double* const X,
+                       const double* const X_shift,
+                       const int* const local_indices,
+                       const int num_local_indices,
+                       const double* const x_lower,
+                       const double* const dx)
+{
+    static constexpr int W = Kernel::width;
+    std::array<int, NDIM> ig_lower, ig_upper, ig_extent;
+    double fac = 1.0;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        ig_lower[d] = ilower[d] - nugc[d];
+        ig_upper[d] = iupper[d] + nugc[d];
+        ig_extent[d] = ig_upper[d] - ig_lower[d] + 1;
+        fac *= dx[d];
+    }
+    fac = 1.0 / fac;
+#if (NDIM == 2)
+    const int depth_stride = ig_extent[0] * ig_extent[1];
+#endif
+#if (NDIM == 3)
+    const int depth_stride = ig_extent[0] * ig_extent[1] * ig_extent[2];
+#endif
+    KernelBatch<Kernel> batch;
+    std::array<int, NDIM> istart, istop;
+    for (int l_begin = 0; l_begin < num_local_indices; l_begin += LE_KERNEL_BATCH_SIZE)
+    {
+        const int l_end = std::min(l_begin + LE_KERNEL_BATCH_SIZE, num_local_indices);
+        compute_kernel_batch(batch, l_begin, l_end, X, X_shift, local_indices, x_lower, dx, ilower);
+        for (int k = 0; k < batch.num_points; ++k)
+        {
+            const int s = batch.s[k];
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                istart[d] = std::max(ig_lower[d] - batch.ic_lower[d][k], 0);
+                istop[d] = W - 1 - std::max(batch.ic_lower[d][k] + W - 1 - ig_upper[d], 0);
+            }
+            const double* const w0 = batch.w[0][k].data();
+            const double* const w1 = batch.w[1][k].data();
+#if (NDIM == 3)
+            const double* const w2 = batch.w[2][k].data();
+#endif
+            const int offset0 = batch.ic_lower[0][k] - ig_lower[0];
+            const int offset1 = batch.ic_lower[1][k] - ig_lower[1];
+#if (NDIM == 3)
+            const int offset2 = batch.ic_lower[2][k] - ig_lower[2];
+#endif
+            for (int comp = 0; comp < depth; ++comp)
+            {
+                double* const u_comp = u + comp * depth_stride;
+                const double V_comp = V[comp + s * depth];
+#if (NDIM == 3)
+                for (int i2 = istart[2]; i2 <= istop[2]; ++i2)
+                {
+#endif
+                    for (int i1 = istart[1]; i1 <= istop[1]; ++i1)
+                    {
+#if (NDIM == 2)
+                        const double wy = w1[i1] * fac;
+                        double* const u_row = u_comp + (offset1 + i1) * ig_extent[0] + offset0;
+#endif
+#if (NDIM == 3)
+                        const double wy = w1[i1] * w2[i2] * fac;
+                        double* const u_row =
+                            u_comp + ((offset2 + i2) * ig_extent[1] + (offset1 + i1)) * ig_extent[0] + offset0;
+#endif
+                        for (int i0 = istart[0]; i0 <= istop[0]; ++i0)
+                        {
+                            u_row[i0] += w0[i0] * wy * V_comp;
+                        }
+                    }
+#if (NDIM == 3)
+                }
+#endif
+            }
+        }
+    }
+    return;
+} // spread_template_kernel
+
+// A pool of worker threads that persists between spreading and interpolation
+// operations, so that threads are not created and destroyed for each patch.
+// The calling thread also executes tasks, so a pool configured for n threads
+// owns n - 1 workers.
+class LEThreadPool
+{
+public:
+    LEThreadPool() = default;
+
+    LEThreadPool(const LEThreadPool&) = delete;
+
+    LEThreadPool& operator=(const LEThreadPool&) = delete;
+
+    ~LEThreadPool()
+    {
+        resize(1);
+    }
+
+    int getNumberOfThreads() const
+    {
+        return static_cast<int>(d_workers.size()) + 1;
+    }
+
+    void resize(const int num_threads)
+    {
+        if (num_threads == getNumberOfThreads()) return;
+        {
+            std::lock_guard<std::mutex> lock(d_mutex);
+            d_shutdown = true;
+        }
+        d_start_cv.notify_all();
+        for (auto& worker : d_workers) worker.join();
+        d_workers.clear();
+        d_shutdown = false;
+        d_generation = 0;
+        for (int t = 1; t < num_threads; ++t) d_workers.emplace_back([this]() { workerLoop(); });
+        return;
+    }
+
+    // Execute task(0), ..., task(num_tasks - 1) and return once all of them
+    // have completed.  Tasks are handed out dynamically, so task() must not
+    // depend on which thread executes it.
+    void run(const int num_tasks, const std::function<void(int)>& task)
+    {
+        if (d_workers.empty() || num_tasks <= 1)
+        {
+            for (int i = 0; i < num_tasks; ++i) task(i);
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(d_mutex);
+            d_task = &task;
+            d_num_tasks = num_tasks;
+            d_next_task = 0;
+            d_num_active_workers = static_cast<int>(d_workers.size());
+            ++d_generation;
+        }
+        d_start_cv.notify_all();
+        executeTasks();
+        std::unique_lock<std::mutex> lock(d_mutex);
+        d_done_cv.wait(lock, [this]() { return d_num_active_workers == 0; });
+        d_task = nullptr;
+        return;
+    }
+
+private:
+    void executeTasks()
+    {
+        for (int i = d_next_task++; i < d_num_tasks; i = d_next_task++) (*d_task)(i);
+        return;
+    }
+
+    void workerLoop()
+    {
+        unsigned long generation = 0;
+        while (true)
+        {
+            {
+                std::unique_lock<std::mutex> lock(d_mutex);
+                d_start_cv.wait(lock, [&]() { return d_shutdown || d_generation != generation; });
+                if (d_shutdown) return;
+                generation = d_generation;
+            }
+            executeTasks();
+            {
+                std::lock_guard<std::mutex> lock(d_mutex);
+                if (--d_num_active_workers == 0) d_done_cv.notify_one();
+            }
+        }
+        return;
+    }
+
+    std::vector<std::thread> d_workers;
+    std::mutex d_mutex;
+    std::condition_variable d_start_cv, d_done_cv;
+    const std::function<void(int)>* d_task = nullptr;
+    int d_num_tasks = 0;
+    std::atomic<int> d_next_task{ 0 };
+    int d_num_active_workers = 0;
+    unsigned long d_generation = 0;
+    bool d_shutdown = false;
+};
+
+LEThreadPool&
+get_thread_pool()
+{
+    static LEThreadPool thread_pool;
+    return thread_pool;
+}
 } // namespace
 
 double (*LEInteractor::s_kernel_fcn)(double r) = &ib4_kernel_fcn;
 int LEInteractor::s_kernel_fcn_stencil_size = 4;
+int LEInteractor::s_num_threads = 1;
+LEKernelImplementation LEInteractor::s_kernel_implementation = FORTRAN_LE_KERNEL;
+bool LEInteractor::s_use_interaction_plans = false;
+int LEInteractor::s_max_interaction_plans = 256;
+std::map<LEInteractor::InteractionPlanKey, LEInteractor::InteractionPlan> LEInteractor::s_interaction_plans;
+std::deque<LEInteractor::InteractionPlanKey> LEInteractor::s_interaction_plan_keys;
+int LEInteractor::s_num_interaction_plan_builds = 0;
+const LData* LEInteractor::s_interaction_plan_X_data = nullptr;
 
-void LEInteractor::setFromDatabase(Pointer<Database> /*db*/)
+void
+LEInteractor::setFromDatabase(Pointer<Database> db)
 {
-    // intentionally blank
+    if (!db) return;
+    if (db->keyExists("num_threads")) s_num_threads = db->getInteger("num_threads");
+    if (s_num_threads < 1)
+    {
+        TBOX_ERROR("LEInteractor::setFromDatabase():\n"
+                   << "  num_threads must be positive, but num_threads = " << s_num_threads << "\n");
+    }
+    get_thread_pool().resize(s_num_threads);
+    if (db->keyExists("kernel_implementation"))
+    {
+        s_kernel_implementation = string_to_enum<LEKernelImplementation>(db->getString("kernel_implementation"));
+    }
+    if (s_kernel_implementation != FORTRAN_LE_KERNEL && s_kernel_implementation != TEMPLATE_LE_KERNEL)
+    {
+        TBOX_ERROR("LEInteractor::setFromDatabase():\n"
+                   << "  unknown kernel_implementation " << db->getString("kernel_implementation") << "\n"
+                   << "  valid choices are: FORTRAN, TEMPLATE\n");
+    }
+    if (db->keyExists("use_interaction_plans")) s_use_interaction_plans = db->getBool("use_interaction_plans");
+    if (db->keyExists("max_interaction_plans")) s_max_interaction_plans = db->getInteger("max_interaction_plans");
+    if (s_max_interaction_plans < 1)
+    {
+        TBOX_ERROR("LEInteractor::setFromDatabase():\n"
+                   << "  max_interaction_plans must be positive, but max_interaction_plans = "
+                   << s_max_interaction_plans << "\n");
+    }
+    if (!s_use_interaction_plans) clearInteractionPlans();
     return;
 }
 
@@ -1327,9 +1764,27 @@ void
 LEInteractor::printClassData(std::ostream& os)
 {
     os << "LEInteractor::printClassData():\n";
+    os << "  num_threads = " << s_num_threads << "\n";
+    os << "  kernel_implementation = " << enum_to_string<LEKernelImplementation>(s_kernel_implementation) << "\n";
+    os << "  use_interaction_plans = " << (s_use_interaction_plans ? "TRUE" : "FALSE") << "\n";
+    os << "  max_interaction_plans = " << s_max_interaction_plans << "\n";
     return;
 }
 
+void
+LEInteractor::clearInteractionPlans()
+{
+    s_interaction_plans.clear();
+    s_interaction_plan_keys.clear();
+    return;
+}
+
+int
+LEInteractor::getNumberOfInteractionPlanBuilds()
+{
+    return s_num_interaction_plan_builds;
+}
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 int
@@ -1380,6 +1835,7 @@ LEInteractor::interpolate(Pointer<LData> Q_data,
     TBOX_ASSERT(Q_data->getDepth() == static_cast<unsigned int>(q_data->getDepth()));
     TBOX_ASSERT(X_data->getDepth() == NDIM);
 #endif
+    s_interaction_plan_X_data = X_data.getPointer();
     interpolate(Q_data->getGhostedLocalFormVecArray()->data(),
                 Q_data->getDepth(),
                 X_data->getGhostedLocalFormVecArray()->data(),
@@ -1390,6 +1846,7 @@ LEInteractor::interpolate(Pointer<LData> Q_data,
                 interp_box,
                 periodic_shift,
                 interp_fcn);
+    s_interaction_plan_X_data = nullptr;
     Q_data->restoreArrays();
     X_data->restoreArrays();
     return;
@@ -1415,6 +1872,7 @@ LEInteractor::interpolate(Pointer<LData> Q_data,
     TBOX_ASSERT(Q_data->getDepth() == static_cast<unsigned int>(q_data->getDepth()));
     TBOX_ASSERT(X_data->getDepth() == NDIM);
 #endif
+    s_interaction_plan_X_data = X_data.getPointer();
     interpolate(Q_data->getGhostedLocalFormVecArray()->data(),
                 Q_data->getDepth(),
                 X_data->getGhostedLocalFormVecArray()->data(),
@@ -1425,6 +1883,7 @@ LEInteractor::interpolate(Pointer<LData> Q_data,
                 interp_box,
                 periodic_shift,
                 interp_fcn);
+    s_interaction_plan_X_data = nullptr;
     Q_data->restoreArrays();
     X_data->restoreArrays();
     return;
@@ -1456,6 +1915,7 @@ LEInteractor::interpolate(Pointer<LData> Q_data,
     TBOX_ASSERT(X_data->getDepth() == NDIM);
     TBOX_ASSERT(q_data->getDepth() == 1);
 #endif
+    s_interaction_plan_X_data = X_data.getPointer();
     interpolate(Q_data->getGhostedLocalFormVecArray()->data(),
                 Q_data->getDepth(),
                 X_data->getGhostedLocalFormVecArray()->data(),
@@ -1466,6 +1926,7 @@ LEInteractor::interpolate(Pointer<LData> Q_data,
                 interp_box,
                 periodic_shift,
                 interp_fcn);
+    s_interaction_plan_X_data = nullptr;
     Q_data->restoreArrays();
     X_data->restoreArrays();
     return;
@@ -1497,6 +1958,7 @@ LEInteractor::interpolate(Pointer<LData> Q_data,
     TBOX_ASSERT(X_data->getDepth() == NDIM);
     TBOX_ASSERT(q_data->getDepth() == 1);
 #endif
+    s_interaction_plan_X_data = X_data.getPointer();
     interpolate(Q_data->getGhostedLocalFormVecArray()->data(),
                 Q_data->getDepth(),
                 X_data->getGhostedLocalFormVecArray()->data(),
@@ -1507,6 +1969,7 @@ LEInteractor::interpolate(Pointer<LData> Q_data,
                 interp_box,
                 periodic_shift,
                 interp_fcn);
+    s_interaction_plan_X_data = nullptr;
     Q_data->restoreArrays();
     X_data->restoreArrays();
     return;
@@ -2544,6 +3007,7 @@ LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
     TBOX_ASSERT(Q_data->getDepth() == static_cast<unsigned int>(q_data->getDepth()));
     TBOX_ASSERT(X_data->getDepth() == NDIM);
 #endif
+    s_interaction_plan_X_data = X_data.getPointer();
     spread(q_data,
            Q_data->getGhostedLocalFormVecArray()->data(),
            Q_data->getDepth(),
@@ -2554,6 +3018,7 @@ LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
            spread_box,
            periodic_shift,
            spread_fcn);
+    s_interaction_plan_X_data = nullptr;
     Q_data->restoreArrays();
     X_data->restoreArrays();
     return;
@@ -2579,6 +3044,7 @@ LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
     TBOX_ASSERT(Q_data->getDepth() == static_cast<unsigned int>(q_data->getDepth()));
     TBOX_ASSERT(X_data->getDepth() == NDIM);
 #endif
+    s_interaction_plan_X_data = X_data.getPointer();
     spread(q_data,
            Q_data->getGhostedLocalFormVecArray()->data(),
            Q_data->getDepth(),
@@ -2589,6 +3055,7 @@ LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
            spread_box,
            periodic_shift,
            spread_fcn);
+    s_interaction_plan_X_data = nullptr;
     Q_data->restoreArrays();
     X_data->restoreArrays();
     return;
@@ -2620,6 +3087,7 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
     TBOX_ASSERT(Q_data->getDepth() == NDIM);
     TBOX_ASSERT(X_data->getDepth() == NDIM);
 #endif
+    s_interaction_plan_X_data = X_data.getPointer();
     spread(q_data,
            Q_data->getGhostedLocalFormVecArray()->data(),
            Q_data->getDepth(),
@@ -2630,6 +3098,7 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
            spread_box,
            periodic_shift,
            spread_fcn);
+    s_interaction_plan_X_data = nullptr;
     Q_data->restoreArrays();
     X_data->restoreArrays();
     return;
@@ -2661,6 +3130,7 @@ LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
     TBOX_ASSERT(Q_data->getDepth() == NDIM);
     TBOX_ASSERT(X_data->getDepth() == NDIM);
 #endif
+    s_interaction_plan_X_data = X_data.getPointer();
     spread(q_data,
            Q_data->getGhostedLocalFormVecArray()->data(),
            Q_data->getDepth(),
@@ -2671,6 +3141,7 @@ LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
            spread_box,
            periodic_shift,
            spread_fcn);
+    s_interaction_plan_X_data = nullptr;
     Q_data->restoreArrays();
     X_data->restoreArrays();
     return;
@@ -3681,6 +4152,28 @@ LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+LEInteractor::KernelFunction
+LEInteractor::getKernelFunction(const std::string& kernel_fcn)
+{
+    if (kernel_fcn == "PIECEWISE_CONSTANT") return PIECEWISE_CONSTANT_KERNEL;
+    if (kernel_fcn == "DISCONTINUOUS_LINEAR") return DISCONTINUOUS_LINEAR_KERNEL;
+    if (kernel_fcn == "PIECEWISE_LINEAR") return PIECEWISE_LINEAR_KERNEL;
+    if (kernel_fcn == "PIECEWISE_CUBIC") return PIECEWISE_CUBIC_KERNEL;
+    if (kernel_fcn == "IB_3") return IB_3_KERNEL;
+    if (kernel_fcn == "IB_4") return IB_4_KERNEL;
+    if (kernel_fcn == "IB_4_W8") return IB_4_W8_KERNEL;
+    if (kernel_fcn == "IB_5") return IB_5_KERNEL;
+    if (kernel_fcn == "IB_6") return IB_6_KERNEL;
+    if (kernel_fcn == "BSPLINE_3") return BSPLINE_3_KERNEL;
+    if (kernel_fcn == "BSPLINE_4") return BSPLINE_4_KERNEL;
+    if (kernel_fcn == "BSPLINE_5") return BSPLINE_5_KERNEL;
+    if (kernel_fcn == "BSPLINE_6") return BSPLINE_6_KERNEL;
+    if (kernel_fcn == "USER_DEFINED") return USER_DEFINED_KERNEL;
+    TBOX_ERROR("LEInteractor::getKernelFunction()\n"
+               << "  Unknown kernel function " << kernel_fcn << std::endl);
+    return USER_DEFINED_KERNEL;
+} // getKernelFunction
+
 void
 LEInteractor::interpolate(double* const Q_data,
                           const int Q_depth,
@@ -3711,10 +4204,130 @@ LEInteractor::interpolate(double* const Q_data,
                    << "  ghost cell width         = " << q_gcw_min << "\n");
     }
     if (local_indices.empty()) return;
+    if (s_use_interaction_plans && s_interaction_plan_X_data)
+    {
+        const InteractionPlan& plan = getInteractionPlan(
+            X_data, q_data_box, q_gcw, x_lower, x_upper, dx, local_indices, periodic_shifts, interp_fcn, axis);
+        const int num_local_indices = static_cast<int>(local_indices.size());
+        for (int l = 0; l < num_local_indices; ++l)
+        {
+            const int s = local_indices[l];
+            for (int comp = 0; comp < q_depth; ++comp)
+            {
+                const double* const q_comp = q_data + comp * plan.depth_stride;
+                double Q = 0.0;
+                for (int k = plan.point_ptr[l]; k < plan.point_ptr[l + 1]; ++k)
+                {
+                    Q += plan.weights[k] * q_comp[plan.cell_offsets[k]];
+                }
+                Q_data[comp + s * q_depth] = Q;
+            }
+        }
+        return;
+    }
+    const KernelFunction interp_kernel = getKernelFunction(interp_fcn);
     const int local_indices_size = static_cast<int>(local_indices.size());
+    if (s_num_threads <= 1)
+    {
+        interpolateKernel(Q_data,
+                          Q_depth,
+                          X_data,
+                          q_data,
+                          q_data_box,
+                          q_gcw,
+                          q_depth,
+                          x_lower,
+                          x_upper,
+                          dx,
+                          local_indices.data(),
+                          periodic_shifts.data(),
+                          local_indices_size,
+                          interp_kernel,
+                          axis);
+        return;
+    }
+
+    // Each Lagrangian point only writes to its own entries of Q_data, so the
+    // list of points can be split into contiguous chunks that are processed
+    // concurrently without any synchronization.
+    const int num_chunks = std::min(s_num_threads, local_indices_size);
+    get_thread_pool().run(num_chunks, [&](const int chunk) {
+        const int l_begin = (chunk * local_indices_size) / num_chunks;
+        const int l_end = ((chunk + 1) * local_indices_size) / num_chunks;
+        interpolateKernel(Q_data,
+                          Q_depth,
+                          X_data,
+                          q_data,
+                          q_data_box,
+                          q_gcw,
+                          q_depth,
+                          x_lower,
+                          x_upper,
+                          dx,
+                          &local_indices[l_begin],
+                          &periodic_shifts[NDIM * l_begin],
+                          l_end - l_begin,
+                          interp_kernel,
+                          axis);
+    });
+    return;
+}
+
+void
+LEInteractor::interpolateKernel(double* const Q_data,
+                                const int Q_depth,
+                                const double* const X_data,
+                                const double* const q_data,
+                                const Box<NDIM>& q_data_box,
+                                const IntVector<NDIM>& q_gcw,
+                                const int q_depth,
+                                const double* const x_lower,
+                                const double* const x_upper,
+                                const double* const dx,
+                                const int* const local_indices,
+                                const double* const periodic_shifts,
+                                const int num_local_indices,
+                                const KernelFunction interp_kernel,
+                                const int axis)
+{
     const IntVector<NDIM>& ilower = q_data_box.lower();
     const IntVector<NDIM>& iupper = q_data_box.upper();
-    if (interp_fcn == "PIECEWISE_CONSTANT")
+    if (s_kernel_implementation == TEMPLATE_LE_KERNEL)
+    {
+        if (interp_kernel == IB_4_KERNEL)
+        {
+            interpolate_template_kernel<IB4Kernel>(Q_data,
+                                                   q_data,
+                                                   q_depth,
+                                                   ilower,
+                                                   iupper,
+                                                   q_gcw,
+                                                   X_data,
+                                                   periodic_shifts,
+                                                   local_indices,
+                                                   num_local_indices,
+                                                   x_lower,
+                                                   dx);
+            return;
+        }
+        if (interp_kernel == IB_6_KERNEL)
+        {
+            interpolate_template_kernel<IB6Kernel>(Q_data,
+                                                   q_data,
+                                                   q_depth,
+                                                   ilower,
+                                                   iupper,
+                                                   q_gcw,
+                                                   X_data,
+                                                   periodic_shifts,
+                                                   local_indices,
+                                                   num_local_indices,
+                                                   x_lower,
+                                                   dx);
+            return;
+        }
+    }
+    if (interp_kernel == PIECEWISE_CONSTANT_KERNEL)
     {
         LAGRANGIAN_PIECEWISE_CONSTANT_INTERP_FC(dx,
                                                 x_lower,
@@ -3740,13 +4353,13 @@ LEInteractor::interpolate(double* const Q_data,
                                                 q_gcw(2),
 #endif
                                                 q_data,
-                                                &local_indices[0],
-                                                &periodic_shifts[0],
-                                                local_indices_size,
+                                                local_indices,
+                                                periodic_shifts,
+                                                num_local_indices,
                                                 X_data,
                                                 Q_data);
     }
-    else if (interp_fcn == "DISCONTINUOUS_LINEAR")
+    else if (interp_kernel == DISCONTINUOUS_LINEAR_KERNEL)
     {
         LAGRANGIAN_DISCONTINUOUS_LINEAR_INTERP_FC(dx,
                                                   x_lower,
@@ -3773,13 +4386,13 @@ LEInteractor::interpolate(double* const Q_data,
                                                   q_gcw(2),
 #endif
                                                   q_data,
-                                                  &local_indices[0],
-                                                  &periodic_shifts[0],
-                                                  local_indices_size,
+                                                  local_indices,
+                                                  periodic_shifts,
+                                                  num_local_indices,
                                                   X_data,
                                                   Q_data);
     }
-    else if (interp_fcn == "PIECEWISE_LINEAR")
+    else if (interp_kernel == PIECEWISE_LINEAR_KERNEL)
     {
         LAGRANGIAN_PIECEWISE_LINEAR_INTERP_FC(dx,
                                               x_lower,
@@ -3805,13 +4418,13 @@ LEInteractor::interpolate(double* const Q_data,
                                               q_gcw(2),
 #endif
                                               q_data,
-                                              &local_indices[0],
-                                              &periodic_shifts[0],
-                                              local_indices_size,
+                                              local_indices,
+                                              periodic_shifts,
+                                              num_local_indices,
                                               X_data,
                                               Q_data);
     }
-    else if (interp_fcn == "PIECEWISE_CUBIC")
+    else if (interp_kernel == PIECEWISE_CUBIC_KERNEL)
     {
         LAGRANGIAN_PIECEWISE_CUBIC_INTERP_FC(dx,
                                              x_lower,
@@ -3837,13 +4450,13 @@ LEInteractor::interpolate(double* const Q_data,
                                              q_gcw(2),
 #endif
                                              q_data,
-                                             &local_indices[0],
-                                             &periodic_shifts[0],
-                                             local_indices_size,
+                                             local_indices,
+                                             periodic_shifts,
+                                             num_local_indices,
                                              X_data,
                                              Q_data);
     }
-    else if (interp_fcn == "IB_3")
+    else if (interp_kernel == IB_3_KERNEL)
     {
         LAGRANGIAN_IB_3_INTERP_FC(dx,
                                   x_lower,
@@ -3869,13 +4482,13 @@ LEInteractor::interpolate(double* const Q_data,
                                   q_gcw(2),
 #endif
                                   q_data,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
+                                  local_indices,
+                                  periodic_shifts,
+                                  num_local_indices,
                                   X_data,
                                   Q_data);
     }
-    else if (interp_fcn == "IB_4")
+    else if (interp_kernel == IB_4_KERNEL)
     {
         LAGRANGIAN_IB_4_INTERP_FC(dx,
                                   x_lower,
@@ -3901,13 +4514,13 @@ LEInteractor::interpolate(double* const Q_data,
                                   q_gcw(2),
 #endif
                                   q_data,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
+                                  local_indices,
+                                  periodic_shifts,
+                                  num_local_indices,
                                   X_data,
                                   Q_data);
     }
-    else if (interp_fcn == "IB_4_W8")
+    else if (interp_kernel == IB_4_W8_KERNEL)
     {
         LAGRANGIAN_IB_4_W8_INTERP_FC(dx,
                                      x_lower,
@@ -3933,13 +4546,13 @@ LEInteractor::interpolate(double* const Q_data,
                                      q_gcw(2),
 #endif
                                      q_data,
-                                     &local_indices[0],
-                                     &periodic_shifts[0],
-                                     local_indices_size,
+                                     local_indices,
+                                     periodic_shifts,
+                                     num_local_indices,
                                      X_data,
                                      Q_data);
     }
-    else if (interp_fcn == "IB_5")
+    else if (interp_kernel == IB_5_KERNEL)
     {
         LAGRANGIAN_IB_5_INTERP_FC(dx,
                                   x_lower,
@@ -3965,13 +4578,13 @@ LEInteractor::interpolate(double* const Q_data,
                                   q_gcw(2),
 #endif
                                   q_data,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
+                                  local_indices,
+                                  periodic_shifts,
+                                  num_local_indices,
                                   X_data,
                                   Q_data);
     }
-    else if (interp_fcn == "IB_6")
+    else if (interp_kernel == IB_6_KERNEL)
     {
         LAGRANGIAN_IB_6_INTERP_FC(dx,
                                   x_lower,
@@ -3997,13 +4610,13 @@ LEInteractor::interpolate(double* const Q_data,
                                   q_gcw(2),
 #endif
                                   q_data,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
+                                  local_indices,
+                                  periodic_shifts,
+                                  num_local_indices,
                                   X_data,
                                   Q_data);
     }
-    else if (interp_fcn == "BSPLINE_3")
+    else if (interp_kernel == BSPLINE_3_KERNEL)
     {
         LAGRANGIAN_BSPLINE_3_INTERP_FC(dx,
                                        x_lower,
@@ -4029,13 +4642,13 @@ LEInteractor::interpolate(double* const Q_data,
                                        q_gcw(2),
 #endif
                                        q_data,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
+                                       local_indices,
+                                       periodic_shifts,
+                                       num_local_indices,
                                        X_data,
                                        Q_data);
     }
-    else if (interp_fcn == "BSPLINE_4")
+    else if (interp_kernel == BSPLINE_4_KERNEL)
     {
         LAGRANGIAN_BSPLINE_4_INTERP_FC(dx,
                                        x_lower,
@@ -4061,13 +4674,13 @@ LEInteractor::interpolate(double* const Q_data,
                                        q_gcw(2),
 #endif
                                        q_data,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
+                                       local_indices,
+                                       periodic_shifts,
+                                       num_local_indices,
                                        X_data,
                                        Q_data);
     }
-    else if (interp_fcn == "BSPLINE_5")
+    else if (interp_kernel == BSPLINE_5_KERNEL)
     {
         LAGRANGIAN_BSPLINE_5_INTERP_FC(dx,
                                        x_lower,
@@ -4093,13 +4706,13 @@ LEInteractor::interpolate(double* const Q_data,
                                        q_gcw(2),
 #endif
                                        q_data,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
+                                       local_indices,
+                                       periodic_shifts,
+                                       num_local_indices,
                                        X_data,
                                        Q_data);
     }
-    else if (interp_fcn == "BSPLINE_6")
+    else if (interp_kernel == BSPLINE_6_KERNEL)
     {
         LAGRANGIAN_BSPLINE_6_INTERP_FC(dx,
                                        x_lower,
@@ -4125,13 +4738,13 @@ LEInteractor::interpolate(double* const Q_data,
                                        q_gcw(2),
 #endif
                                        q_data,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
+                                       local_indices,
+                                       periodic_shifts,
+                                       num_local_indices,
                                        X_data,
                                        Q_data);
     }
-    else if (interp_fcn == "USER_DEFINED")
+    else if (interp_kernel == USER_DEFINED_KERNEL)
     {
         userDefinedInterpolate(Q_data,
                                Q_depth,
@@ -4143,14 +4756,9 @@ LEInteractor::interpolate(double* const Q_data,
                                x_lower,
                                x_upper,
                                dx,
-                               &local_indices[0],
-                               &periodic_shifts[0],
-                               local_indices_size);
-    }
-    else
-    {
-        TBOX_ERROR("LEInteractor::interpolate()\n"
-                   << "  Unknown interpolation kernel function " << interp_fcn << std::endl);
+                               local_indices,
+                               periodic_shifts,
+                               num_local_indices);
     }
     return;
 }
@@ -4191,18 +4799,188 @@ LEInteractor::spread(double* const q_data,
                    << "  ghost cell width         = " << q_gcw_min << "\n");
     }
     if (local_indices.empty()) return;
+    if (s_use_interaction_plans && s_interaction_plan_X_data)
+    {
+        const InteractionPlan& plan = getInteractionPlan(
+            X_data, q_data_box, q_gcw, x_lower, x_upper, dx, local_indices, periodic_shifts, spread_fcn, axis);
+        double cell_volume = 1.0;
+        for (unsigned int d = 0; d < NDIM; ++d) cell_volume *= dx[d];
+        const int num_local_indices = static_cast<int>(local_indices.size());
+        for (int l = 0; l < num_local_indices; ++l)
+        {
+            const int s = local_indices[l];
+            for (int comp = 0; comp < q_depth; ++comp)
+            {
+                double* const q_comp = q_data + comp * plan.depth_stride;
+                const double Q = Q_data[comp + s * q_depth] / cell_volume;
+                for (int k = plan.point_ptr[l]; k < plan.point_ptr[l + 1]; ++k)
+                {
+                    q_comp[plan.cell_offsets[k]] += plan.weights[k] * Q;
+                }
+            }
+        }
+        return;
+    }
+    const KernelFunction spread_kernel = getKernelFunction(spread_fcn);
     const int local_indices_size = static_cast<int>(local_indices.size());
+    if (s_num_threads <= 1)
+    {
+        spreadKernel(q_data,
+                     q_data_box,
+                     q_gcw,
+                     q_depth,
+                     Q_data,
+                     Q_depth,
+                     X_data,
+                     x_lower,
+                     x_upper,
+                     dx,
+                     local_indices.data(),
+                     periodic_shifts.data(),
+                     local_indices_size,
+                     spread_kernel,
+                     axis);
+        return;
+    }
+
+    // Partition the Lagrangian points into tiles of tile_width x tile_width
+    // (x tile_width) cells and color the tiles by the parity of their tile
+    // indices.  Because a kernel footprint extends at most stencil_size / 2 + 1
+    // cells past the cell containing the point, tiles with the same color are
+    // separated by enough cells that their footprints can never overlap, and
+    // all tiles of a given color can be spread concurrently.
+    //
+    // Colors are processed in a fixed order and points within a tile are
+    // processed in their original order.  Each grid value therefore receives
+    // its contributions in the same order regardless of how tiles are
+    // assigned to threads, so that the result is reproducible.
+    static const int num_colors = 1 << NDIM;
+    const int tile_width = stencil_size + 2;
+    std::vector<std::pair<std::array<int, NDIM + 1>, int> > tile_keys(local_indices_size);
+    for (int l = 0; l < local_indices_size; ++l)
+    {
+        const int s = local_indices[l];
+        std::array<int, NDIM + 1>& key = tile_keys[l].first;
+        key[0] = 0;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const double X_o_dx = (X_data[d + s * NDIM] + periodic_shifts[d + l * NDIM] - x_lower[d]) / dx[d];
+            key[d + 1] = static_cast<int>(std::floor(X_o_dx / static_cast<double>(tile_width)));
+            key[0] += (key[d + 1] & 1) << d;
+        }
+        tile_keys[l].second = l;
+    }
+    std::sort(tile_keys.begin(), tile_keys.end());
+
+    std::vector<int> tiled_local_indices(local_indices_size);
+    std::vector<double> tiled_periodic_shifts(NDIM * local_indices_size);
+    std::array<std::vector<std::pair<int, int> >, num_colors> color_tiles;
+    for (int k = 0; k < local_indices_size; ++k)
+    {
+        const int l = tile_keys[k].second;
+        tiled_local_indices[k] = local_indices[l];
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            tiled_periodic_shifts[d + k * NDIM] = periodic_shifts[d + l * NDIM];
+        }
+        if (k == 0 || tile_keys[k].first != tile_keys[k - 1].first)
+        {
+            color_tiles[tile_keys[k].first[0]].push_back(std::make_pair(k, k + 1));
+        }
+        else
+        {
+            color_tiles[tile_keys[k].first[0]].back().second = k + 1;
+        }
+    }
+
+    for (const auto& tiles : color_tiles)
+    {
+        get_thread_pool().run(static_cast<int>(tiles.size()), [&](const int tile) {
+            const int k_begin = tiles[tile].first;
+            const int k_end = tiles[tile].second;
+            spreadKernel(q_data,
+                         q_data_box,
+                         q_gcw,
+                         q_depth,
+                         Q_data,
+                         Q_depth,
+                         X_data,
+                         x_lower,
+                         x_upper,
+                         dx,
+                         &tiled_local_indices[k_begin],
+                         &tiled_periodic_shifts[NDIM * k_begin],
+                         k_end - k_begin,
+                         spread_kernel,
+                         axis);
+        });
+    }
+    return;
+}
+
+void
+LEInteractor::spreadKernel(double* const q_data,
+                           const Box<NDIM>& q_data_box,
+                           const IntVector<NDIM>& q_gcw,
+                           const int q_depth,
+                           const double* const Q_data,
+                           const int Q_depth,
+                           const double* const X_data,
+                           const double* const x_lower,
+                           const double* const x_upper,
+                           const double* const dx,
+                           const int* const local_indices,
+                           const double* const periodic_shifts,
+                           const int num_local_indices,
+                           const KernelFunction spread_kernel,
+                           const int axis)
+{
     const IntVector<NDIM>& ilower = q_data_box.lower();
     const IntVector<NDIM>& iupper = q_data_box.upper();
-    if (spread_fcn == "PIECEWISE_CONSTANT")
+    if (s_kernel_implementation == TEMPLATE_LE_KERNEL)
+    {
+        if (spread_kernel == IB_4_KERNEL)
+        {
+            spread_template_kernel<IB4Kernel>(q_data,
+                                              q_depth,
+                                              ilower,
+                                              iupper,
+                                              q_gcw,
+                                              Q_data,
+                                              X_data,
+                                              periodic_shifts,
+                                              local_indices,
+                                              num_local_indices,
+                                              x_lower,
+                                              dx);
+            return;
+        }
+        if (spread_kernel == IB_6_KERNEL)
+        {
+            spread_template_kernel<IB6Kernel>(q_data,
+                                              q_depth,
+                                              ilower,
+                                              iupper,
+                                              q_gcw,
+                                              Q_data,
+                                              X_data,
+                                              periodic_shifts,
+                                              local_indices,
+                                              num_local_indices,
+                                              x_lower,
+                                              dx);
+            return;
+        }
+    }
+    if (spread_kernel == PIECEWISE_CONSTANT_KERNEL)
     {
         LAGRANGIAN_PIECEWISE_CONSTANT_SPREAD_FC(dx,
                                                 x_lower,
                                                 x_upper,
                                                 q_depth,
-                                                &local_indices[0],
-                                                &periodic_shifts[0],
-                                                local_indices_size,
+                                                local_indices,
+                                                periodic_shifts,
+                                                num_local_indices,
                                                 X_data,
                                                 Q_data,
 #if (NDIM == 2)
@@ -4226,16 +5004,16 @@ LEInteractor::spread(double* const q_data,
 #endif
                                                 q_data);
     }
-    else if (spread_fcn == "DISCONTINUOUS_LINEAR")
+    else if (spread_kernel == DISCONTINUOUS_LINEAR_KERNEL)
     {
         LAGRANGIAN_DISCONTINUOUS_LINEAR_SPREAD_FC(dx,
                                                   x_lower,
                                                   x_upper,
                                                   q_depth,
                                                   axis,
-                                                  &local_indices[0],
-                                                  &periodic_shifts[0],
-                                                  local_indices_size,
+                                                  local_indices,
+                                                  periodic_shifts,
+                                                  num_local_indices,
                                                   X_data,
                                                   Q_data,
 #if (NDIM == 2)
@@ -4259,15 +5037,15 @@ LEInteractor::spread(double* const q_data,
 #endif
                                                   q_data);
     }
-    else if (spread_fcn == "PIECEWISE_LINEAR")
+    else if (spread_kernel == PIECEWISE_LINEAR_KERNEL)
     {
         LAGRANGIAN_PIECEWISE_LINEAR_SPREAD_FC(dx,
                                               x_lower,
                                               x_upper,
                                               q_depth,
-                                              &local_indices[0],
-                                              &periodic_shifts[0],
-                                              local_indices_size,
+                                              local_indices,
+                                              periodic_shifts,
+                                              num_local_indices,
                                               X_data,
                                               Q_data,
 #if (NDIM == 2)
@@ -4291,15 +5069,15 @@ LEInteractor::spread(double* const q_data,
 #endif
                                               q_data);
     }
-    else if (spread_fcn == "PIECEWISE_CUBIC")
+    else if (spread_kernel == PIECEWISE_CUBIC_KERNEL)
     {
         LAGRANGIAN_PIECEWISE_CUBIC_SPREAD_FC(dx,
                                              x_lower,
                                              x_upper,
                                              q_depth,
-                                             &local_indices[0],
-                                             &periodic_shifts[0],
-                                             local_indices_size,
+                                             local_indices,
+                                             periodic_shifts,
+                                             num_local_indices,
                                              X_data,
                                              Q_data,
 #if (NDIM == 2)
@@ -4323,15 +5101,15 @@ LEInteractor::spread(double* const q_data,
 #endif
                                              q_data);
     }
-    else if (spread_fcn == "IB_3")
+    else if (spread_kernel == IB_3_KERNEL)
     {
         LAGRANGIAN_IB_3_SPREAD_FC(dx,
                                   x_lower,
                                   x_upper,
                                   q_depth,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
+                                  local_indices,
+                                  periodic_shifts,
+                                  num_local_indices,
                                   X_data,
                                   Q_data,
 #if (NDIM == 2)
@@ -4355,15 +5133,15 @@ LEInteractor::spread(double* const q_data,
 #endif
                                   q_data);
     }
-    else if (spread_fcn == "IB_4")
+    else if (spread_kernel == IB_4_KERNEL)
     {
         LAGRANGIAN_IB_4_SPREAD_FC(dx,
                                   x_lower,
                                   x_upper,
                                   q_depth,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
+                                  local_indices,
+                                  periodic_shifts,
+                                  num_local_indices,
                                   X_data,
                                   Q_data,
 #if (NDIM == 2)
@@ -4387,15 +5165,15 @@ LEInteractor::spread(double* const q_data,
 #endif
                                   q_data);
     }
-    else if (spread_fcn == "IB_4_W8")
+    else if (spread_kernel == IB_4_W8_KERNEL)
     {
         LAGRANGIAN_IB_4_W8_SPREAD_FC(dx,
                                      x_lower,
                                      x_upper,
                                      q_depth,
-                                     &local_indices[0],
-                                     &periodic_shifts[0],
-                                     local_indices_size,
+                                     local_indices,
+                                     periodic_shifts,
+                                     num_local_indices,
                                      X_data,
                                      Q_data,
 #if (NDIM == 2)
@@ -4419,15 +5197,15 @@ LEInteractor::spread(double* const q_data,
 #endif
                                      q_data);
     }
-    else if (spread_fcn == "IB_5")
+    else if (spread_kernel == IB_5_KERNEL)
     {
         LAGRANGIAN_IB_5_SPREAD_FC(dx,
                                   x_lower,
                                   x_upper,
                                   q_depth,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
+                                  local_indices,
+                                  periodic_shifts,
+                                  num_local_indices,
                                   X_data,
                                   Q_data,
 #if (NDIM == 2)
@@ -4451,15 +5229,15 @@ LEInteractor::spread(double* const q_data,
 #endif
                                   q_data);
     }
-    else if (spread_fcn == "IB_6")
+    else if (spread_kernel == IB_6_KERNEL)
     {
         LAGRANGIAN_IB_6_SPREAD_FC(dx,
                                   x_lower,
                                   x_upper,
                                   q_depth,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
+                                  local_indices,
+                                  periodic_shifts,
+                                  num_local_indices,
                                   X_data,
                                   Q_data,
 #if (NDIM == 2)
@@ -4483,15 +5261,15 @@ LEInteractor::spread(double* const q_data,
 #endif
                                   q_data);
     }
-    else if (spread_fcn == "BSPLINE_3")
+    else if (spread_kernel == BSPLINE_3_KERNEL)
     {
         LAGRANGIAN_BSPLINE_3_SPREAD_FC(dx,
                                        x_lower,
                                        x_upper,
                                        q_depth,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
+                                       local_indices,
+                                       periodic_shifts,
+                                       num_local_indices,
                                        X_data,
                                        Q_data,
 #if (NDIM == 2)
@@ -4515,15 +5293,15 @@ LEInteractor::spread(double* const q_data,
 #endif
                                        q_data);
     }
-    else if (spread_fcn == "BSPLINE_4")
+    else if (spread_kernel == BSPLINE_4_KERNEL)
     {
         LAGRANGIAN_BSPLINE_4_SPREAD_FC(dx,
                                        x_lower,
                                        x_upper,
                                        q_depth,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
+                                       local_indices,
+                                       periodic_shifts,
+                                       num_local_indices,
                                        X_data,
                                        Q_data,
 #if (NDIM == 2)
@@ -4547,15 +5325,15 @@ LEInteractor::spread(double* const q_data,
 #endif
                                        q_data);
     }
-    else if (spread_fcn == "BSPLINE_5")
+    else if (spread_kernel == BSPLINE_5_KERNEL)
     {
         LAGRANGIAN_BSPLINE_5_SPREAD_FC(dx,
                                        x_lower,
                                        x_upper,
                                        q_depth,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
+                                       local_indices,
+                                       periodic_shifts,
+                                       num_local_indices,
                                        X_data,
                                        Q_data,
 #if (NDIM == 2)
@@ -4579,15 +5357,15 @@ LEInteractor::spread(double* const q_data,
 #endif
                                        q_data);
     }
-    else if (spread_fcn == "BSPLINE_6")
+    else if (spread_kernel == BSPLINE_6_KERNEL)
     {
         LAGRANGIAN_BSPLINE_6_SPREAD_FC(dx,
                                        x_lower,
                                        x_upper,
                                        q_depth,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
+                                       local_indices,
+                                       periodic_shifts,
+                                       num_local_indices,
                                        X_data,
                                        Q_data,
 #if (NDIM == 2)
@@ -4611,7 +5389,7 @@ LEInteractor::spread(double* const q_data,
 #endif
                                        q_data);
     }
-    else if (spread_fcn == "USER_DEFINED")
+    else if (spread_kernel == USER_DEFINED_KERNEL)
     {
         userDefinedSpread(q_data,
                           q_data_box,
@@ -4623,18 +5401,170 @@ LEInteractor::spread(double* const q_data,
                           Q_data,
                           Q_depth,
                           X_data,
-                          &local_indices[0],
-                          &periodic_shifts[0],
-                          local_indices_size);
-    }
-    else
-    {
-        TBOX_ERROR("LEInteractor::spread()\n"
-                   << "  Unknown spreading kernel function " << spread_fcn << std::endl);
+                          local_indices,
+                          periodic_shifts,
+                          num_local_indices);
     }
     return;
 }
 
+const LEInteractor::InteractionPlan&
+LEInteractor::getInteractionPlan(const double* const X_data,
+                                 const Box<NDIM>& q_data_box,
+                                 const IntVector<NDIM>& q_gcw,
+                                 const double* const x_lower,
+                                 const double* const x_upper,
+                                 const double* const dx,
+                                 const std::vector<int>& local_indices,
+                                 const std::vector<double>& periodic_shifts,
+                                 const std::string& kernel_fcn,
+                                 const int axis)
+{
+    const int num_local_indices = static_cast<int>(local_indices.size());
+    const hier::Index<NDIM>& ilower = q_data_box.lower();
+    const hier::Index<NDIM>& iupper = q_data_box.upper();
+    std::array<int, 2 * NDIM> box_extents;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        box_extents[d] = ilower(d);
+        box_extents[NDIM + d] = iupper(d);
+    }
+    const InteractionPlanKey key = std::make_tuple(s_interaction_plan_X_data, kernel_fcn, axis, box_extents);
+    auto plan_it = s_interaction_plans.find(key);
+    if (plan_it == s_interaction_plans.end())
+    {
+        // Bound the size of the cache by discarding the oldest plans.  Plans
+        // for LData objects that no longer exist are otherwise never removed
+        // until the data are redistributed.
+        while (static_cast<int>(s_interaction_plans.size()) >= s_max_interaction_plans)
+        {
+            s_interaction_plans.erase(s_interaction_plan_keys.front());
+            s_interaction_plan_keys.pop_front();
+        }
+        plan_it = s_interaction_plans.emplace(key, InteractionPlan()).first;
+        s_interaction_plan_keys.push_back(key);
+    }
+    InteractionPlan& plan = plan_it->second;
+
+    // Determine whether the cached plan (if any) is still valid.
+    bool plan_is_valid = !plan.point_ptr.empty() && plan.q_gcw == q_gcw && plan.local_indices == local_indices;
+    for (unsigned int d = 0; d < NDIM && plan_is_valid; ++d)
+    {
+        plan_is_valid = plan.x_lower[d] == x_lower[d] && plan.dx[d] == dx[d];
+    }
+    for (int l = 0; l < num_local_indices && plan_is_valid; ++l)
+    {
+        const int s = local_indices[l];
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            plan_is_valid =
+                plan_is_valid && plan.X[d + l * NDIM] == X_data[d + s * NDIM] + periodic_shifts[d + l * NDIM];
+        }
+    }
+    if (plan_is_valid) return plan;
+    ++s_num_interaction_plan_builds;
+
+    // Record the values used to build the plan.
+    plan.q_gcw = q_gcw;
+    plan.local_indices = local_indices;
+    plan.X.resize(NDIM * num_local_indices);
+    for (int l = 0; l < num_local_indices; ++l)
+    {
+        const int s = local_indices[l];
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            plan.X[d + l * NDIM] = X_data[d + s * NDIM] + periodic_shifts[d + l * NDIM];
+        }
+    }
+    std::array<int, NDIM> ig_lower, ig_upper, ig_extent;
+    double cell_volume = 1.0;
+    plan.depth_stride = 1;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        plan.x_lower[d] = x_lower[d];
+        plan.dx[d] = dx[d];
+        ig_lower[d] = ilower(d) - q_gcw(d);
+        ig_upper[d] = iupper(d) + q_gcw(d);
+        ig_extent[d] = ig_upper[d] - ig_lower[d] + 1;
+        plan.depth_stride *= ig_extent[d];
+        cell_volume *= dx[d];
+    }
+
+    // Determine the weights by spreading a unit value from each point, one
+    // point at a time, and collecting the nonzero values in the neighborhood
+    // of the point.  This works for all kernel functions, including
+    // user-defined kernels.  The scratch array is kept between builds and
+    // is only ever nonzero in the cells recorded in the plan, which are reset
+    // as soon as they are recorded.
+    static std::vector<double> unit_values, scratch;
+    const auto num_unit_values =
+        static_cast<std::size_t>(*std::max_element(local_indices.begin(), local_indices.end()) + 1);
+    if (unit_values.size() < num_unit_values) unit_values.assign(num_unit_values, 1.0);
+    if (scratch.size() < static_cast<std::size_t>(plan.depth_stride)) scratch.assign(plan.depth_stride, 0.0);
+    const KernelFunction kernel = getKernelFunction(kernel_fcn);
+    const int stencil_half_width = getStencilSize(kernel_fcn) / 2 + 1;
+    plan.point_ptr.resize(num_local_indices + 1);
+    plan.point_ptr[0] = 0;
+    plan.cell_offsets.clear();
+    plan.weights.clear();
+    std::array<int, NDIM> stencil_lower, stencil_upper;
+    for (int l = 0; l < num_local_indices; ++l)
+    {
+        spreadKernel(scratch.data(),
+                     q_data_box,
+                     q_gcw,
+                     /*q_depth*/ 1,
+                     unit_values.data(),
+                     /*Q_depth*/ 1,
+                     X_data,
+                     x_lower,
+                     x_upper,
+                     dx,
+                     &local_indices[l],
+                     &periodic_shifts[NDIM * l],
+                     1,
+                     kernel,
+                     axis);
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const int ic = static_cast<int>(std::floor((plan.X[d + l * NDIM] - x_lower[d]) / dx[d])) + ilower(d);
+            stencil_lower[d] = std::max(ic - stencil_half_width, ig_lower[d]);
+            stencil_upper[d] = std::min(ic + stencil_half_width, ig_upper[d]);
+        }
+#if (NDIM == 3)
+        for (int ic2 = stencil_lower[2]; ic2 <= stencil_upper[2]; ++ic2)
+        {
+#endif
+            for (int ic1 = stencil_lower[1]; ic1 <= stencil_upper[1]; ++ic1)
+            {
+                for (int ic0 = stencil_lower[0]; ic0 <= stencil_upper[0]; ++ic0)
+                {
+#if (NDIM == 2)
+                    const int offset = (ic0 - ig_lower[0]) + ig_extent[0] * (ic1 - ig_lower[1]);
+#endif
+#if (NDIM == 3)
+                    const int offset =
+                        (ic0 - ig_lower[0]) + ig_extent[0] * ((ic1 - ig_lower[1]) + ig_extent[1] * (ic2 - ig_lower[2]));
+#endif
+                    if (scratch[offset] != 0.0)
+                    {
+                        plan.cell_offsets.push_back(offset);
+                        plan.weights.push_back(scratch[offset] * cell_volume);
+                    }
+                }
+            }
+#if (NDIM == 3)
+        }
+#endif
+        plan.point_ptr[l + 1] = static_cast<int>(plan.cell_offsets.size());
+        for (int k = plan.point_ptr[l]; k < plan.point_ptr[l + 1]; ++k) scratch[plan.cell_offsets[k]] = 0.0;
+    }
+#if !defined(NDEBUG)
+    TBOX_ASSERT(std::all_of(scratch.begin(), scratch.end(), [](const double v) { return v == 0.0; }));
+#endif
+    return plan;
+} // getInteractionPlan
+
 template <class T>
 void
 LEInteractor::buildLocalIndices(std::vector<int>& local_indices,
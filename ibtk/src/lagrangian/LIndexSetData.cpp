@@ -13,6 +13,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include "ibtk/IndexUtilities.h"
 #include "ibtk/LIndexSetData.h"
 #include "ibtk/LNode.h"
 #include "ibtk/LNodeIndex.h"
@@ -30,6 +31,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdint>
 #include <utility>
 #include <vector>
 
@@ -50,7 +52,9 @@ LIndexSetData<T>::LIndexSetData(Box<NDIM> box, IntVector<NDIM> ghosts) : LSetDat
 
 template <class T>
 void
-LIndexSetData<T>::cacheLocalIndices(Pointer<Patch<NDIM> > patch, const IntVector<NDIM>& periodic_shift)
+LIndexSetData<T>::cacheLocalIndices(Pointer<Patch<NDIM> > patch,
+                                    const IntVector<NDIM>& periodic_shift,
+                                    const bool morton_order)
 {
     d_lag_indices.clear();
     d_interior_lag_indices.clear();
@@ -78,9 +82,8 @@ LIndexSetData<T>::cacheLocalIndices(Pointer<Patch<NDIM> > patch, const IntVector
         patch_touches_upper_periodic_bdry[axis] = pgeom->getTouchesPeriodicBoundary(axis, 1);
     }
 
-    for (typename LSetData<T>::SetIterator it(*this); it; it++)
-    {
-        const CellIndex<NDIM>& i = it.getIndex();
+    // Cache the indices of the nodes in a single cell of the patch data.
+    const auto cache_cell_indices = [&](const CellIndex<NDIM>& i, const LSet<T>& idx_set) {
         std::array<int, NDIM> offset;
         for (unsigned int d = 0; d < NDIM; ++d)
         {
@@ -98,7 +101,6 @@ LIndexSetData<T>::cacheLocalIndices(Pointer<Patch<NDIM> > patch, const IntVector
                 offset[d] = 0;
             }
         }
-        const LSet<T>& idx_set = *it;
         const bool patch_owns_idx_set = patch_box.contains(i);
         for (auto n = idx_set.begin(); n != idx_set.end(); ++n)
         {
@@ -134,6 +136,28 @@ LIndexSetData<T>::cacheLocalIndices(Pointer<Patch<NDIM> > patch, const IntVector
                 }
             }
         }
+    };
+
+    // Visit the cells of the patch data either in index-set order or, if
+    // requested, along a Morton curve through the ghost box.
+    if (morton_order)
+    {
+        using CellEntry = std::pair<std::uint64_t, std::pair<CellIndex<NDIM>, const LSet<T>*> >;
+        std::vector<CellEntry> cells;
+        const hier::Index<NDIM>& ghost_lower = this->getGhostBox().lower();
+        for (typename LSetData<T>::SetIterator it(*this); it; it++)
+        {
+            const CellIndex<NDIM>& i = it.getIndex();
+            cells.push_back(std::make_pair(IndexUtilities::getMortonKey(i, ghost_lower), std::make_pair(i, &(*it))));
+        }
+        std::stable_sort(cells.begin(), cells.end(), [](const CellEntry& a, const CellEntry& b) {
+            return a.first < b.first;
+        });
+        for (const auto& cell : cells) cache_cell_indices(cell.second.first, *cell.second.second);
+    }
+    else
+    {
+        for (typename LSetData<T>::SetIterator it(*this); it; it++) cache_cell_indices(it.getIndex(), *it);
     }
     return;
 } // cacheLocalIndices
@@ -2600,6 +2600,140 @@ HierarchyMathOps::vc_laplace(const int dst_idx,
     return;
 } // vc_laplace
 
+void
+HierarchyMathOps::stokes(const int dst_u_idx,
+                         const Pointer<SideVariable<NDIM, double> > dst_u_var,
+                         const bool dst_u_cf_bdry_synch,
+                         const int dst_p_idx,
+                         const Pointer<CellVariable<NDIM, double> > /*dst_p_var*/,
+                         const PoissonSpecifications& poisson_spec,
+                         const int src_u_idx,
+                         const Pointer<SideVariable<NDIM, double> > src_u_var,
+                         const int src_p_idx,
+                         const Pointer<CellVariable<NDIM, double> > /*src_p_var*/,
+                         const Pointer<HierarchyGhostCellInterpolation> src_ghost_fill,
+                         const double src_ghost_fill_time,
+                         const bool src_u_cf_bdry_synch,
+                         const double gamma,
+                         const int src2_idx,
+                         const Pointer<SideVariable<NDIM, double> > src2_var)
+{
+    if (src_ghost_fill) src_ghost_fill->fillData(src_ghost_fill_time);
+
+    if (!poisson_spec.dIsConstant())
+    {
+        TBOX_ERROR("HierarchyMathOps::stokes():\n"
+                   << "  side-centered Laplacian requires spatially constant scalar-valued "
+                      "diffusivity"
+                   << std::endl);
+    }
+
+    if (!(poisson_spec.cIsConstant() || poisson_spec.cIsZero()))
+    {
+        TBOX_ERROR("HierarchyMathOps::stokes():\n"
+                   << "  side-centered Laplacian requires spatially constant scalar-valued "
+                      "damping factor"
+                   << std::endl);
+    }
+
+    const double alpha = poisson_spec.getDConstant();
+    const double beta = poisson_spec.cIsConstant() ? poisson_spec.getCConstant() : 0.0;
+
+    if (!src_u_var->fineBoundaryRepresentsVariable())
+    {
+        TBOX_WARNING("HierarchyMathOps::stokes():\n"
+                     << "  recommended usage for side-centered Stokes operator is\n"
+                     << "  src_u_var->fineBoundaryRepresentsVariable() == true" << std::endl);
+    }
+
+    Pointer<SideDataFactory<NDIM, double> > dst_u_factory = dst_u_var->getPatchDataFactory();
+    Pointer<SideDataFactory<NDIM, double> > src_u_factory = src_u_var->getPatchDataFactory();
+    if (dst_u_factory->getDefaultDepth() != 1 || src_u_factory->getDefaultDepth() != 1)
+    {
+        TBOX_ERROR("HierarchyMathOps::stokes():\n"
+                   << "  side-centered Stokes operator requires scalar-valued data" << std::endl);
+    }
+    if (src2_var)
+    {
+        Pointer<SideDataFactory<NDIM, double> > src2_factory = src2_var->getPatchDataFactory();
+        if (src2_factory->getDefaultDepth() != 1)
+        {
+            TBOX_ERROR("HierarchyMathOps::stokes():\n"
+                       << "  side-centered Stokes operator requires scalar-valued data" << std::endl);
+        }
+    }
+
+    // Process levels from finest to coarsest. The velocity components of the
+    // operator are computed from velocity data that has not been synchronized
+    // at the coarse-fine interface, as in laplace(). As in div(), the
+    // divergence on a level that is covered by a finer level is computed only
+    // after that synchronization.
+    for (int ln = d_finest_ln; ln >= d_coarsest_ln; --ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        const bool fuse_div = (ln == d_finest_ln) || !src_u_cf_bdry_synch;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+
+            Pointer<SideData<NDIM, double> > dst_u_data = patch->getPatchData(dst_u_idx);
+            Pointer<CellData<NDIM, double> > dst_p_data =
+                fuse_div ? patch->getPatchData(dst_p_idx) : Pointer<PatchData<NDIM> >();
+            Pointer<SideData<NDIM, double> > src_u_data = patch->getPatchData(src_u_idx);
+            Pointer<CellData<NDIM, double> > src_p_data = patch->getPatchData(src_p_idx);
+            Pointer<SideData<NDIM, double> > src2_data =
+                (src2_idx >= 0) ? patch->getPatchData(src2_idx) : Pointer<PatchData<NDIM> >();
+
+            d_patch_math_ops.stokes(
+                dst_u_data, dst_p_data, alpha, beta, src_u_data, src_p_data, gamma, src2_data, patch);
+        }
+
+        if (ln == d_finest_ln || !(dst_u_cf_bdry_synch || src_u_cf_bdry_synch)) continue;
+
+        // Synchronize dst_u and src_u with the next finer level along the
+        // coarse-fine interface.
+        Pointer<PatchLevel<NDIM> > finer_level = d_hierarchy->getPatchLevel(ln + 1);
+        finer_level->allocatePatchData(d_os_idx);
+        if (dst_u_cf_bdry_synch)
+        {
+            for (PatchLevel<NDIM>::Iterator p(finer_level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = finer_level->getPatch(p());
+
+                Pointer<SideData<NDIM, double> > dst_u_data = patch->getPatchData(dst_u_idx);
+                Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
+                os_data->copy(*dst_u_data);
+            }
+            xeqScheduleOutersideRestriction(dst_u_idx, d_os_idx, ln);
+        }
+        if (src_u_cf_bdry_synch)
+        {
+            for (PatchLevel<NDIM>::Iterator p(finer_level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = finer_level->getPatch(p());
+
+                Pointer<SideData<NDIM, double> > src_u_data = patch->getPatchData(src_u_idx);
+                Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
+                os_data->copy(*src_u_data);
+            }
+            xeqScheduleOutersideRestriction(src_u_idx, d_os_idx, ln);
+
+            // Compute the divergence from the synchronized data.
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+
+                Pointer<CellData<NDIM, double> > dst_p_data = patch->getPatchData(dst_p_idx);
+                Pointer<SideData<NDIM, double> > src_u_data = patch->getPatchData(src_u_idx);
+
+                d_patch_math_ops.div(dst_p_data, -1.0, src_u_data, 0.0, Pointer<CellData<NDIM, double> >(), patch);
+            }
+        }
+        finer_level->deallocatePatchData(d_os_idx);
+    }
+    return;
+} // stokes
+
 void
 HierarchyMathOps::pointwiseMultiply(const int dst_idx,
                                     const Pointer<CellVariable<NDIM, double> > /*dst_var*/,
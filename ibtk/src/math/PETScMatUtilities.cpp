@@ -85,6 +85,77 @@ namespace IBTK
 
 namespace
 {
+void
+set_sc_laplace_op_values(Mat& mat,
+                         const PoissonSpecifications& poisson_spec,
+                         const std::vector<RobinBcCoefStrategy<NDIM>*>& bc_coefs,
+                         const double data_time,
+                         const int i_lower,
+                         const int i_upper,
+                         const int dof_index_idx,
+                         Pointer<PatchLevel<NDIM> > patch_level)
+{
+    // Setup the finite difference stencil.
+    static const int stencil_sz = 2 * NDIM + 1;
+    std::vector<hier::Index<NDIM> > stencil(stencil_sz, hier::Index<NDIM>(0));
+    for (unsigned int axis = 0, stencil_index = 1; axis < NDIM; ++axis)
+    {
+        for (int side = 0; side <= 1; ++side, ++stencil_index)
+        {
+            stencil[stencil_index](axis) = (side == 0 ? -1 : +1);
+        }
+    }
+
+    int ierr;
+    for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
+        const Box<NDIM>& patch_box = patch->getBox();
+
+        // Compute matrix coefficients.
+        const IntVector<NDIM> no_ghosts(0);
+        SideData<NDIM, double> matrix_coefs(patch_box, stencil_sz, no_ghosts);
+        PoissonUtilities::computeMatrixCoefficients(matrix_coefs, patch, stencil, poisson_spec, bc_coefs, data_time);
+
+        // Copy matrix entries to the PETSc matrix structure.
+        Pointer<SideData<NDIM, int> > dof_index_data = patch->getPatchData(dof_index_idx);
+        std::vector<double> mat_vals(stencil_sz);
+        std::vector<int> mat_cols(stencil_sz);
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(patch_box, axis)); b; b++)
+            {
+                const SideIndex<NDIM> i(b(), axis, SideIndex<NDIM>::Lower);
+                const int dof_index = (*dof_index_data)(i);
+                if (i_lower <= dof_index && dof_index < i_upper)
+                {
+                    // Notice that the order in which values are set corresponds
+                    // to that of the stencil defined above.
+                    mat_vals[0] = matrix_coefs(i, 0);
+                    mat_cols[0] = dof_index;
+                    for (unsigned int axis = 0, stencil_index = 1; axis < NDIM; ++axis)
+                    {
+                        for (int side = 0; side <= 1; ++side, ++stencil_index)
+                        {
+                            mat_vals[stencil_index] = matrix_coefs(i, stencil_index);
+                            mat_cols[stencil_index] = (*dof_index_data)(i + stencil[stencil_index]);
+                        }
+                    }
+                    ierr = MatSetValues(mat, 1, &dof_index, stencil_sz, &mat_cols[0], &mat_vals[0], INSERT_VALUES);
+                    IBTK_CHKERRQ(ierr);
+                }
+            }
+        }
+    }
+
+    // Assemble the matrix.
+    ierr = MatAssemblyBegin(mat, MAT_FINAL_ASSEMBLY);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatAssemblyEnd(mat, MAT_FINAL_ASSEMBLY);
+    IBTK_CHKERRQ(ierr);
+    return;
+} // set_sc_laplace_op_values
+
 bool inline is_cf_bdry_idx(const hier::Index<NDIM>& idx, const std::vector<Box<NDIM> >& cf_bdry_boxes)
 {
     bool contains_idx = false;
@@ -378,54 +449,34 @@ PETScMatUtilities::constructPatchLevelSCLaplaceOp(Mat& mat,
 
     // Set the matrix coefficients to correspond to the standard finite
     // difference approximation to the Laplacian.
-    for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
-    {
-        Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
-        const Box<NDIM>& patch_box = patch->getBox();
+    set_sc_laplace_op_values(mat, poisson_spec, bc_coefs, data_time, i_lower, i_upper, dof_index_idx, patch_level);
+    return;
+} // constructPatchLevelSCLaplaceOp
 
-        // Compute matrix coefficients.
-        const IntVector<NDIM> no_ghosts(0);
-        SideData<NDIM, double> matrix_coefs(patch_box, stencil_sz, no_ghosts);
-        PoissonUtilities::computeMatrixCoefficients(matrix_coefs, patch, stencil, poisson_spec, bc_coefs, data_time);
+void
+PETScMatUtilities::updatePatchLevelSCLaplaceOp(Mat& mat,
+                                               const PoissonSpecifications& poisson_spec,
+                                               const std::vector<RobinBcCoefStrategy<NDIM>*>& bc_coefs,
+                                               double data_time,
+                                               const std::vector<int>& num_dofs_per_proc,
+                                               const int dof_index_idx,
+                                               Pointer<PatchLevel<NDIM> > patch_level)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(mat);
+    TBOX_ASSERT(bc_coefs.size() == NDIM);
+#endif
 
-        // Copy matrix entries to the PETSc matrix structure.
-        Pointer<SideData<NDIM, int> > dof_index_data = patch->getPatchData(dof_index_idx);
-        std::vector<double> mat_vals(stencil_sz);
-        std::vector<int> mat_cols(stencil_sz);
-        for (unsigned int axis = 0; axis < NDIM; ++axis)
-        {
-            for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(patch_box, axis)); b; b++)
-            {
-                const SideIndex<NDIM> i(b(), axis, SideIndex<NDIM>::Lower);
-                const int dof_index = (*dof_index_data)(i);
-                if (i_lower <= dof_index && dof_index < i_upper)
-                {
-                    // Notice that the order in which values are set corresponds
-                    // to that of the stencil defined above.
-                    mat_vals[0] = matrix_coefs(i, 0);
-                    mat_cols[0] = dof_index;
-                    for (unsigned int axis = 0, stencil_index = 1; axis < NDIM; ++axis)
-                    {
-                        for (int side = 0; side <= 1; ++side, ++stencil_index)
-                        {
-                            mat_vals[stencil_index] = matrix_coefs(i, stencil_index);
-                            mat_cols[stencil_index] = (*dof_index_data)(i + stencil[stencil_index]);
-                        }
-                    }
-                    ierr = MatSetValues(mat, 1, &dof_index, stencil_sz, &mat_cols[0], &mat_vals[0], INSERT_VALUES);
-                    IBTK_CHKERRQ(ierr);
-                }
-            }
-        }
-    }
+    // Determine the index ranges.
+    const int mpi_rank = SAMRAI_MPI::getRank();
+    const int n_local = num_dofs_per_proc[mpi_rank];
+    const int i_lower = std::accumulate(num_dofs_per_proc.begin(), num_dofs_per_proc.begin() + mpi_rank, 0);
+    const int i_upper = i_lower + n_local;
 
-    // Assemble the matrix.
-    ierr = MatAssemblyBegin(mat, MAT_FINAL_ASSEMBLY);
-    IBTK_CHKERRQ(ierr);
-    ierr = MatAssemblyEnd(mat, MAT_FINAL_ASSEMBLY);
-    IBTK_CHKERRQ(ierr);
+    // Overwrite the matrix coefficients using the existing nonzero structure.
+    set_sc_laplace_op_values(mat, poisson_spec, bc_coefs, data_time, i_lower, i_upper, dof_index_idx, patch_level);
     return;
-} // constructPatchLevelSCLaplaceOp
+} // updatePatchLevelSCLaplaceOp
 
 void
 PETScMatUtilities::constructPatchLevelVCSCViscousOp(
@@ -1427,6 +1427,43 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Computes offsets into the storage of a single depth of an ArrayData object
+// with the specified (ghost) box.
+struct ArrayIndexer
+{
+    ArrayIndexer()
+    {
+        lower.fill(0);
+        stride.fill(0);
+    }
+
+    ArrayIndexer(const Box<NDIM>& box)
+    {
+        int offset = 1;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            lower[d] = box.lower(d);
+            stride[d] = offset;
+            offset *= box.numberCells(d);
+        }
+    }
+
+    int operator()(const std::array<int, NDIM>& i) const
+    {
+        int offset = 0;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            offset += (i[d] - lower[d]) * stride[d];
+        }
+        return offset;
+    }
+
+    std::array<int, NDIM> lower, stride;
+};
+} // namespace
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 void
@@ -5971,6 +6008,186 @@ PatchMathOps::vc_laplace(Pointer<SideData<NDIM, double> > dst,
     return;
 } // vc_laplace
 
+void
+PatchMathOps::stokes(Pointer<SideData<NDIM, double> > dst_u,
+                     Pointer<CellData<NDIM, double> > dst_p,
+                     const double alpha,
+                     const double beta,
+                     const Pointer<SideData<NDIM, double> > src_u,
+                     const Pointer<CellData<NDIM, double> > src_p,
+                     const double gamma,
+                     const Pointer<SideData<NDIM, double> > src2,
+                     const Pointer<Patch<NDIM> > patch) const
+{
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const dx = pgeom->getDx();
+
+    const Box<NDIM>& patch_box = patch->getBox();
+    const bool compute_div = !dst_p.isNull();
+    const bool add_src2 = !src2.isNull() && (gamma != 0.0);
+
+#if !defined(NDEBUG)
+    if ((src_u->getGhostCellWidth()).min() < 1)
+    {
+        TBOX_ERROR("PatchMathOps::stokes():\n"
+                   << "  src_u has insufficient ghost cell width" << std::endl);
+    }
+
+    if ((src_p->getGhostCellWidth()).min() < 1)
+    {
+        TBOX_ERROR("PatchMathOps::stokes():\n"
+                   << "  src_p has insufficient ghost cell width" << std::endl);
+    }
+
+    if (src_u == dst_u)
+    {
+        TBOX_ERROR("PatchMathOps::stokes():\n"
+                   << "  src_u == dst_u." << std::endl);
+    }
+
+    if ((src_u == src2) && (gamma != 0.0))
+    {
+        TBOX_ERROR("PatchMathOps::stokes():\n"
+                   << "  src_u == src2 but gamma is nonzero." << std::endl);
+    }
+
+    if (dst_u->getDepth() != 1 || src_u->getDepth() != 1 || src_p->getDepth() != 1 ||
+        (compute_div && dst_p->getDepth() != 1) || (add_src2 && src2->getDepth() != 1))
+    {
+        TBOX_ERROR("PatchMathOps::stokes():\n"
+                   << "  fused Stokes operator requires scalar-valued data" << std::endl);
+    }
+
+    if (patch_box != dst_u->getBox() || patch_box != src_u->getBox() || patch_box != src_p->getBox() ||
+        (compute_div && patch_box != dst_p->getBox()) || (add_src2 && patch_box != src2->getBox()))
+    {
+        TBOX_ERROR("PatchMathOps::stokes():\n"
+                   << "  dst_u, dst_p, src_u, src_p, and src2 must all live on the same patch" << std::endl);
+    }
+#endif
+
+    // All of the operator's components are evaluated in a single sweep over the patch: for each row of cells (i.e.,
+    // fixed values of the indices in directions 1, ..., NDIM-1) we first update the NDIM rows of side-centered values
+    // that bound those cells and then compute the divergence in those cells from the same rows of velocity data. This
+    // keeps the stencil data for all components resident in cache instead of streaming the velocity data through
+    // memory three times.
+    const bool compute_laplacian = (alpha != 0.0) || (beta != 0.0);
+
+    std::array<double, NDIM> lap_fac, grad_fac, div_fac;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        lap_fac[d] = alpha / (dx[d] * dx[d]);
+        grad_fac[d] = 1.0 / dx[d];
+        div_fac[d] = -1.0 / dx[d];
+    }
+
+    std::array<ArrayIndexer, NDIM> dst_u_idxr, src_u_idxr, src2_idxr;
+    std::array<double*, NDIM> F;
+    std::array<const double*, NDIM> U, V;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        dst_u_idxr[d] = ArrayIndexer(dst_u->getArrayData(d).getBox());
+        src_u_idxr[d] = ArrayIndexer(src_u->getArrayData(d).getBox());
+        F[d] = dst_u->getPointer(d);
+        U[d] = src_u->getPointer(d);
+        if (add_src2)
+        {
+            src2_idxr[d] = ArrayIndexer(src2->getArrayData(d).getBox());
+            V[d] = src2->getPointer(d);
+        }
+        else
+        {
+            V[d] = nullptr;
+        }
+    }
+    const ArrayIndexer src_p_idxr(src_p->getArrayData().getBox());
+    const double* const P = src_p->getPointer();
+    const ArrayIndexer dst_p_idxr = compute_div ? ArrayIndexer(dst_p->getArrayData().getBox()) : ArrayIndexer();
+    double* const D = compute_div ? dst_p->getPointer() : nullptr;
+
+    const int ilower0 = patch_box.lower(0);
+    const int iupper0 = patch_box.upper(0);
+    std::array<int, NDIM> i;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        i[d] = patch_box.lower(d);
+    }
+    while (true)
+    {
+        // Update the side-centered values in the current row.
+        bool cell_row = true;
+        for (unsigned int k = 1; k < NDIM; ++k)
+        {
+            cell_row = cell_row && (i[k] <= patch_box.upper(k));
+        }
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            bool side_row = true;
+            for (unsigned int k = 1; k < NDIM; ++k)
+            {
+                if (k != d) side_row = side_row && (i[k] <= patch_box.upper(k));
+            }
+            if (!side_row) continue;
+            const int iupper0_side = (d == 0) ? iupper0 + 1 : iupper0;
+            double* const f = F[d] + dst_u_idxr[d](i);
+            const double* const u = U[d] + src_u_idxr[d](i);
+            const double* const v = add_src2 ? V[d] + src2_idxr[d](i) : nullptr;
+            const double* const p = P + src_p_idxr(i);
+            const int p_shift = src_p_idxr.stride[d];
+            const std::array<int, NDIM>& u_stride = src_u_idxr[d].stride;
+            for (int i0 = 0; i0 <= iupper0_side - ilower0; ++i0)
+            {
+                double val = grad_fac[d] * (p[i0] - p[i0 - p_shift]);
+                if (compute_laplacian)
+                {
+                    double lap_u = lap_fac[0] * (u[i0 - u_stride[0]] + u[i0 + u_stride[0]] - 2.0 * u[i0]);
+                    for (unsigned int k = 1; k < NDIM; ++k)
+                    {
+                        lap_u += lap_fac[k] * (u[i0 - u_stride[k]] + u[i0 + u_stride[k]] - 2.0 * u[i0]);
+                    }
+                    if (beta != 0.0) lap_u += beta * u[i0];
+                    val = lap_u + val;
+                }
+                if (add_src2) val += gamma * v[i0];
+                f[i0] = val;
+            }
+        }
+
+        // Compute the divergence in the current row of cells.
+        if (compute_div && cell_row)
+        {
+            double* const div = D + dst_p_idxr(i);
+            std::array<const double*, NDIM> u;
+            std::array<int, NDIM> u_shift;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                u[d] = U[d] + src_u_idxr[d](i);
+                u_shift[d] = src_u_idxr[d].stride[d];
+            }
+            for (int i0 = 0; i0 <= iupper0 - ilower0; ++i0)
+            {
+                double div_u = div_fac[0] * (u[0][i0 + u_shift[0]] - u[0][i0]);
+                for (unsigned int d = 1; d < NDIM; ++d)
+                {
+                    div_u += div_fac[d] * (u[d][i0 + u_shift[d]] - u[d][i0]);
+                }
+                div[i0] = div_u;
+            }
+        }
+
+        // Advance to the next row. Rows extend one index past the upper end of the patch box in each direction so
+        // that the upper-most side-centered values are also visited.
+        unsigned int k = 1;
+        for (; k < NDIM; ++k)
+        {
+            if (++i[k] <= patch_box.upper(k) + 1) break;
+            i[k] = patch_box.lower(k);
+        }
+        if (k >= NDIM) break;
+    }
+    return;
+} // stokes
+
 void
 PatchMathOps::pointwiseMultiply(Pointer<CellData<NDIM, double> > dst,
                                 const double alpha,
@@ -55,6 +55,23 @@ KrylovLinearSolverPoissonSolverInterface::setPoissonSpecifications(const Poisson
     return;
 } // setPoissonSpecifications
 
+bool
+KrylovLinearSolverPoissonSolverInterface::updatePoissonSpecifications(const PoissonSpecifications& poisson_spec)
+{
+    auto p_this = dynamic_cast<KrylovLinearSolver*>(this);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(p_this);
+#endif
+    const bool same_d_form = d_poisson_spec.dIsConstant() == poisson_spec.dIsConstant();
+    PoissonSolver::setPoissonSpecifications(poisson_spec);
+    Pointer<LaplaceOperator> p_operator = p_this->getOperator();
+    if (p_operator) p_operator->setPoissonSpecifications(d_poisson_spec);
+    bool updated = same_d_form;
+    Pointer<PoissonSolver> p_preconditioner = p_this->getPreconditioner();
+    if (p_preconditioner) updated = p_preconditioner->updatePoissonSpecifications(d_poisson_spec) && updated;
+    return updated || !d_is_initialized;
+} // updatePoissonSpecifications
+
 void
 KrylovLinearSolverPoissonSolverInterface::setPhysicalBcCoef(RobinBcCoefStrategy<NDIM>* bc_coef)
 {
@@ -809,6 +809,86 @@ PETScLevelSolver::setupNullspace()
     return;
 } // setupNullspace
 
+void
+PETScLevelSolver::resetKSPOperators()
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_is_initialized);
+#endif
+    int ierr;
+    if (d_pc_type == "shell")
+    {
+        // Refresh the local submatrices in place.
+#if PETSC_VERSION_GE(3, 8, 0)
+        ierr = MatCreateSubMatrices(
+            d_petsc_mat, d_n_local_subdomains, &d_overlap_is[0], &d_overlap_is[0], MAT_REUSE_MATRIX, &d_sub_mat);
+#else
+        ierr = MatGetSubMatrices(
+            d_petsc_mat, d_n_local_subdomains, &d_overlap_is[0], &d_overlap_is[0], MAT_REUSE_MATRIX, &d_sub_mat);
+#endif
+        IBTK_CHKERRQ(ierr);
+        if (d_shell_pc_type == "multiplicative")
+        {
+            PetscInt n_lo, n_hi;
+            ierr = VecGetOwnershipRange(d_petsc_x, &n_lo, &n_hi);
+            IBTK_CHKERRQ(ierr);
+            IS local_idx;
+            ierr = ISCreateStride(PETSC_COMM_WORLD, n_hi - n_lo, n_lo, 1, &local_idx);
+            IBTK_CHKERRQ(ierr);
+            std::vector<IS> local_idxs(d_n_local_subdomains, local_idx);
+#if PETSC_VERSION_GE(3, 8, 0)
+            ierr = MatCreateSubMatrices(d_petsc_mat,
+                                        d_n_local_subdomains,
+                                        d_n_local_subdomains ? &d_overlap_is[0] : nullptr,
+                                        d_n_local_subdomains ? &local_idxs[0] : nullptr,
+                                        MAT_REUSE_MATRIX,
+                                        &d_sub_bc_mat);
+#else
+            ierr = MatGetSubMatrices(d_petsc_mat,
+                                     d_n_local_subdomains,
+                                     d_n_local_subdomains ? &d_overlap_is[0] : nullptr,
+                                     d_n_local_subdomains ? &local_idxs[0] : nullptr,
+                                     MAT_REUSE_MATRIX,
+                                     &d_sub_bc_mat);
+#endif
+            IBTK_CHKERRQ(ierr);
+            for (int i = 0; i < d_n_local_subdomains; ++i)
+            {
+                ierr = MatScale(d_sub_bc_mat[i], -1.0);
+                IBTK_CHKERRQ(ierr);
+            }
+            ierr = ISDestroy(&local_idx);
+            IBTK_CHKERRQ(ierr);
+        }
+
+        // Recompute the subdomain preconditioners.  Because the nonzero
+        // structure is unchanged, PETSc reuses any symbolic factorizations.
+        for (int i = 0; i < d_n_local_subdomains; ++i)
+        {
+            KSP& sub_ksp = d_sub_ksp[i];
+            ierr = KSPSetOperators(sub_ksp, d_sub_mat[i], d_sub_mat[i]);
+            IBTK_CHKERRQ(ierr);
+            ierr = KSPSetReusePreconditioner(sub_ksp, PETSC_FALSE);
+            IBTK_CHKERRQ(ierr);
+            ierr = KSPSetUp(sub_ksp);
+            IBTK_CHKERRQ(ierr);
+            ierr = KSPSetReusePreconditioner(sub_ksp, PETSC_TRUE);
+            IBTK_CHKERRQ(ierr);
+        }
+    }
+
+    // Recompute the preconditioner for the modified operator.
+    ierr = KSPSetOperators(d_petsc_ksp, d_petsc_mat, d_petsc_pc);
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetReusePreconditioner(d_petsc_ksp, PETSC_FALSE);
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetUp(d_petsc_ksp);
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetReusePreconditioner(d_petsc_ksp, PETSC_TRUE);
+    IBTK_CHKERRQ(ierr);
+    return;
+} // resetKSPOperators
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 PetscErrorCode
@@ -65,6 +65,15 @@ PoissonFACPreconditioner::setPoissonSpecifications(const PoissonSpecifications&
     return;
 } // setPoissonSpecifications
 
+bool
+PoissonFACPreconditioner::updatePoissonSpecifications(const PoissonSpecifications& poisson_spec)
+{
+    PoissonSolver::setPoissonSpecifications(poisson_spec);
+    Pointer<PoissonFACPreconditionerStrategy> p_fac_strategy = d_fac_strategy;
+    if (p_fac_strategy) return p_fac_strategy->updatePoissonSpecifications(d_poisson_spec) || !d_is_initialized;
+    return !d_is_initialized;
+} // updatePoissonSpecifications
+
 void
 PoissonFACPreconditioner::setPhysicalBcCoef(RobinBcCoefStrategy<NDIM>* bc_coef)
 {
@@ -168,6 +168,13 @@ PoissonFACPreconditionerStrategy::setPoissonSpecifications(const PoissonSpecific
     return;
 } // setPoissonSpecifications
 
+bool
+PoissonFACPreconditionerStrategy::updatePoissonSpecifications(const PoissonSpecifications& poisson_spec)
+{
+    setPoissonSpecifications(poisson_spec);
+    return !d_is_initialized;
+} // updatePoissonSpecifications
+
 void
 PoissonFACPreconditionerStrategy::setPhysicalBcCoef(RobinBcCoefStrategy<NDIM>* const bc_coef)
 {
@@ -40,6 +40,13 @@ PoissonSolver::setPoissonSpecifications(const PoissonSpecifications& poisson_spe
     return;
 } // setPoissonSpecifications
 
+bool
+PoissonSolver::updatePoissonSpecifications(const PoissonSpecifications& poisson_spec)
+{
+    setPoissonSpecifications(poisson_spec);
+    return !d_is_initialized;
+} // updatePoissonSpecifications
+
 void
 PoissonSolver::setPhysicalBcCoef(RobinBcCoefStrategy<NDIM>* const bc_coef)
 {
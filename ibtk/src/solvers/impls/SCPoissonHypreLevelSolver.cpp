@@ -27,6 +27,7 @@
 #include "CoarseFineBoundary.h"
 #include "Patch.h"
 #include "PatchHierarchy.h"
+#include "PoissonSpecifications.h"
 #include "SideData.h"
 #include "SideGeometry.h"
 #include "SideIndex.h"
@@ -149,6 +150,19 @@ SCPoissonHypreLevelSolver::~SCPoissonHypreLevelSolver()
     return;
 } // ~SCPoissonHypreLevelSolver
 
+bool
+SCPoissonHypreLevelSolver::updatePoissonSpecifications(const PoissonSpecifications& poisson_spec)
+{
+    setPoissonSpecifications(poisson_spec);
+    if (!d_is_initialized) return true;
+    // The matrix has already been assembled with the same graph, so its
+    // entries can be overwritten in place and the matrix reassembled.
+    destroyHypreSolver();
+    setMatrixCoefficients();
+    setupHypreSolver();
+    return true;
+} // updatePoissonSpecifications
+
 bool
 SCPoissonHypreLevelSolver::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVectorReal<NDIM, double>& b)
 {
@@ -30,6 +30,7 @@
 #include "PatchDescriptor.h"
 #include "PatchGeometry.h"
 #include "PatchLevel.h"
+#include "PoissonSpecifications.h"
 #include "RefineSchedule.h"
 #include "SAMRAIVectorReal.h"
 #include "SideData.h"
@@ -93,6 +94,17 @@ SCPoissonPETScLevelSolver::~SCPoissonPETScLevelSolver()
     return;
 } // ~SCPoissonPETScLevelSolver
 
+bool
+SCPoissonPETScLevelSolver::updatePoissonSpecifications(const PoissonSpecifications& poisson_spec)
+{
+    setPoissonSpecifications(poisson_spec);
+    if (!d_is_initialized) return true;
+    PETScMatUtilities::updatePatchLevelSCLaplaceOp(
+        d_petsc_mat, d_poisson_spec, d_bc_coefs, d_solution_time, d_num_dofs_per_proc, d_dof_index_idx, d_level);
+    resetKSPOperators();
+    return true;
+} // updatePoissonSpecifications
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 void
@@ -363,6 +363,17 @@ SCPoissonPointRelaxationFACOperator::setCoarseSolverType(const std::string& coar
     return;
 } // setCoarseSolverType
 
+bool
+SCPoissonPointRelaxationFACOperator::updatePoissonSpecifications(const PoissonSpecifications& poisson_spec)
+{
+    const bool same_d_form = d_poisson_spec.dIsConstant() == poisson_spec.dIsConstant();
+    setPoissonSpecifications(poisson_spec);
+    if (!d_is_initialized) return true;
+    if (!same_d_form) return false;
+    if (d_coarse_solver) return d_coarse_solver->updatePoissonSpecifications(d_poisson_spec);
+    return true;
+} // updatePoissonSpecifications
+
 void
 SCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>& error,
                                                  const SAMRAIVectorReal<NDIM, double>& residual,
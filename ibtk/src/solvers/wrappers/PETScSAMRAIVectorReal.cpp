@@ -19,9 +19,26 @@
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 
+#include "ArrayData.h"
+#include "Box.h"
+#include "CellData.h"
+#include "CellVariable.h"
 #include "IntVector.h"
+#include "NodeData.h"
+#include "NodeGeometry.h"
+#include "NodeVariable.h"
+#include "Patch.h"
+#include "PatchData.h"
+#include "PatchDataFactory.h"
+#include "PatchDescriptor.h"
 #include "PatchHierarchy.h"
+#include "PatchLevel.h"
 #include "SAMRAIVectorReal.h"
+#include "SideData.h"
+#include "SideGeometry.h"
+#include "SideVariable.h"
+#include "Variable.h"
+#include "VariableDatabase.h"
 #include "tbox/MathUtilities.h"
 #include "tbox/Pointer.h"
 #include "tbox/Timer.h"
@@ -32,9 +49,11 @@
 #include <mpi.h>
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <ostream>
 #include <string>
+#include <vector>
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
@@ -102,6 +121,332 @@ static Timer* t_vec_dot_norm2;
 #define PSVR_CHECK3(v1, v2, v3)
 #define PSVR_CHECKN(v, N)
 #endif
+
+// The number of vectors that are processed together by the fused
+// multi-vector kernels.
+static const int FUSED_BLOCK_SIZE = 8;
+
+// The data centerings supported by the fused multi-vector kernels.
+enum DataCentering
+{
+    CELL_CENTERING,
+    NODE_CENTERING,
+    SIDE_CENTERING,
+    UNSUPPORTED_CENTERING
+};
+
+DataCentering
+get_data_centering(const int data_idx, int& depth)
+{
+    Pointer<Variable<NDIM> > var;
+    VariableDatabase<NDIM>::getDatabase()->mapIndexToVariable(data_idx, var);
+    Pointer<CellVariable<NDIM, double> > cc_var = var;
+    if (cc_var)
+    {
+        depth = cc_var->getDepth();
+        return CELL_CENTERING;
+    }
+    Pointer<NodeVariable<NDIM, double> > nc_var = var;
+    if (nc_var)
+    {
+        depth = nc_var->getDepth();
+        return NODE_CENTERING;
+    }
+    Pointer<SideVariable<NDIM, double> > sc_var = var;
+    if (sc_var)
+    {
+        depth = sc_var->getDepth();
+        return SIDE_CENTERING;
+    }
+    depth = 0;
+    return UNSUPPORTED_CENTERING;
+}
+
+IntVector<NDIM>
+get_ghost_width(const int data_idx)
+{
+    return VariableDatabase<NDIM>::getDatabase()
+        ->getPatchDescriptor()
+        ->getPatchDataFactory(data_idx)
+        ->getGhostCellWidth();
+}
+
+bool
+same_layout(const SAMRAIVectorReal<NDIM, double>& u, const SAMRAIVectorReal<NDIM, double>& v)
+{
+    return u.getPatchHierarchy().getPointer() == v.getPatchHierarchy().getPointer() &&
+           u.getCoarsestLevelNumber() == v.getCoarsestLevelNumber() &&
+           u.getFinestLevelNumber() == v.getFinestLevelNumber() &&
+           u.getNumberOfComponents() == v.getNumberOfComponents();
+}
+
+// Determines whether the fused kernels can compute the inner products of x
+// with each of the vectors y.  We require that each component of x has a
+// control volume, so that the fused kernels need not reproduce the logic used
+// by SAMRAI to avoid double counting shared degrees of freedom.
+bool
+can_use_fused_dot(const SAMRAIVectorReal<NDIM, double>& x, const std::vector<SAMRAIVectorReal<NDIM, double>*>& y)
+{
+    for (const auto& y_vec : y)
+    {
+        if (!same_layout(x, *y_vec)) return false;
+    }
+    for (int comp = 0; comp < x.getNumberOfComponents(); ++comp)
+    {
+        const int cv_idx = x.getControlVolumeIndex(comp);
+        if (cv_idx < 0) return false;
+        int depth, cv_depth;
+        const DataCentering centering = get_data_centering(x.getComponentDescriptorIndex(comp), depth);
+        if (centering == UNSUPPORTED_CENTERING) return false;
+        if (get_data_centering(cv_idx, cv_depth) != centering || (cv_depth != 1 && cv_depth != depth)) return false;
+        for (const auto& y_vec : y)
+        {
+            int y_depth;
+            if (get_data_centering(y_vec->getComponentDescriptorIndex(comp), y_depth) != centering ||
+                y_depth != depth)
+                return false;
+        }
+    }
+    return true;
+}
+
+// Determines whether the fused kernels can compute y += sum_i alpha_i x_i.
+// Because these updates include ghost values, we also require that all of the
+// data have the same ghost cell width, so that the updates can be performed
+// directly on the underlying data arrays.
+bool
+can_use_fused_maxpy(SAMRAIVectorReal<NDIM, double>& y, const std::vector<SAMRAIVectorReal<NDIM, double>*>& x)
+{
+    for (const auto& x_vec : x)
+    {
+        if (!same_layout(y, *x_vec)) return false;
+    }
+    for (int comp = 0; comp < y.getNumberOfComponents(); ++comp)
+    {
+        const int y_idx = y.getComponentDescriptorIndex(comp);
+        int depth;
+        const DataCentering centering = get_data_centering(y_idx, depth);
+        if (centering == UNSUPPORTED_CENTERING) return false;
+        const IntVector<NDIM> ghost_width = get_ghost_width(y_idx);
+        for (const auto& x_vec : x)
+        {
+            const int x_idx = x_vec->getComponentDescriptorIndex(comp);
+            int x_depth;
+            if (get_data_centering(x_idx, x_depth) != centering || x_depth != depth ||
+                get_ghost_width(x_idx) != ghost_width)
+                return false;
+        }
+    }
+    return true;
+}
+
+// Returns the data arrays that store a single vector component on a single
+// patch along with the number of such arrays.
+int
+get_patch_arrays(PatchData<NDIM>* const data,
+                 const DataCentering centering,
+                 std::array<ArrayData<NDIM, double>*, NDIM>& arrays)
+{
+    switch (centering)
+    {
+    case CELL_CENTERING:
+        arrays[0] = &static_cast<CellData<NDIM, double>*>(data)->getArrayData();
+        return 1;
+    case NODE_CENTERING:
+        arrays[0] = &static_cast<NodeData<NDIM, double>*>(data)->getArrayData();
+        return 1;
+    case SIDE_CENTERING:
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            arrays[axis] = &static_cast<SideData<NDIM, double>*>(data)->getArrayData(axis);
+        }
+        return NDIM;
+    default:
+        TBOX_ERROR("PETScSAMRAIVectorReal: unsupported data centering" << std::endl);
+    }
+    return 0;
+}
+
+// Returns the index box of the interior values stored in a data array.
+Box<NDIM>
+get_interior_box(const Box<NDIM>& patch_box, const DataCentering centering, const int array_num)
+{
+    switch (centering)
+    {
+    case CELL_CENTERING:
+        return patch_box;
+    case NODE_CENTERING:
+        return NodeGeometry<NDIM>::toNodeBox(patch_box);
+    case SIDE_CENTERING:
+        return SideGeometry<NDIM>::toSideBox(patch_box, array_num);
+    default:
+        TBOX_ERROR("PETScSAMRAIVectorReal: unsupported data centering" << std::endl);
+    }
+    return patch_box;
+}
+
+// Computes offsets into the storage of a single depth of an ArrayData object.
+struct ArrayIndexer
+{
+    ArrayIndexer(const ArrayData<NDIM, double>& data)
+    {
+        const Box<NDIM>& box = data.getBox();
+        int offset = 1;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            lower[d] = box.lower(d);
+            stride[d] = offset;
+            offset *= box.numberCells(d);
+        }
+    }
+
+    int operator()(const hier::Index<NDIM>& i) const
+    {
+        int offset = 0;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            offset += (i(d) - lower[d]) * stride[d];
+        }
+        return offset;
+    }
+
+    std::array<int, NDIM> lower, stride;
+};
+
+// Computes the local parts of the control volume-weighted inner products of x
+// with each of the vectors y.  Each patch is visited once, and the data of x
+// are reused for each block of FUSED_BLOCK_SIZE vectors.
+void
+fused_local_dots(const SAMRAIVectorReal<NDIM, double>& x,
+                 const std::vector<SAMRAIVectorReal<NDIM, double>*>& y,
+                 double* const val)
+{
+    const int nv = static_cast<int>(y.size());
+    std::fill(val, val + nv, 0.0);
+    Pointer<PatchHierarchy<NDIM> > hierarchy = x.getPatchHierarchy();
+    std::array<ArrayData<NDIM, double>*, NDIM> x_arrays, cv_arrays;
+    std::vector<std::array<ArrayData<NDIM, double>*, NDIM> > y_arrays(nv);
+    std::vector<ArrayIndexer> y_indexers;
+    y_indexers.reserve(nv);
+    for (int comp = 0; comp < x.getNumberOfComponents(); ++comp)
+    {
+        int depth;
+        const DataCentering centering = get_data_centering(x.getComponentDescriptorIndex(comp), depth);
+        for (int ln = x.getCoarsestLevelNumber(); ln <= x.getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const Box<NDIM>& patch_box = patch->getBox();
+                const int num_arrays = get_patch_arrays(
+                    patch->getPatchData(x.getComponentDescriptorIndex(comp)).getPointer(), centering, x_arrays);
+                get_patch_arrays(patch->getPatchData(x.getControlVolumeIndex(comp)).getPointer(), centering, cv_arrays);
+                for (int k = 0; k < nv; ++k)
+                {
+                    get_patch_arrays(patch->getPatchData(y[k]->getComponentDescriptorIndex(comp)).getPointer(),
+                                     centering,
+                                     y_arrays[k]);
+                }
+                for (int array_num = 0; array_num < num_arrays; ++array_num)
+                {
+                    const Box<NDIM> interior_box = get_interior_box(patch_box, centering, array_num);
+                    const int n = interior_box.numberCells(0);
+                    Box<NDIM> row_box = interior_box;
+                    row_box.upper(0) = row_box.lower(0);
+                    const ArrayIndexer x_indexer(*x_arrays[array_num]);
+                    const ArrayIndexer cv_indexer(*cv_arrays[array_num]);
+                    y_indexers.clear();
+                    for (int k = 0; k < nv; ++k) y_indexers.emplace_back(*y_arrays[k][array_num]);
+                    const bool cv_has_depth = cv_arrays[array_num]->getDepth() > 1;
+                    for (int d = 0; d < depth; ++d)
+                    {
+                        const double* const x_data = x_arrays[array_num]->getPointer(d);
+                        const double* const cv_data = cv_arrays[array_num]->getPointer(cv_has_depth ? d : 0);
+                        for (int k0 = 0; k0 < nv; k0 += FUSED_BLOCK_SIZE)
+                        {
+                            const int nb = std::min(FUSED_BLOCK_SIZE, nv - k0);
+                            std::array<const double*, FUSED_BLOCK_SIZE> y_data, y_row;
+                            std::array<double, FUSED_BLOCK_SIZE> sums;
+                            for (int j = 0; j < nb; ++j)
+                            {
+                                y_data[j] = y_arrays[k0 + j][array_num]->getPointer(d);
+                                sums[j] = 0.0;
+                            }
+                            for (Box<NDIM>::Iterator b(row_box); b; b++)
+                            {
+                                const hier::Index<NDIM>& i = b();
+                                const double* const x_row = x_data + x_indexer(i);
+                                const double* const cv_row = cv_data + cv_indexer(i);
+                                for (int j = 0; j < nb; ++j) y_row[j] = y_data[j] + y_indexers[k0 + j](i);
+                                for (int m = 0; m < n; ++m)
+                                {
+                                    const double w = x_row[m] * cv_row[m];
+                                    for (int j = 0; j < nb; ++j) sums[j] += w * y_row[j][m];
+                                }
+                            }
+                            for (int j = 0; j < nb; ++j) val[k0 + j] += sums[j];
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return;
+} // fused_local_dots
+
+// Computes y += sum_i alpha_i x_i, including ghost values.  Each patch is
+// visited once, and the data of y are updated once for each block of
+// FUSED_BLOCK_SIZE vectors.
+void
+fused_maxpy(SAMRAIVectorReal<NDIM, double>& y,
+            const double* const alpha,
+            const std::vector<SAMRAIVectorReal<NDIM, double>*>& x)
+{
+    const int nv = static_cast<int>(x.size());
+    Pointer<PatchHierarchy<NDIM> > hierarchy = y.getPatchHierarchy();
+    std::array<ArrayData<NDIM, double>*, NDIM> y_arrays;
+    std::vector<std::array<ArrayData<NDIM, double>*, NDIM> > x_arrays(nv);
+    for (int comp = 0; comp < y.getNumberOfComponents(); ++comp)
+    {
+        int depth;
+        const DataCentering centering = get_data_centering(y.getComponentDescriptorIndex(comp), depth);
+        for (int ln = y.getCoarsestLevelNumber(); ln <= y.getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const int num_arrays = get_patch_arrays(
+                    patch->getPatchData(y.getComponentDescriptorIndex(comp)).getPointer(), centering, y_arrays);
+                for (int k = 0; k < nv; ++k)
+                {
+                    get_patch_arrays(patch->getPatchData(x[k]->getComponentDescriptorIndex(comp)).getPointer(),
+                                     centering,
+                                     x_arrays[k]);
+                }
+                for (int array_num = 0; array_num < num_arrays; ++array_num)
+                {
+                    double* const y_data = y_arrays[array_num]->getPointer();
+                    const int n = y_arrays[array_num]->getBox().size() * depth;
+                    for (int k0 = 0; k0 < nv; k0 += FUSED_BLOCK_SIZE)
+                    {
+                        const int nb = std::min(FUSED_BLOCK_SIZE, nv - k0);
+                        std::array<const double*, FUSED_BLOCK_SIZE> x_data;
+                        for (int j = 0; j < nb; ++j) x_data[j] = x_arrays[k0 + j][array_num]->getPointer();
+                        for (int m = 0; m < n; ++m)
+                        {
+                            double sum = 0.0;
+                            for (int j = 0; j < nb; ++j) sum += alpha[k0 + j] * x_data[j][m];
+                            y_data[m] += sum;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return;
+} // fused_maxpy
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -305,11 +650,7 @@ PETScSAMRAIVectorReal::VecMDot_SAMRAI(Vec x, PetscInt nv, const Vec* y, PetscSca
     IBTK_TIMER_START(t_vec_m_dot);
     PSVR_CHECK1(x);
     PSVR_CHECKN(y, nv);
-    static const bool local_only = true;
-    for (PetscInt i = 0; i < nv; ++i)
-    {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
-    }
+    computeLocalMDot(x, nv, y, val);
     SAMRAI_MPI::sumReduction(val, nv);
     IBTK_TIMER_STOP(t_vec_m_dot);
     PetscFunctionReturn(0);
@@ -366,11 +707,7 @@ PETScSAMRAIVectorReal::VecMTDot_SAMRAI(Vec x, PetscInt nv, const Vec* y, PetscSc
     IBTK_TIMER_START(t_vec_m_t_dot);
     PSVR_CHECK1(x);
     PSVR_CHECKN(y, nv);
-    static const bool local_only = true;
-    for (PetscInt i = 0; i < nv; ++i)
-    {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
-    }
+    computeLocalMDot(x, nv, y, val);
     SAMRAI_MPI::sumReduction(val, nv);
     IBTK_TIMER_STOP(t_vec_m_t_dot);
     PetscFunctionReturn(0);
@@ -488,20 +825,32 @@ PETScSAMRAIVectorReal::VecMAXPY_SAMRAI(Vec y, PetscInt nv, const PetscScalar* al
     IBTK_TIMER_START(t_vec_maxpy);
     PSVR_CHECK1(y);
     PSVR_CHECKN(x, nv);
-    static const bool interior_only = false;
+    std::vector<SAMRAIVectorReal<NDIM, PetscScalar>*> x_vecs(nv);
     for (PetscInt i = 0; i < nv; ++i)
     {
-        if (MathUtilities<double>::equalEps(alpha[i], 1.0))
-        {
-            PSVR_CAST2(y)->add(PSVR_CAST2(x[i]), PSVR_CAST2(y), interior_only);
-        }
-        else if (MathUtilities<double>::equalEps(alpha[i], -1.0))
-        {
-            PSVR_CAST2(y)->subtract(PSVR_CAST2(y), PSVR_CAST2(x[i]), interior_only);
-        }
-        else
+        x_vecs[i] = PSVR_CAST2(x[i]).getPointer();
+    }
+    if (can_use_fused_maxpy(*PSVR_CAST2(y), x_vecs))
+    {
+        fused_maxpy(*PSVR_CAST2(y), alpha, x_vecs);
+    }
+    else
+    {
+        static const bool interior_only = false;
+        for (PetscInt i = 0; i < nv; ++i)
         {
-            PSVR_CAST2(y)->axpy(alpha[i], PSVR_CAST2(x[i]), PSVR_CAST2(y), interior_only);
+            if (MathUtilities<double>::equalEps(alpha[i], 1.0))
+            {
+                PSVR_CAST2(y)->add(PSVR_CAST2(x[i]), PSVR_CAST2(y), interior_only);
+            }
+            else if (MathUtilities<double>::equalEps(alpha[i], -1.0))
+            {
+                PSVR_CAST2(y)->subtract(PSVR_CAST2(y), PSVR_CAST2(x[i]), interior_only);
+            }
+            else
+            {
+                PSVR_CAST2(y)->axpy(alpha[i], PSVR_CAST2(x[i]), PSVR_CAST2(y), interior_only);
+            }
         }
     }
     int ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(y));
@@ -716,11 +1065,7 @@ PETScSAMRAIVectorReal::VecMDot_local_SAMRAI(Vec x, PetscInt nv, const Vec* y, Pe
     IBTK_TIMER_START(t_vec_m_dot_local);
     PSVR_CHECK1(x);
     PSVR_CHECKN(y, nv);
-    static const bool local_only = true;
-    for (PetscInt i = 0; i < nv; ++i)
-    {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
-    }
+    computeLocalMDot(x, nv, y, val);
     IBTK_TIMER_STOP(t_vec_m_dot_local);
     PetscFunctionReturn(0);
 }
@@ -731,11 +1076,7 @@ PETScSAMRAIVectorReal::VecMTDot_local_SAMRAI(Vec x, PetscInt nv, const Vec* y, P
     IBTK_TIMER_START(t_vec_m_t_dot_local);
     PSVR_CHECK1(x);
     PSVR_CHECKN(y, nv);
-    static const bool local_only = true;
-    for (PetscInt i = 0; i < nv; ++i)
-    {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
-    }
+    computeLocalMDot(x, nv, y, val);
     IBTK_TIMER_STOP(t_vec_m_t_dot_local);
     PetscFunctionReturn(0);
 }
@@ -755,12 +1096,40 @@ PETScSAMRAIVectorReal::VecDotNorm2_SAMRAI(Vec s, Vec t, PetscScalar* dp, PetscSc
 {
     IBTK_TIMER_START(t_vec_dot_norm2);
     PSVR_CHECK2(s, t);
-    *dp = PSVR_CAST2(s)->dot(PSVR_CAST2(t));
-    *nm = PSVR_CAST2(t)->dot(PSVR_CAST2(t));
+    static const bool local_only = true;
+    PetscScalar vals[2];
+    vals[0] = PSVR_CAST2(s)->dot(PSVR_CAST2(t), local_only);
+    vals[1] = PSVR_CAST2(t)->dot(PSVR_CAST2(t), local_only);
+    SAMRAI_MPI::sumReduction(vals, 2);
+    *dp = vals[0];
+    *nm = vals[1];
     IBTK_TIMER_STOP(t_vec_dot_norm2);
     PetscFunctionReturn(0);
 }
 
+void
+PETScSAMRAIVectorReal::computeLocalMDot(Vec x, PetscInt nv, const Vec* y, PetscScalar* val)
+{
+    std::vector<SAMRAIVectorReal<NDIM, PetscScalar>*> y_vecs(nv);
+    for (PetscInt i = 0; i < nv; ++i)
+    {
+        y_vecs[i] = PSVR_CAST2(y[i]).getPointer();
+    }
+    if (can_use_fused_dot(*PSVR_CAST2(x), y_vecs))
+    {
+        fused_local_dots(*PSVR_CAST2(x), y_vecs, val);
+    }
+    else
+    {
+        static const bool local_only = true;
+        for (PetscInt i = 0; i < nv; ++i)
+        {
+            val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        }
+    }
+    return;
+}
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBTK
@@ -17,6 +17,7 @@
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/HierarchyIntegrator.h"
 #include "ibtk/HierarchyMathOps.h"
+#include "ibtk/HilbertLoadBalancer.h"
 #include "ibtk/RefinePatchStrategySet.h"
 #include "ibtk/ibtk_enums.h"
 #include "ibtk/ibtk_utilities.h"
@@ -541,7 +542,15 @@ HierarchyIntegrator::registerLoadBalancer(Pointer<LoadBalancer<NDIM> > load_bala
         d_workload_var = new CellVariable<NDIM, double>(d_object_name + "::workload");
         registerVariable(d_workload_idx, d_workload_var, 0, getCurrentContext());
     }
-    d_load_balancer->setWorkloadPatchDataIndex(d_workload_idx);
+    Pointer<HilbertLoadBalancer> hilbert_load_balancer = d_load_balancer;
+    if (hilbert_load_balancer)
+    {
+        hilbert_load_balancer->setWorkloadPatchDataIndex(d_workload_idx);
+    }
+    else
+    {
+        d_load_balancer->setWorkloadPatchDataIndex(d_workload_idx);
+    }
     return;
 } // registerLoadBalancer
 
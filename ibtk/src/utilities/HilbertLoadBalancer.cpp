@@ -0,0 +1,274 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/HilbertLoadBalancer.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+#include "Box.h"
+#include "BoxTree.h"
+#include "CellData.h"
+#include "CellIndex.h"
+#include "Patch.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "ProcessorMapping.h"
+#include "tbox/Array.h"
+#include "tbox/SAMRAI_MPI.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Compute the index of a point along the Hilbert curve that fills the cube
+// [0, 2^num_bits)^NDIM using the algorithm of J. Skilling, "Programming the
+// Hilbert curve," AIP Conf. Proc. 707 (2004).
+std::uint64_t
+hilbert_index(std::array<std::uint32_t, NDIM> X, const int num_bits)
+{
+    const std::uint32_t M = 1u << (num_bits - 1);
+
+    // Convert the coordinates to the "transposed" Hilbert index.
+    for (std::uint32_t Q = M; Q > 1; Q >>= 1)
+    {
+        const std::uint32_t P = Q - 1;
+        for (unsigned int i = 0; i < NDIM; ++i)
+        {
+            if (X[i] & Q)
+            {
+                X[0] ^= P;
+            }
+            else
+            {
+                const std::uint32_t t = (X[0] ^ X[i]) & P;
+                X[0] ^= t;
+                X[i] ^= t;
+            }
+        }
+    }
+    for (unsigned int i = 1; i < NDIM; ++i) X[i] ^= X[i - 1];
+    std::uint32_t t = 0;
+    for (std::uint32_t Q = M; Q > 1; Q >>= 1)
+    {
+        if (X[NDIM - 1] & Q) t ^= Q - 1;
+    }
+    for (unsigned int i = 0; i < NDIM; ++i) X[i] ^= t;
+
+    // Interleave the bits of the transposed index.
+    std::uint64_t index = 0;
+    for (int b = num_bits - 1; b >= 0; --b)
+    {
+        for (unsigned int i = 0; i < NDIM; ++i)
+        {
+            index = (index << 1) | ((X[i] >> b) & 1u);
+        }
+    }
+    return index;
+} // hilbert_index
+
+// Compute the Hilbert indices of the centers of the boxes.
+std::vector<std::uint64_t>
+hilbert_indices(const BoxArray<NDIM>& boxes)
+{
+    const int num_boxes = boxes.size();
+    std::vector<std::uint64_t> indices(num_boxes);
+    if (num_boxes == 0) return indices;
+
+    // Box centers are represented by the sums of the upper and lower indices,
+    // shifted so that all coordinates are nonnegative.
+    const Box<NDIM> bounding_box = boxes.getBoundingBox();
+    std::uint32_t max_coord = 0;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        max_coord = std::max(max_coord, static_cast<std::uint32_t>(2 * bounding_box.numberCells(d)));
+    }
+    int num_bits = 1;
+    while (num_bits < 32 && (max_coord >> num_bits) > 0) ++num_bits;
+
+    // Coarsen the coordinates if they do not fit into a 64-bit index.
+    static const int max_num_bits = 64 / NDIM;
+    const int shift = std::max(0, num_bits - max_num_bits);
+    num_bits -= shift;
+
+    for (int k = 0; k < num_boxes; ++k)
+    {
+        const Box<NDIM>& box = boxes[k];
+        std::array<std::uint32_t, NDIM> X;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const int coord = box.lower(d) + box.upper(d) - 2 * bounding_box.lower(d);
+            X[d] = static_cast<std::uint32_t>(coord) >> shift;
+        }
+        indices[k] = hilbert_index(X, num_bits);
+    }
+    return indices;
+} // hilbert_indices
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+void
+HilbertLoadBalancer::setWorkloadPatchDataIndex(const int data_id, const int level_number)
+{
+    mesh::LoadBalancer<NDIM>::setWorkloadPatchDataIndex(data_id, level_number);
+    if (level_number < 0)
+    {
+        d_master_workload_idx = data_id;
+        d_workload_idx.clear();
+    }
+    else
+    {
+        if (level_number >= static_cast<int>(d_workload_idx.size()))
+        {
+            d_workload_idx.resize(level_number + 1, d_master_workload_idx);
+        }
+        d_workload_idx[level_number] = data_id;
+    }
+    return;
+} // setWorkloadPatchDataIndex
+
+void
+HilbertLoadBalancer::loadBalanceBoxes(BoxArray<NDIM>& out_boxes,
+                                      ProcessorMapping& mapping,
+                                      const BoxList<NDIM>& in_boxes,
+                                      const Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                      int level_number,
+                                      const BoxArray<NDIM>& physical_domain,
+                                      const IntVector<NDIM>& ratio_to_hierarchy_level_zero,
+                                      const IntVector<NDIM>& min_size,
+                                      const IntVector<NDIM>& max_size,
+                                      const IntVector<NDIM>& cut_factor,
+                                      const IntVector<NDIM>& bad_interval) const
+{
+    // Let the parent class generate the boxes.  We discard the processor
+    // mapping that it computes.
+    BoxArray<NDIM> boxes;
+    mesh::LoadBalancer<NDIM>::loadBalanceBoxes(boxes,
+                                               mapping,
+                                               in_boxes,
+                                               hierarchy,
+                                               level_number,
+                                               physical_domain,
+                                               ratio_to_hierarchy_level_zero,
+                                               min_size,
+                                               max_size,
+                                               cut_factor,
+                                               bad_interval);
+    const int num_boxes = boxes.size();
+    const std::vector<double> workloads = computeBoxWorkloads(boxes, hierarchy, level_number);
+
+    // Sort the boxes along the Hilbert curve.  Ties are broken by the original
+    // box order so that all processors compute the same ordering.
+    const std::vector<std::uint64_t> indices = hilbert_indices(boxes);
+    std::vector<int> order(num_boxes);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&indices](const int a, const int b) {
+        return std::make_pair(indices[a], a) < std::make_pair(indices[b], b);
+    });
+
+    // Cut the curve into segments of approximately equal workload by assigning
+    // each box to the processor whose segment contains the midpoint of the box
+    // workload.
+    const int n_nodes = SAMRAI_MPI::getNodes();
+    const double total_workload = std::accumulate(workloads.begin(), workloads.end(), 0.0);
+    out_boxes.resizeBoxArray(num_boxes);
+    mapping.setMappingSize(num_boxes);
+    double prefix_workload = 0.0;
+    for (int k = 0; k < num_boxes; ++k)
+    {
+        const int box_num = order[k];
+        const double w = workloads[box_num];
+        const double midpoint = total_workload > 0.0 ? (prefix_workload + 0.5 * w) / total_workload :
+                                                       (k + 0.5) / static_cast<double>(num_boxes);
+        const int rank = std::min(n_nodes - 1, static_cast<int>(midpoint * n_nodes));
+        out_boxes[k] = boxes[box_num];
+        mapping.setProcessorAssignment(k, rank);
+        prefix_workload += w;
+    }
+    return;
+} // loadBalanceBoxes
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+std::vector<double>
+HilbertLoadBalancer::computeBoxWorkloads(const BoxArray<NDIM>& boxes,
+                                         Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                         const int level_number) const
+{
+    const int num_boxes = boxes.size();
+    std::vector<double> workloads(num_boxes);
+    for (int k = 0; k < num_boxes; ++k) workloads[k] = boxes[k].size();
+
+    const int workload_idx = level_number < static_cast<int>(d_workload_idx.size()) ? d_workload_idx[level_number] :
+                                                                                        d_master_workload_idx;
+    if (workload_idx == IBTK::invalid_index || !hierarchy || level_number > hierarchy->getFinestLevelNumber())
+    {
+        return workloads;
+    }
+    Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
+    if (!level->checkAllocated(workload_idx)) return workloads;
+
+    // Each processor accumulates the workload of the cells that are covered by
+    // its local patches.  Because the patches are disjoint, the remaining cells
+    // of each box are exactly those not covered by the existing level.  The
+    // patches that overlap each box are found with the box tree of the existing
+    // level, so that we do not need to intersect every box with every patch.
+    Pointer<BoxTree<NDIM> > box_tree = level->getBoxTree();
+    const ProcessorMapping& processor_mapping = level->getProcessorMapping();
+    std::vector<double> covered_workloads(2 * num_boxes, 0.0);
+    for (int k = 0; k < num_boxes; ++k)
+    {
+        Array<int> patch_nums;
+        box_tree->findOverlapIndices(patch_nums, boxes[k]);
+        for (int j = 0; j < patch_nums.size(); ++j)
+        {
+            if (!processor_mapping.isMappingLocal(patch_nums[j])) continue;
+            Pointer<Patch<NDIM> > patch = level->getPatch(patch_nums[j]);
+            Pointer<CellData<NDIM, double> > workload_data = patch->getPatchData(workload_idx);
+            const Box<NDIM> overlap_box = patch->getBox() * boxes[k];
+            double workload = 0.0;
+            for (Box<NDIM>::Iterator b(overlap_box); b; b++)
+            {
+                workload += (*workload_data)(CellIndex<NDIM>(b()));
+            }
+            covered_workloads[2 * k] += workload;
+            covered_workloads[2 * k + 1] += overlap_box.size();
+        }
+    }
+    SAMRAI_MPI::sumReduction(covered_workloads.data(), 2 * num_boxes);
+    for (int k = 0; k < num_boxes; ++k)
+    {
+        workloads[k] += covered_workloads[2 * k] - covered_workloads[2 * k + 1];
+    }
+    return workloads;
+} // computeBoxWorkloads
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
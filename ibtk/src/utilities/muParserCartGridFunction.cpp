@@ -18,28 +18,23 @@
 #include "ibtk/muParserCartGridFunction.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 
+#include "ArrayData.h"
 #include "Box.h"
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
-#include "CellIndex.h"
-#include "CellIterator.h"
 #include "EdgeData.h"
-#include "EdgeIndex.h"
-#include "EdgeIterator.h"
+#include "EdgeGeometry.h"
 #include "FaceData.h"
-#include "FaceIndex.h"
-#include "FaceIterator.h"
+#include "FaceGeometry.h"
 #include "Index.h"
 #include "IntVector.h"
 #include "NodeData.h"
-#include "NodeIndex.h"
-#include "NodeIterator.h"
+#include "NodeGeometry.h"
 #include "Patch.h"
 #include "PatchData.h"
 #include "SideData.h"
-#include "SideIndex.h"
-#include "SideIterator.h"
+#include "SideGeometry.h"
 #include "tbox/Array.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
@@ -49,6 +44,7 @@
 #include "muParserError.h"
 
 #include <algorithm>
+#include <array>
 #include <map>
 #include <memory>
 #include <ostream>
@@ -80,6 +76,29 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Identifiers for the data centerings (and data axes) used to index cached
+// function values.
+static const int CELL_CACHE_ID = 0;
+static const int NODE_CACHE_ID = 1;
+static const int FACE_CACHE_ID = 2;
+static const int SIDE_CACHE_ID = FACE_CACHE_ID + NDIM;
+static const int EDGE_CACHE_ID = SIDE_CACHE_ID + NDIM;
+
+// Determine which function is used to set the values of the specified depth
+// and axis of face-, side-, or edge-centered data.
+inline int
+get_function_depth(const int parsers_size, const int data_depth_size, const int data_depth, const int axis)
+{
+    if (parsers_size == 1) return 0;
+    if (parsers_size == NDIM) return axis;
+    if (parsers_size == data_depth_size) return data_depth;
+    if (parsers_size == NDIM * data_depth_size) return NDIM * data_depth + axis;
+    return -1;
+} // get_function_depth
+} // namespace
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 muParserCartGridFunction::muParserCartGridFunction(std::string object_name,
@@ -243,17 +262,24 @@ muParserCartGridFunction::muParserCartGridFunction(std::string object_name,
         {
             parser.DefineConst(constant.first, constant.second);
         }
+    }
 
-        // Variables.
-        parser.DefineVar("T", &d_parser_time);
-        parser.DefineVar("t", &d_parser_time);
-        for (unsigned int d = 0; d < NDIM; ++d)
+    // Variables.
+    reserveBulkBuffers(1);
+
+    // Determine which functions depend on time.
+    for (auto& parser : d_parsers)
+    {
+        try
         {
-            const std::string postfix = std::to_string(d);
-            parser.DefineVar("X" + postfix, &(d_parser_posn[d]));
-            parser.DefineVar("x" + postfix, &(d_parser_posn[d]));
-            parser.DefineVar("X_" + postfix, &(d_parser_posn[d]));
-            parser.DefineVar("x_" + postfix, &(d_parser_posn[d]));
+            const mu::varmap_type& used_vars = parser.GetUsedVar();
+            d_time_dependent.push_back(used_vars.count("T") || used_vars.count("t"));
+        }
+        catch (mu::ParserError& e)
+        {
+            TBOX_ERROR("muParserCartGridFunction::muParserCartGridFunction():\n"
+                       << "  error: " << e.GetMsg() << "\n"
+                       << "  in:    " << e.GetExpr() << "\n");
         }
     }
     return;
@@ -270,17 +296,16 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
                                          Pointer<Variable<NDIM> > /*var*/,
                                          Pointer<Patch<NDIM> > patch,
                                          const double data_time,
-                                         const bool /*initial_time*/,
+                                         const bool initial_time,
                                          Pointer<PatchLevel<NDIM> > /*level*/)
 {
-    d_parser_time = data_time;
-
     const Box<NDIM>& patch_box = patch->getBox();
-    const hier::Index<NDIM>& patch_lower = patch_box.lower();
-    Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const bool use_cache = !initial_time;
 
-    const double* const XLower = pgeom->getXLower();
-    const double* const dx = pgeom->getDx();
+    // The position of each index relative to the cell index used to compute it.
+    std::array<double, NDIM> cell_centering, node_centering;
+    cell_centering.fill(0.5);
+    node_centering.fill(0.0);
 
     // Set the data in the patch.
     Pointer<PatchData<NDIM> > data = patch->getPatchData(data_idx);
@@ -300,29 +325,16 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
         for (int data_depth = 0; data_depth < cc_data->getDepth(); ++data_depth)
         {
             const int function_depth = (d_parsers.size() == 1 ? 0 : data_depth);
-            for (CellIterator<NDIM> ic(patch_box); ic; ic++)
-            {
-                const CellIndex<NDIM>& i = ic();
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
-                }
-                try
-                {
-                    (*cc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                }
-                catch (mu::ParserError& e)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  error: " << e.GetMsg() << "\n"
-                               << "  in:    " << e.GetExpr() << "\n");
-                }
-                catch (...)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  unrecognized exception generated by muParser library.\n");
-                }
-            }
+            setDataOnArrayData(cc_data->getArrayData(),
+                               data_depth,
+                               function_depth,
+                               patch_box,
+                               cell_centering,
+                               0,
+                               CELL_CACHE_ID,
+                               *patch,
+                               data_time,
+                               use_cache);
         }
     }
     else if (fc_data)
@@ -336,58 +348,19 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
         {
             for (unsigned int axis = 0; axis < NDIM; ++axis)
             {
-                int function_depth = -1;
-                const int parsers_size = static_cast<int>(d_parsers.size());
-                const int fc_data_depth = fc_data->getDepth();
-                if (parsers_size == 1)
-                {
-                    function_depth = 0;
-                }
-                else if (parsers_size == NDIM)
-                {
-                    function_depth = axis;
-                }
-                else if (parsers_size == fc_data_depth)
-                {
-                    function_depth = data_depth;
-                }
-                else if (parsers_size == NDIM * fc_data_depth)
-                {
-                    function_depth = NDIM * data_depth + axis;
-                }
-
-                for (FaceIterator<NDIM> ic(patch_box, axis); ic; ic++)
-                {
-                    const FaceIndex<NDIM>& i = ic();
-                    const hier::Index<NDIM>& cell_idx = i.toCell(1);
-                    for (unsigned int d = 0; d < NDIM; ++d)
-                    {
-                        if (d == axis)
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(cell_idx(d) - patch_lower(d)));
-                        }
-                        else
-                        {
-                            d_parser_posn[d] =
-                                XLower[d] + dx[d] * (static_cast<double>(cell_idx(d) - patch_lower(d)) + 0.5);
-                        }
-                    }
-                    try
-                    {
-                        (*fc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                    }
-                    catch (mu::ParserError& e)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  error: " << e.GetMsg() << "\n"
-                                   << "  in:    " << e.GetExpr() << "\n");
-                    }
-                    catch (...)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  unrecognized exception generated by muParser library.\n");
-                    }
-                }
+                const int function_depth = get_function_depth(d_parsers.size(), fc_data->getDepth(), data_depth, axis);
+                std::array<double, NDIM> face_centering = cell_centering;
+                face_centering[axis] = 0.0;
+                setDataOnArrayData(fc_data->getArrayData(axis),
+                                   data_depth,
+                                   function_depth,
+                                   FaceGeometry<NDIM>::toFaceBox(patch_box, axis),
+                                   face_centering,
+                                   axis,
+                                   FACE_CACHE_ID + axis,
+                                   *patch,
+                                   data_time,
+                                   use_cache);
             }
         }
     }
@@ -399,29 +372,16 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
         for (int data_depth = 0; data_depth < nc_data->getDepth(); ++data_depth)
         {
             const int function_depth = (d_parsers.size() == 1 ? 0 : data_depth);
-            for (NodeIterator<NDIM> ic(patch_box); ic; ic++)
-            {
-                const NodeIndex<NDIM>& i = ic();
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
-                }
-                try
-                {
-                    (*nc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                }
-                catch (mu::ParserError& e)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  error: " << e.GetMsg() << "\n"
-                               << "  in:    " << e.GetExpr() << "\n");
-                }
-                catch (...)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  unrecognized exception generated by muParser library.\n");
-                }
-            }
+            setDataOnArrayData(nc_data->getArrayData(),
+                               data_depth,
+                               function_depth,
+                               NodeGeometry<NDIM>::toNodeBox(patch_box),
+                               node_centering,
+                               0,
+                               NODE_CACHE_ID,
+                               *patch,
+                               data_time,
+                               use_cache);
         }
     }
     else if (sc_data)
@@ -435,56 +395,19 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
         {
             for (unsigned int axis = 0; axis < NDIM; ++axis)
             {
-                int function_depth = -1;
-                const int parsers_size = static_cast<int>(d_parsers.size());
-                const int sc_data_depth = sc_data->getDepth();
-                if (parsers_size == 1)
-                {
-                    function_depth = 0;
-                }
-                else if (parsers_size == NDIM)
-                {
-                    function_depth = axis;
-                }
-                else if (parsers_size == sc_data_depth)
-                {
-                    function_depth = data_depth;
-                }
-                else if (parsers_size == NDIM * sc_data_depth)
-                {
-                    function_depth = NDIM * data_depth + axis;
-                }
-
-                for (SideIterator<NDIM> ic(patch_box, axis); ic; ic++)
-                {
-                    const SideIndex<NDIM>& i = ic();
-                    for (unsigned int d = 0; d < NDIM; ++d)
-                    {
-                        if (d == axis)
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
-                        }
-                        else
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
-                        }
-                    }
-                    try
-                    {
-                        (*sc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                    }
-                    catch (mu::ParserError& e)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  error: " << e.GetMsg() << "\n"
-                                   << "  in:    " << e.GetExpr() << "\n");
-                    }
-                    catch (...)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  unrecognized exception generated by muParser library.\n");
-                    }
-                }
+                const int function_depth = get_function_depth(d_parsers.size(), sc_data->getDepth(), data_depth, axis);
+                std::array<double, NDIM> side_centering = cell_centering;
+                side_centering[axis] = 0.0;
+                setDataOnArrayData(sc_data->getArrayData(axis),
+                                   data_depth,
+                                   function_depth,
+                                   SideGeometry<NDIM>::toSideBox(patch_box, axis),
+                                   side_centering,
+                                   0,
+                                   SIDE_CACHE_ID + axis,
+                                   *patch,
+                                   data_time,
+                                   use_cache);
             }
         }
     }
@@ -499,56 +422,19 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
         {
             for (unsigned int axis = 0; axis < NDIM; ++axis)
             {
-                int function_depth = -1;
-                const int parsers_size = static_cast<int>(d_parsers.size());
-                const int ec_data_depth = ec_data->getDepth();
-                if (parsers_size == 1)
-                {
-                    function_depth = 0;
-                }
-                else if (parsers_size == NDIM)
-                {
-                    function_depth = axis;
-                }
-                else if (parsers_size == ec_data_depth)
-                {
-                    function_depth = data_depth;
-                }
-                else if (parsers_size == NDIM * ec_data_depth)
-                {
-                    function_depth = NDIM * data_depth + axis;
-                }
-
-                for (EdgeIterator<NDIM> ic(patch_box, axis); ic; ic++)
-                {
-                    const EdgeIndex<NDIM>& i = ic();
-                    for (unsigned int d = 0; d < NDIM; ++d)
-                    {
-                        if (d == axis)
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
-                        }
-                        else
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
-                        }
-                    }
-                    try
-                    {
-                        (*ec_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                    }
-                    catch (mu::ParserError& e)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  error: " << e.GetMsg() << "\n"
-                                   << "  in:    " << e.GetExpr() << "\n");
-                    }
-                    catch (...)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  unrecognized exception generated by muParser library.\n");
-                    }
-                }
+                const int function_depth = get_function_depth(d_parsers.size(), ec_data->getDepth(), data_depth, axis);
+                std::array<double, NDIM> edge_centering = node_centering;
+                edge_centering[axis] = 0.5;
+                setDataOnArrayData(ec_data->getArrayData(axis),
+                                   data_depth,
+                                   function_depth,
+                                   EdgeGeometry<NDIM>::toEdgeBox(patch_box, axis),
+                                   edge_centering,
+                                   0,
+                                   EDGE_CACHE_ID + axis,
+                                   *patch,
+                                   data_time,
+                                   use_cache);
             }
         }
     }
@@ -560,6 +446,132 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
     return;
 } // setDataOnPatch
 
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+muParserCartGridFunction::setDataOnArrayData(ArrayData<NDIM, double>& data,
+                                             const int data_depth,
+                                             const int function_depth,
+                                             const Box<NDIM>& index_box,
+                                             const std::array<double, NDIM>& centering,
+                                             const unsigned int permutation,
+                                             const int cache_id,
+                                             const Patch<NDIM>& patch,
+                                             const double data_time,
+                                             const bool use_cache)
+{
+    const Box<NDIM>& patch_box = patch.getBox();
+    const hier::Index<NDIM>& patch_lower = patch_box.lower();
+    Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch.getPatchGeometry();
+    const double* const XLower = pgeom->getXLower();
+    const double* const dx = pgeom->getDx();
+
+    // Look for previously computed values of time-independent functions.
+    const bool cache_vals = use_cache && !d_time_dependent[function_depth];
+    CachedValues* cached_vals = nullptr;
+    if (cache_vals)
+    {
+        const std::array<int, 4> key = {
+            { patch.getPatchLevelNumber(), patch.getPatchNumber(), cache_id, function_depth }
+        };
+        cached_vals = &d_cached_vals[key];
+        bool cache_valid =
+            cached_vals->box == index_box && static_cast<int>(cached_vals->vals.size()) == index_box.size();
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            cache_valid = cache_valid && cached_vals->x_lower[d] == XLower[d] && cached_vals->dx[d] == dx[d];
+        }
+        if (cache_valid)
+        {
+            int k = 0;
+            for (Box<NDIM>::Iterator b(index_box); b; b++, ++k)
+            {
+                data(b(), data_depth) = cached_vals->vals[k];
+            }
+            return;
+        }
+    }
+
+    // Compute the positions at which the function is evaluated.
+    const int n = index_box.size();
+    reserveBulkBuffers(n);
+    std::fill(d_bulk_time.begin(), d_bulk_time.begin() + n, data_time);
+    int k = 0;
+    for (Box<NDIM>::Iterator b(index_box); b; b++, ++k)
+    {
+        const hier::Index<NDIM>& i = b();
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const int cell_idx = i((d + NDIM - permutation) % NDIM);
+            d_bulk_posn[d][k] = XLower[d] + dx[d] * (static_cast<double>(cell_idx - patch_lower(d)) + centering[d]);
+        }
+    }
+
+    // Evaluate the function at all positions at once.
+    try
+    {
+        d_parsers[function_depth].Eval(d_bulk_vals.data(), n);
+    }
+    catch (mu::ParserError& e)
+    {
+        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
+                   << "  error: " << e.GetMsg() << "\n"
+                   << "  in:    " << e.GetExpr() << "\n");
+    }
+    catch (...)
+    {
+        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
+                   << "  unrecognized exception generated by muParser library.\n");
+    }
+
+    k = 0;
+    for (Box<NDIM>::Iterator b(index_box); b; b++, ++k)
+    {
+        data(b(), data_depth) = d_bulk_vals[k];
+    }
+
+    if (cache_vals)
+    {
+        cached_vals->box = index_box;
+        std::copy(XLower, XLower + NDIM, cached_vals->x_lower.begin());
+        std::copy(dx, dx + NDIM, cached_vals->dx.begin());
+        cached_vals->vals.assign(d_bulk_vals.begin(), d_bulk_vals.begin() + n);
+    }
+    return;
+} // setDataOnArrayData
+
+void
+muParserCartGridFunction::reserveBulkBuffers(const int n)
+{
+    if (n <= static_cast<int>(d_bulk_time.size())) return;
+    d_bulk_time.resize(n);
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        d_bulk_posn[d].resize(n);
+    }
+    d_bulk_vals.resize(n);
+
+    // In bulk mode, muParser reads the value of each variable at the offset of
+    // the value being computed, so the variables must be rebound whenever the
+    // buffers are reallocated.
+    for (auto& parser : d_parsers)
+    {
+        parser.DefineVar("T", d_bulk_time.data());
+        parser.DefineVar("t", d_bulk_time.data());
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const std::string postfix = std::to_string(d);
+            parser.DefineVar("X" + postfix, d_bulk_posn[d].data());
+            parser.DefineVar("x" + postfix, d_bulk_posn[d].data());
+            parser.DefineVar("X_" + postfix, d_bulk_posn[d].data());
+            parser.DefineVar("x_" + postfix, d_bulk_posn[d].data());
+        }
+    }
+    return;
+} // reserveBulkBuffers
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBTK
@@ -425,6 +425,27 @@ public:
                                  double f_periodic_corr,
                                  const int managing_rank) override;
 
+    // \see CIBStrategy::constructMobilityMatrixBlocks() method.
+    /*!
+     * \brief Generate the diagonal blocks of a block-diagonal approximation to
+     * the dense mobility matrix for the prototypical structures identified by
+     * their indices.
+     */
+    void constructMobilityMatrixBlocks(const std::string& mat_name,
+                                       MobilityMatrixType mat_type,
+                                       std::vector<std::vector<int> >& block_nodes,
+                                       std::vector<std::vector<double> >& block_mats,
+                                       const unsigned int max_block_nodes,
+                                       const std::vector<unsigned>& prototype_struct_ids,
+                                       const double* grid_dx,
+                                       const double* domain_extents,
+                                       const bool initial_time,
+                                       double rho,
+                                       double mu,
+                                       const std::pair<double, double>& scale,
+                                       double f_periodic_corr,
+                                       const int managing_rank) override;
+
     // \see CIBStrategy::constructGeometricMatrix() method.
     /*!
      * \brief Generate block-diagonal geometric matrix for the prototypical structures
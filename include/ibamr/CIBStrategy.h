@@ -508,6 +508,45 @@ public:
                                          double f_periodic_corr,
                                          const int managing_rank);
 
+    /*!
+     * \brief Construct the diagonal blocks of a block-diagonal approximation to
+     * the dense mobility matrix for the prototypical structures identified by
+     * their indices. The nodes are split into spatially compact clusters of at
+     * most \p max_block_nodes nodes, and only the interactions between the
+     * nodes of each cluster are retained. The blocks are distributed in a
+     * round-robin fashion over all processors starting from \p managing_rank,
+     * so that no processor stores the full dense matrix.
+     * \note A default empty implementation is provided
+     * in this class. The derived class provides the actual implementation.
+     *
+     * \param block_nodes Indices of the nodes of each of the blocks assigned
+     * to this processor, using the same ordering of the nodes as the full
+     * mobility matrix.
+     *
+     * \param block_mats Dense blocks assigned to this processor. Each block is
+     * stored in column-major(FORTRAN) order.
+     *
+     * \param max_block_nodes Maximum number of nodes in each block.
+     *
+     * \see constructMobilityMatrix() for the remaining parameters.
+     *
+     * \note This is a collective operation.
+     */
+    virtual void constructMobilityMatrixBlocks(const std::string& mat_name,
+                                               MobilityMatrixType mat_type,
+                                               std::vector<std::vector<int> >& block_nodes,
+                                               std::vector<std::vector<double> >& block_mats,
+                                               const unsigned int max_block_nodes,
+                                               const std::vector<unsigned>& prototype_struct_ids,
+                                               const double* grid_dx,
+                                               const double* domain_extents,
+                                               const bool initial_time,
+                                               double rho,
+                                               double mu,
+                                               const std::pair<double, double>& scale,
+                                               double f_periodic_corr,
+                                               const int managing_rank);
+
     /*!
      * \brief Construct a geometric matrix for the prototypical structures
      * identified by their indices. A geometric matrix maps center of mass rigid
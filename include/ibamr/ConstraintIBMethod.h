@@ -320,10 +320,10 @@ private:
     void calculateKinematicsVelocity();
 
     /*!
-     * \brief Calculate momentum of kinematics velocity. This is extraneous momentum
-     * that needs to be subtracted from the kinematics velocity.
+     * \brief Calculate momentum of kinematics velocity for the given structures. This
+     * is extraneous momentum that needs to be subtracted from the kinematics velocity.
      */
-    void calculateMomentumOfKinematicsVelocity(const int position_handle);
+    void calculateMomentumOfKinematicsVelocity(const std::vector<int>& position_handles);
 
     /*!
      * \brief Calculate volume element associated with material points.
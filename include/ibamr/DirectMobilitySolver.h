@@ -49,6 +49,18 @@ namespace IBAMR
 /*!
  * \brief Class DirectMobilitySolver solves the mobility and body-mobility
  * sub-problem by employing direct solvers.
+ *
+ * By default, each dense mobility matrix is assembled and factorized on its
+ * managing processor. If the input database sets <code>max_block_nodes</code>
+ * to a positive value, mobility matrices with more nodes than that are instead
+ * replaced by a block-diagonal approximation: the nodes are split into
+ * spatially compact clusters of at most <code>max_block_nodes</code> nodes, and
+ * the dense blocks for the interactions within each cluster are assembled and
+ * factorized on different processors. This requires only
+ * \f$ O(N \cdot \mbox{max\_block\_nodes}) \f$ memory in total. Since the
+ * interactions between clusters are dropped, the resulting solver is an
+ * approximation that is intended to be used as a preconditioner, e.g., by
+ * CIBSaddlePointSolver.
  */
 class DirectMobilitySolver : public SAMRAI::tbox::DescribedClass
 {
@@ -240,6 +252,25 @@ private:
      */
     void computeSolution(Mat& mat, const MobilityMatrixInverseType& inv_type, int* ipiv, double* rhs);
 
+    /*!
+     * \brief Compute solution using a factorized dense matrix stored in
+     * column-major order and store it in the rhs vector.
+     */
+    void computeSolution(double* mat_data,
+                         const int mat_size,
+                         const MobilityMatrixInverseType& inv_type,
+                         int* ipiv,
+                         double* rhs);
+
+    /*!
+     * \brief Apply the inverse of the block-diagonal approximation to the
+     * mobility matrix with the given handle to the rhs vector, which is only
+     * accessed on the managing processor.
+     *
+     * \note This is a collective operation.
+     */
+    void applyBlockMobilityInverse(const std::string& mat_name, double* rhs);
+
     // Solver stuff
     std::string d_object_name;
     bool d_is_initialized = false;
@@ -261,6 +292,12 @@ private:
     std::map<std::string, std::string> d_mat_filename_map;
     std::map<std::string, std::pair<std::vector<int>, std::vector<int> > > d_ipiv_map; // permutation matrices for LU
 
+    // Block-diagonal approximations of the mobility matrices.
+    std::map<std::string, bool> d_mat_use_blocks_map;
+    std::map<std::string, std::vector<std::vector<int> > > d_mat_block_nodes_map;
+    std::map<std::string, std::vector<std::vector<double> > > d_mat_block_data_map;
+    std::map<std::string, std::vector<std::vector<int> > > d_mat_block_ipiv_map;
+
     // PETSc representation of matrices.
     std::map<std::string, std::pair<Mat, Mat> > d_petsc_mat_map;
     std::map<std::string, Mat> d_petsc_geometric_mat_map;
@@ -273,6 +310,7 @@ private:
     // Parameters used in this class.
     double d_f_periodic_corr = 0.0;
     bool d_recompute_mob_mat = false;
+    unsigned int d_max_block_nodes = 0;
     double d_svd_replace_value, d_svd_eps;
 
 }; // DirectMobilitySolver
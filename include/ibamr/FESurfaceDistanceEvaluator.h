@@ -28,6 +28,7 @@
 #include "libmesh/boundary_mesh.h"
 
 #include <map>
+#include <set>
 #include <vector>
 
 /////////////////////////////// CLASS DEFINITION /////////////////////////////
@@ -70,6 +71,10 @@ public:
 
     /*!
      * \brief Get the map maintaining triangle-cell intersection and neighbors.
+     *
+     * \note The intersections are stored internally in a flat, per-patch
+     * format. The map is assembled from that data on the first call after
+     * mapIntersections().
      */
     const std::map<SAMRAI::pdat::CellIndex<NDIM>, std::set<libMesh::Elem*>, IBTK::CellIndexFortranOrder>&
     getNeighborIntersectionsMap();
@@ -150,6 +155,42 @@ private:
      */
     void collectNeighboringPatchElements(int level_number);
 
+    /*!
+     * \brief Node of a bounding volume hierarchy (BVH) of surface elements.
+     * Children of a node always have larger indices than the node itself.
+     */
+    struct BVHNode
+    {
+        IBTK::Vector3d lower, upper;
+        int left = -1, right = -1;
+        int elem_begin = 0, elem_end = 0;
+    };
+
+    /*!
+     * \brief Bounding volume hierarchy of the surface elements collected for a
+     * single patch.
+     */
+    struct ElemBVH
+    {
+        // Elements used to construct the hierarchy, in the order in which they
+        // were collected.
+        std::vector<libMesh::Elem*> elems;
+
+        // Elements sorted so that the elements of each leaf are contiguous.
+        std::vector<libMesh::Elem*> sorted_elems;
+
+        std::vector<BVHNode> nodes;
+    };
+
+    /*!
+     * \brief Update the bounding volume hierarchy for a set of elements.
+     *
+     * If the hierarchy was built for the same set of elements, the bounding
+     * boxes are refit to the current nodal positions. Otherwise, the hierarchy
+     * is rebuilt from scratch.
+     */
+    static void updateElemBVH(ElemBVH& bvh, const std::vector<libMesh::Elem*>& elems);
+
     /*!
      * \brief Compute the closest point on a triangle for a given Eulerian point P and obtain
      * its corresponding angle-weighted pseudo-normal from the surface mesh elements.
@@ -198,12 +239,27 @@ private:
     std::vector<std::vector<libMesh::Elem*> > d_active_neighbor_patch_bdry_elem_map;
 
     /*!
-     * Map object keeping track of element-cell intersections as well as elements intersecting that cell
-     * and its neighboring cells within the ghost cell width. Note that the elements contained in thie
-     * map belong to the original solid mesh.
+     * Bounding volume hierarchies of the elements in d_active_neighbor_patch_bdry_elem_map.
+     */
+    std::vector<ElemBVH> d_patch_elem_bvh;
+
+    /*!
+     * Data keeping track of element-cell intersections as well as elements intersecting that cell
+     * and its neighboring cells within the ghost cell width, stored in compressed sparse row format
+     * for each local patch. The elements intersecting the k-th cell of the patch box (in the order
+     * of Box<NDIM>::Iterator) are stored in positions d_patch_cell_elem_offsets[p][k] to
+     * d_patch_cell_elem_offsets[p][k + 1] - 1 of d_patch_cell_elems[p]. The offsets are empty for
+     * patches without intersections. Note that the elements belong to the original solid mesh.
+     */
+    std::vector<std::vector<int> > d_patch_cell_elem_offsets;
+    std::vector<std::vector<libMesh::Elem*> > d_patch_cell_elems;
+
+    /*!
+     * Map object assembled from the above data by getNeighborIntersectionsMap().
      */
     std::map<SAMRAI::pdat::CellIndex<NDIM>, std::set<libMesh::Elem*>, IBTK::CellIndexFortranOrder>
         d_cell_elem_neighbor_map;
+    bool d_cell_elem_neighbor_map_is_current = false;
 
     /*!
      * Map the node and the set of elements sharing this node.
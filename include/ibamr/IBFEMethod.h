@@ -274,18 +274,39 @@ class IBFEDirectForcingKinematics;
  * <code>FALSE</code>) turns on the scratch hierarchy and the remaining
  * parameters determine how patches are generated and load balanced. The extra
  * argument <code>type</code> to <code>LoadBalancer</code> specifies whether
- * an IBTK::MergingLoadBalancer (chosen by <code>"MERGING"</code>) or the
+ * an IBTK::MergingLoadBalancer (chosen by <code>"MERGING"</code>), an
+ * IBTK::HilbertLoadBalancer (chosen by <code>"HILBERT"</code>), or the
  * default SAMRAI LoadBalancer (chosen by <code>"DEFAULT"</code>) is
  * used. Since IBTK::MergingLoadBalancer is usually what one wants
  * <code>"MERGING"</code> is the default. The merging option is better since
  * it reduces the total number of elements which end up in patch ghost
- * regions since some patches will be merged together.
+ * regions since some patches will be merged together. The Hilbert option
+ * instead assigns contiguous segments of a space-filling curve to each
+ * processor, which keeps the patches on each processor close together.
  *
  * The parameter <code>workload_quad_point_weight</code> is the multiplier
  * assigned to an IB point when calculating the work per processor: in the
  * future additional weights, such as <code>workload_node_point_weight</code>
  * will also be added.
  *
+ * <h2>Options Controlling Force Computation</h2>
+ * <ul>
+ *   <li><code>num_force_assembly_threads</code>: the number of threads used
+ *   to assemble the right-hand side of the interior elastic force density
+ *   from the PK1 stress functions. Each thread evaluates the stress functions
+ *   on a contiguous block of local elements with its own finite element
+ *   objects and accumulates into its own buffer; the buffers are summed in a
+ *   fixed order, so results are deterministic for a fixed number of threads.
+ *   When this is greater than one, registered PK1 stress functions must be
+ *   safe to call concurrently. Defaults to <code>1</code>.</li>
+ * </ul>
+ *
+ * <h2>Options Controlling Spreading and Interpolation</h2>
+ * If the input database contains a sub-database named
+ * <code>LEInteractor</code>, it is passed to
+ * IBTK::LEInteractor::setFromDatabase(). See that function for the available
+ * options (number of threads, kernel implementation, and interaction plans).
+ *
  * <h2>Options Controlling Logging</h2>
  * The logging options set by this class are propagated to the owned
  * IBTK::FEDataManager objects.
@@ -429,6 +450,15 @@ public:
      */
     using PK1StressFcnPtr = IBTK::TensorMeshFcnPtr;
 
+    /*!
+     * Typedef specifying the interface for a batched PK1 stress function,
+     * which computes the stress at all quadrature points of an element in one
+     * call.  Batched functions allow constitutive models to be written as
+     * loops over contiguous arrays of deformation gradients that the compiler
+     * can vectorize.
+     */
+    using PK1StressBatchFcnPtr = IBTK::TensorMeshBatchFcnPtr;
+
     /*!
      * Struct encapsulating PK1 stress tensor function data.
      */
@@ -443,7 +473,54 @@ public:
         {
         }
 
-        PK1StressFcnPtr fcn;
+        PK1StressFcnData(PK1StressBatchFcnPtr batch_fcn,
+                         const std::vector<IBTK::SystemData>& system_data = std::vector<IBTK::SystemData>(),
+                         void* const ctx = nullptr,
+                         const libMesh::QuadratureType& quad_type = libMesh::INVALID_Q_RULE,
+                         const libMesh::Order& quad_order = libMesh::INVALID_ORDER)
+            : batch_fcn(batch_fcn), system_data(system_data), ctx(ctx), quad_type(quad_type), quad_order(quad_order)
+        {
+        }
+
+        /*!
+         * \return Whether either a pointwise or a batched stress function has
+         * been provided.
+         */
+        bool hasStressFunction() const
+        {
+            return fcn || batch_fcn;
+        }
+
+        /*!
+         * Evaluate the stress at a single point.  A batched stress function is
+         * called with a batch containing only this point.
+         */
+        void evaluate(libMesh::TensorValue<double>& PP,
+                      const libMesh::TensorValue<double>& FF,
+                      const libMesh::Point& x,
+                      const libMesh::Point& X,
+                      libMesh::Elem* elem,
+                      const std::vector<const std::vector<double>*>& var_data,
+                      const std::vector<const std::vector<libMesh::VectorValue<double> >*>& grad_var_data,
+                      double data_time) const;
+
+        /*!
+         * Evaluate the stress at all n_points quadrature points of an element.
+         * A pointwise stress function is called once for each point.
+         */
+        void evaluateBatch(
+            libMesh::TensorValue<double>* PP,
+            const libMesh::TensorValue<double>* FF,
+            const libMesh::Point* x,
+            const libMesh::Point* X,
+            unsigned int n_points,
+            libMesh::Elem* elem,
+            const std::vector<std::vector<const std::vector<double>*> >& var_data,
+            const std::vector<std::vector<const std::vector<libMesh::VectorValue<double> >*> >& grad_var_data,
+            double data_time) const;
+
+        PK1StressFcnPtr fcn = nullptr;
+        PK1StressBatchFcnPtr batch_fcn = nullptr;
         std::vector<IBTK::SystemData> system_data;
         void* ctx;
         libMesh::QuadratureType quad_type;
@@ -1246,6 +1323,7 @@ protected:
     std::vector<IBTK::FEDataManager::SpreadSpec> d_spread_spec;
     bool d_split_normal_force = false, d_split_tangential_force = false;
     bool d_use_jump_conditions = false;
+    int d_num_force_assembly_threads = 1;
     std::vector<libMesh::FEFamily> d_fe_family;
     std::vector<libMesh::Order> d_fe_order;
     std::vector<libMesh::QuadratureType> d_default_quad_type;
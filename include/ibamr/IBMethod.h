@@ -83,6 +83,12 @@ namespace IBAMR
  * \brief Class IBMethod is an implementation of the abstract base class
  * IBImplicitStrategy that provides functionality required by the standard IB
  * method.
+ *
+ * If the input database contains a sub-database named
+ * <code>LEInteractor</code>, it is passed to
+ * IBTK::LEInteractor::setFromDatabase() to select the number of threads, the
+ * kernel implementation, and whether interaction plans are cached for
+ * spreading and interpolation.
  */
 class IBMethod : public IBImplicitStrategy
 {
@@ -540,6 +546,8 @@ protected:
     IBTK::LDataManager* d_l_data_manager;
     std::string d_interp_kernel_fcn = "IB_4", d_spread_kernel_fcn = "IB_4";
     bool d_error_if_points_leave_domain = false;
+    bool d_sort_local_nodes = false;
+    bool d_incremental_redistribution = true;
     SAMRAI::hier::IntVector<NDIM> d_ghosts;
 
     /*
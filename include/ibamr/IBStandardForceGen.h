@@ -187,6 +187,10 @@ private:
         std::vector<SpringForceFcnPtr> force_fcns;
         std::vector<SpringForceDerivFcnPtr> force_deriv_fcns;
         std::vector<const double*> parameters;
+
+        // Springs that use the default linear force function are stored
+        // first so that they may be evaluated without indirect function calls.
+        int num_default_springs = 0;
     };
     std::vector<SpringData> d_spring_data;
 
@@ -405,6 +405,31 @@ namespace IBAMR
  D2_x_2   D2_y_2   D2_z_2  # coordinates of director D2 associated with vertex 2
  ...
  \endverbatim
+ *
+ * <HR>
+ *
+ * <B>Binary vertex and spring file formats</B>
+ *
+ * If the input database entry <TT>use_binary_files</TT> is set to TRUE, vertex
+ * and spring data are instead read from files with the extensions
+ * <TT>".vertex.bin"</TT> and <TT>".spring.bin"</TT>.  Each MPI process reads
+ * a contiguous slice of the vertex coordinates, and the slices are gathered on
+ * all processes.  Because spring records do not have a fixed size, each spring
+ * file is read once, by MPI process 0, and its contents are broadcast to the
+ * other processes.  File batons are not used for binary files.  The files may be
+ * generated from the ASCII formats described above by the script
+ * <TT>scripts/IB/convert_to_binary.pl</TT>.  All values are stored in the
+ * native byte order of the machine using 32-bit integers and 64-bit floating
+ * point values:
+ \verbatim
+ "IBVERTEX"  NDIM  N                         # 8-character tag, spatial dimension, number of vertices
+ x_0  y_0  (z_0)  x_1  y_1  (z_1)  ...       # vertex coordinates
+ \endverbatim
+ \verbatim
+ "IBSPRING"  M                               # 8-character tag, number of links
+ i_0  j_0  fcn_idx_0  P_0  p_0  p_1  ...     # vertex indices, force function index, number of
+ ...                                         # parameters (P >= 2), and the parameters
+ \endverbatim
 */
 class IBStandardInitializer : public IBAMR::IBRedundantInitializer
 {
@@ -467,11 +492,38 @@ private:
      */
     void readVertexFiles(const std::string& extension);
 
+    /*!
+     * \brief Read the vertex data for a single structure from a binary input
+     * file.  Each MPI process reads a contiguous slice of the vertices.
+     */
+    void readBinaryVertexFile(const std::string& vertex_filename, int ln, int j);
+
     /*!
      * \brief Read the spring data from one or more input files.
      */
     void readSpringFiles(const std::string& file_extension, bool input_uses_global_idxs);
 
+    /*!
+     * \brief Read the spring data for a single structure from a binary input
+     * file.
+     */
+    void readBinarySpringFile(const std::string& spring_filename, int ln, int j, bool input_uses_global_idxs);
+
+    /*!
+     * \brief Add a spring to the data associated with a single structure,
+     * applying any uniform values specified in the input database.
+     *
+     * \return Whether the spring was added (i.e., it is not a duplicate).
+     */
+    bool addSpring(Edge e,
+                   std::vector<double> parameters,
+                   int force_fcn_idx,
+                   int ln,
+                   int j,
+                   bool input_uses_global_idxs,
+                   const std::string& spring_filename,
+                   bool& warned);
+
     /*!
      * \brief Read the crosslink spring ("x-spring") data from one or more input
      * files.
@@ -539,6 +591,12 @@ private:
      */
     bool d_use_file_batons = true;
 
+    /*
+     * The boolean value determines whether vertex and spring data are read
+     * from binary input files.
+     */
+    bool d_use_binary_files = false;
+
     /*
      * The maximum number of levels in the Cartesian grid patch hierarchy and a
      * vector of boolean values indicating whether a particular level has been
@@ -16,6 +16,8 @@
 
 /////////////////////////////// INCLUDES ///////////////////////////////////////
 
+#include "ibamr/WaveUtilities.h"
+
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/muParserRobinBcCoefs.h"
 
@@ -215,6 +217,11 @@ private:
      * Number of interface cells.
      */
     double d_num_interface_cells;
+
+    /*!
+     * Component waves used to evaluate the surface elevation and velocity.
+     */
+    IrregularWaveComponents d_wave_components;
 };
 } // namespace IBAMR
 
@@ -115,6 +115,11 @@ private:
     /// Phase (random) of component waves [rad].
     ///
     std::vector<double> d_phase;
+
+    ///
+    /// Evaluation of the sums over the component waves.
+    ///
+    IrregularWaveComponents d_wave_components;
 };
 
 } // namespace IBAMR
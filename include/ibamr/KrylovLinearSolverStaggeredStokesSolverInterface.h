@@ -71,6 +71,13 @@ public:
      */
     void setVelocityPoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& U_problem_coefs) override;
 
+    /*!
+     * \brief Reset the PoissonSpecifications object used by the operator and
+     * preconditioner without reinitializing the solver.  The operator is
+     * evaluated matrix-free, so the update is delegated to the preconditioner.
+     */
+    bool updateVelocityPoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& U_problem_coefs) override;
+
     /*!
      * \brief Set if velocity and pressure have nullspace.
      */
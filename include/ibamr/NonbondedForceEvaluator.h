@@ -64,17 +64,53 @@ public:
     // parameters are passed in the double* params.
     using NonBddForceFcnPtr = void (*)(double* D, const SAMRAI::tbox::Array<double> params, double* out_force);
 
-    // Class constructor.
+    // Class constructor.  The following input keys are read from input_db:
+    //
+    //   interaction_radius: the interaction radius, in units of the (smallest)
+    //                       grid spacing of the level.  Must be positive.  The
+    //                       force function is evaluated only for pairs of nodes
+    //                       (or periodic images of nodes) that are no farther
+    //                       apart than this distance.  Previous versions of
+    //                       this class also passed pairs in nearby cells that
+    //                       were beyond this distance to the force function,
+    //                       so force functions must not rely on being called
+    //                       for such pairs.
+    //   regrid_alpha:       the regrid parameter used by the integrator, in
+    //                       grid cells.
+    //   skin:               optional neighbor list skin distance, in grid
+    //                       cells (default 0).  When positive, the list of
+    //                       interacting pairs is reused until some node has
+    //                       moved more than skin/2 since the list was built.
+    //   parameters:         parameters passed to the force function.
     NonbondedForceEvaluator(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db,
                             SAMRAI::tbox::Pointer<SAMRAI::geom::CartesianGridGeometry<NDIM> > grid_geometry);
 
-    // Function to evaluate forces.
+    // Function to evaluate the force between a single pair of nodes.  This
+    // acquires and restores the PETSc arrays of X_data and F_data, so it should
+    // not be used inside of loops over pairs.
     void evaluateForces(int mstr_petsc_idx,
                         int search_petsc_idx,
                         SAMRAI::tbox::Pointer<IBTK::LData> X_data,
-                        std::vector<int> cell_offset,
+                        const std::vector<int>& cell_offset,
                         SAMRAI::tbox::Pointer<IBTK::LData> F_data);
 
+    // Function to evaluate the force between a single pair of nodes using raw
+    // (ghosted local form) position and force arrays.  periodic_shift is the
+    // physical displacement of the periodic image of the search node.
+    void evaluateForces(int mstr_petsc_idx,
+                        int search_petsc_idx,
+                        const double* X,
+                        const double* periodic_shift,
+                        double* F) const;
+
+    // Invalidate the cached neighbor list on the specified level.  This is
+    // called whenever the Lagrangian data are redistributed.
+    void initializeLevelData(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                             int level_number,
+                             double init_data_time,
+                             bool initial_time,
+                             IBTK::LDataManager* l_data_manager) override;
+
     // Implementation of computeLagrangianForce.
     void computeLagrangianForce(SAMRAI::tbox::Pointer<IBTK::LData> F_data,
                                 SAMRAI::tbox::Pointer<IBTK::LData> X_data,
@@ -97,12 +133,45 @@ private:
     // Assignment operator, not implemented.
     NonbondedForceEvaluator& operator=(const NonbondedForceEvaluator& that) = delete;
 
-    // interaction radius:
+    // Verlet list of the interacting pairs on a single level.  Pairs are
+    // stored once (Newton's third law is applied when the forces are
+    // evaluated) in terms of ghosted local PETSc indices, along with the
+    // physical displacement of the periodic image of the second node.
+    struct NeighborList
+    {
+        bool valid = false;
+        double dx_min = 0.0;
+        std::vector<int> pairs;
+        std::vector<double> periodic_shifts;
+        std::vector<double> X_ref;
+    };
+
+    // Determine whether the neighbor list on the given level can be reused
+    // with the given positions.
+    bool neighborListIsValid(int level_number, const double* X, int num_ghosted_nodes) const;
+
+    // Rebuild the neighbor list on the given level using a linked-cell
+    // binning of the nodes on each local patch.
+    void buildNeighborList(const double* X,
+                           int num_ghosted_nodes,
+                           SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                           int level_number,
+                           IBTK::LDataManager* l_data_manager);
+
+    // interaction radius, in units of the grid spacing:
     double d_interaction_radius;
 
     // regrid_alpha, for computing buffer to add to interactions:
     double d_regrid_alpha;
 
+    // neighbor list skin distance, in units of the grid spacing.  Neighbor
+    // lists are reused until some node has moved more than half of this
+    // distance.
+    double d_skin = 0.0;
+
+    // neighbor lists, indexed by level number:
+    std::vector<NeighborList> d_neighbor_lists;
+
     // parameters for force function:
     SAMRAI::tbox::Array<double> d_parameters;
 
@@ -111,7 +180,7 @@ private:
 
     // spring force function pointer, to evaluate the force between particles:
     // TODO: Add species, make this a map from species1 x species2 -> Force Function Pointer
-    NonBddForceFcnPtr d_force_fcn_ptr;
+    NonBddForceFcnPtr d_force_fcn_ptr = nullptr;
 };
 } // namespace IBAMR
 
@@ -75,6 +75,16 @@ public:
      */
     virtual void setVelocitySubdomainSolver(SAMRAI::tbox::Pointer<IBTK::PoissonSolver> velocity_solver);
 
+    /*!
+     * \brief Indicate whether the object that provided the velocity subdomain
+     * solver also updates its coefficients.
+     *
+     * In that case, updateVelocityPoissonSpecifications() does not forward the
+     * new coefficients to the velocity subdomain solver, which would otherwise
+     * update the solver a second time.
+     */
+    void setVelocitySubdomainSolverUpdatedExternally(bool updated_externally);
+
     /*!
      * \brief Set the PoissonSpecifications object used to specify the
      * coefficients for the momentum equation in the incompressible Stokes
@@ -82,6 +92,17 @@ public:
      */
     void setVelocityPoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& U_problem_coefs) override;
 
+    /*!
+     * \brief Reset the PoissonSpecifications object without reinitializing the
+     * preconditioner.
+     *
+     * \note The block preconditioners evaluate the momentum coefficients when
+     * they are applied, so the preconditioner state remains valid if the state
+     * of the velocity subdomain solver does.  The coefficients are not
+     * forwarded to a velocity subdomain solver that is updated externally.
+     */
+    bool updateVelocityPoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& U_problem_coefs) override;
+
     /*!
      * \brief Indicate whether the preconditioner needs a pressure subdomain
      * solver.
@@ -160,6 +181,7 @@ protected:
     // Subdomain solvers.
     const bool d_needs_velocity_solver;
     SAMRAI::tbox::Pointer<IBTK::PoissonSolver> d_velocity_solver;
+    bool d_velocity_solver_updated_externally = false;
     SAMRAI::solv::PoissonSpecifications d_P_problem_coefs;
     const bool d_needs_pressure_solver;
     SAMRAI::tbox::Pointer<IBTK::PoissonSolver> d_pressure_solver;
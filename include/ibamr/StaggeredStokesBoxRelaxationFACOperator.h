@@ -16,14 +16,13 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include "ibamr/StaggeredStokesFACPreconditioner.h"
 #include "ibamr/StaggeredStokesFACPreconditionerStrategy.h"
+#include "ibamr/StaggeredStokesSolver.h"
 
+#include "tbox/Database.h"
 #include "tbox/Pointer.h"
 
-#include "petscksp.h"
-#include "petscmat.h"
-#include "petscvec.h"
-
 #include <array>
 #include <string>
 #include <vector>
@@ -54,6 +53,20 @@ namespace IBAMR
  * \brief Class StaggeredStokesBoxRelaxationFACOperator is a concrete
  * StaggeredStokesFACPreconditionerStrategy implementing a box relaxation
  * (Vanka-type) smoother for use as a multigrid preconditioner.
+ *
+ * Each box consists of the velocity and pressure unknowns of a single cell.
+ * Because the problem coefficients are constant, the inverse of the local box
+ * operator is computed once per level, and the box solves of a patch are
+ * performed in batches of dense matrix-vector products.
+ *
+ * The smoother type determines the order in which the boxes are relaxed:
+ * \verbatim
+
+ smoother_type = "MULTIPLICATIVE"  // colored Gauss-Seidel sweeps (default)
+ smoother_type = "ADDITIVE"        // Jacobi sweeps; corrections to shared faces are averaged
+ \endverbatim
+ *
+ * Additive sweeps do not depend on the order in which the boxes are visited.
  */
 class StaggeredStokesBoxRelaxationFACOperator : public StaggeredStokesFACPreconditionerStrategy
 {
@@ -70,6 +83,28 @@ public:
      */
     ~StaggeredStokesBoxRelaxationFACOperator();
 
+    /*!
+     * \brief Static function to construct a StaggeredStokesFACPreconditioner with a
+     * StaggeredStokesBoxRelaxationFACOperator FAC strategy.
+     */
+    static SAMRAI::tbox::Pointer<StaggeredStokesSolver>
+    allocate_solver(const std::string& object_name,
+                    SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db,
+                    const std::string& default_options_prefix)
+    {
+        SAMRAI::tbox::Pointer<StaggeredStokesFACPreconditionerStrategy> fac_operator =
+            new StaggeredStokesBoxRelaxationFACOperator(
+                object_name + "::StaggeredStokesBoxRelaxationFACOperator", input_db, default_options_prefix);
+        return new StaggeredStokesFACPreconditioner(object_name, fac_operator, input_db, default_options_prefix);
+    } // allocate_solver
+
+    /*!
+     * \brief Reset the momentum coefficients of an initialized operator.
+     *
+     * The inverses of the local box operators are recomputed in place.
+     */
+    bool updateVelocityPoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& U_problem_coefs) override;
+
     /*!
      * \name Implementation of FACPreconditionerStrategy interface.
      */
@@ -141,11 +176,10 @@ private:
     StaggeredStokesBoxRelaxationFACOperator& operator=(const StaggeredStokesBoxRelaxationFACOperator& that) = delete;
 
     /*
-     * Box operator data.
+     * Inverses of the local box operators on each level, stored in row-major
+     * order.
      */
-    std::vector<Mat> d_box_op;
-    std::vector<Vec> d_box_e, d_box_r;
-    std::vector<KSP> d_box_ksp;
+    std::vector<std::vector<double> > d_box_inv;
 
     /*
      * Mappings from patch indices to patch operators.
@@ -78,6 +78,12 @@ public:
      */
     void setVelocityPoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& U_problem_coefs) override;
 
+    /*!
+     * \brief Reset the PoissonSpecifications object used by the FAC strategy
+     * without reinitializing the preconditioner.
+     */
+    bool updateVelocityPoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& U_problem_coefs) override;
+
     /*!
      * \brief Set if velocity and pressure have nullspace.
      */
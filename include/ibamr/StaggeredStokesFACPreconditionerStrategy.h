@@ -118,6 +118,21 @@ public:
      */
     virtual void setVelocityPoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& U_problem_coefs);
 
+    /*!
+     * \brief Reset the PoissonSpecifications object used by an initialized
+     * operator.
+     *
+     * The residual is evaluated using the current coefficients, so the base
+     * class implementation only needs to update the coarse level solver.
+     * Subclasses that cache coefficient-dependent data must also override this
+     * function.
+     *
+     * \return \p true if the hierarchy-dependent operator state is consistent
+     * with the new coefficients, or \p false if the operator state must be
+     * reinitialized.
+     */
+    virtual bool updateVelocityPoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& U_problem_coefs);
+
     /*!
      * \brief Set if velocity and pressure have nullspace.
      */
@@ -91,6 +91,12 @@ public:
         return new StaggeredStokesFACPreconditioner(object_name, fac_operator, input_db, default_options_prefix);
     } // allocate_solver
 
+    /*!
+     * \brief Reset the momentum coefficients of an initialized operator by
+     * updating the coarse level solver and each of the level solvers.
+     */
+    bool updateVelocityPoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& U_problem_coefs) override;
+
     /*!
      * \name Implementation of FACPreconditionerStrategy interface.
      */
@@ -86,6 +86,16 @@ public:
         return new StaggeredStokesPETScLevelSolver(object_name, input_db, default_options_prefix);
     } // allocate_solver
 
+    /*!
+     * \brief Reset the momentum coefficients of an initialized solver.
+     *
+     * The MAC Stokes matrix is reassembled and its values are copied into the
+     * existing PETSc matrix, so that the DOF indexing, subdomain index sets,
+     * scatters, and KSP objects are all reused.  Only the preconditioner is
+     * recomputed.
+     */
+    bool updateVelocityPoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& U_problem_coefs) override;
+
 protected:
     /*!
      * \brief Generate IS/subdomains for Schwartz type preconditioners.
@@ -63,6 +63,18 @@ public:
      */
     virtual void setVelocityPoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& U_problem_coefs);
 
+    /*!
+     * \brief Reset the PoissonSpecifications object used to specify the
+     * coefficients for the momentum equation without reinitializing the
+     * solver, e.g., when only the time step size has changed.
+     *
+     * \return \p true if the solver state is consistent with the new
+     * coefficients, or \p false if initializeSolverState() must be called
+     * before the solver is next used.  The default implementation returns \p
+     * true only if the solver is not initialized.
+     */
+    virtual bool updateVelocityPoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& U_problem_coefs);
+
     /*!
      * \brief Set if velocity and pressure have nullspace.
      */
@@ -25,7 +25,12 @@
 #include "VariableContext.h"
 #include "tbox/Pointer.h"
 
+#include <cstddef>
+#include <list>
+#include <map>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace IBAMR
 {
@@ -96,6 +101,128 @@ struct WaveDampingData
 
 }; // WaveDampingData
 
+/*!
+ * \brief Class IrregularWaveComponents evaluates the surface elevation and the
+ * velocity of an irregular wave that is a superposition of linear component
+ * waves.
+ *
+ * The phase factors of the component waves are cached for the most recently
+ * used times, and for each of those times, for the requested horizontal
+ * positions. The depth profiles of the component waves are cached for the
+ * requested vertical positions. The number of cached times and the number of
+ * cached positions are bounded. Once the cache for a time (or the depth
+ * profile cache) holds the maximum number of positions, it is emptied.
+ */
+class IrregularWaveComponents
+{
+public:
+    /*!
+     * \brief Default constructor.
+     */
+    IrregularWaveComponents() = default;
+
+    /*!
+     * \brief Set the water depth and the amplitudes, wave numbers, angular
+     * frequencies, and phases of the component waves. This discards all
+     * cached values.
+     */
+    void setComponentWaves(double depth,
+                           const std::vector<double>& amplitude,
+                           const std::vector<double>& wave_number,
+                           const std::vector<double>& omega,
+                           const std::vector<double>& phase);
+
+    /*!
+     * \brief Set the maximum number of cached times and the maximum number of
+     * cached positions. Setting either one to zero disables caching. This
+     * discards all cached values.
+     */
+    void setCacheSizes(std::size_t max_cached_times, std::size_t max_cached_positions);
+
+    /*!
+     * \brief Get the surface elevation at a specified horizontal position and
+     * time.
+     */
+    double getSurfaceElevation(double x, double time) const;
+
+    /*!
+     * \brief Get the horizontal (\a comp_idx = 0) or vertical (\a comp_idx = 1)
+     * velocity at a specified position and time.
+     */
+    double getVelocity(double x, double z_plus_d, double time, int comp_idx) const;
+
+private:
+    /*!
+     * Phase factors of the component waves at a fixed horizontal position and
+     * time, along with the resulting surface elevation.
+     */
+    struct PhaseFactors
+    {
+        std::vector<double> cos_theta, sin_theta;
+        double eta;
+    };
+
+    /*!
+     * Depth profiles of the horizontal and vertical velocities of the
+     * component waves at a fixed vertical position, including the amplitude
+     * factors \f$ a \omega / \sinh(k d) \f$.
+     */
+    struct DepthProfiles
+    {
+        std::vector<double> cosh_profile, sinh_profile;
+    };
+
+    /*!
+     * Get the (possibly cached) phase factors at a specified horizontal
+     * position and time.
+     */
+    const PhaseFactors& getPhaseFactors(double x, double time) const;
+
+    /*!
+     * Get the (possibly cached) depth profiles at a specified vertical
+     * position.
+     */
+    const DepthProfiles& getDepthProfiles(double z_plus_d) const;
+
+    /*!
+     * Compute the phase factors at a specified horizontal position and time.
+     */
+    void computePhaseFactors(PhaseFactors& factors, double x, double time) const;
+
+    /*!
+     * Compute the depth profiles at a specified vertical position.
+     */
+    void computeDepthProfiles(DepthProfiles& profiles, double z_plus_d) const;
+
+    /*!
+     * Water depth and parameters of the component waves.
+     */
+    double d_depth = 0.0;
+    std::vector<double> d_amplitude, d_wave_number, d_omega, d_phase;
+
+    /*!
+     * Cache sizes.
+     */
+    std::size_t d_max_cached_times = 3, d_max_cached_positions = 4096;
+
+    /*!
+     * Cached phase factors, indexed by time and then by horizontal position.
+     * The most recently used time is at the front of the list.
+     */
+    mutable std::list<std::pair<double, std::map<double, PhaseFactors> > > d_phase_factors;
+
+    /*!
+     * Cached depth profiles, indexed by vertical position.
+     */
+    mutable std::map<double, DepthProfiles> d_depth_profiles;
+
+    /*!
+     * Storage for values that are computed when caching is disabled.
+     */
+    mutable PhaseFactors d_uncached_phase_factors;
+    mutable DepthProfiles d_uncached_depth_profiles;
+}; // IrregularWaveComponents
+
 } // namespace IBAMR
 
 #endif // #ifndef included_WaveUtilities
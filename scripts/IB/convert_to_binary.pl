@@ -0,0 +1,86 @@
+#!/usr/bin/perl -w
+## ---------------------------------------------------------------------
+##
+## Copyright (c) 2019 - 2019 by the IBAMR developers
+## All rights reserved.
+##
+## This file is part of IBAMR.
+##
+## IBAMR is free software and is distributed under the 3-clause BSD
+## license. The full text of the license can be found in the file
+## COPYRIGHT at the top level directory of IBAMR.
+##
+## ---------------------------------------------------------------------
+
+#
+# filename: convert_to_binary.pl
+# usage: convert_to_binary.pl <spatial dimension> <input filename>
+#
+# A simple Perl script to convert an ASCII IBAMR vertex (.vertex) or spring
+# (.spring) input file into the binary format read by IBStandardInitializer
+# when use_binary_files = TRUE.  The output is written to <input filename>.bin
+# using the native byte order of the machine.
+
+use strict;
+
+if ($#ARGV != 1) {
+    die "incorrect number of command line arguments.\nusage:\n  convert_to_binary.pl <spatial dimension> <input filename>\n";
+}
+
+# parse the command line arguments
+my $ndim = shift @ARGV;  chomp $ndim;
+my $input_filename = shift @ARGV;  chomp $input_filename;
+my $output_filename = "$input_filename.bin";
+
+if (($ndim != 2) && ($ndim != 3)) {
+    die "error: spatial dimension must be 2 or 3\n";
+}
+
+print "input file: $input_filename\n";
+print "output file: $output_filename\n";
+
+open(IN, "$input_filename") || die "error: cannot open $input_filename for reading: $!";
+open(OUT, ">$output_filename") || die "error: cannot open $output_filename for writing: $!";
+binmode OUT;
+
+# return the next line of the input file with comments removed
+sub next_line {
+    my $line = <IN>;
+    defined($line) || die "error: premature end of input file $input_filename\n";
+    chomp $line;
+    $line =~ s/[!#%].*//;
+    return split(' ', $line);
+}
+
+my @line = next_line();
+my $n = $line[0];
+($n =~ /^\d+$/ && $n > 0) || die "error: invalid number of entries on line 1 of $input_filename\n";
+
+if ($input_filename =~ /\.vertex$/) {
+    print OUT pack("a8 l l", "IBVERTEX", $ndim, $n);
+    for (my $k = 0; $k < $n; $k++) {
+        @line = next_line();
+        ($#line + 1 >= $ndim) || die "error: invalid entry on line " . ($k + 2) . " of $input_filename\n";
+        print OUT pack("d$ndim", @line[0 .. $ndim - 1]);
+    }
+    print "converted $n vertices\n";
+}
+elsif ($input_filename =~ /\.spring$/) {
+    print OUT pack("a8 l", "IBSPRING", $n);
+    for (my $k = 0; $k < $n; $k++) {
+        @line = next_line();
+        ($#line + 1 >= 4) || die "error: invalid entry on line " . ($k + 2) . " of $input_filename\n";
+        my ($i, $j, $kappa, $length, $fcn_idx, @params) = @line;
+        $fcn_idx = 0 if (!defined($fcn_idx));
+        my $num_params = 2 + ($#params + 1);
+        print OUT pack("l l l l", $i, $j, $fcn_idx, $num_params);
+        print OUT pack("d*", $kappa, $length, @params);
+    }
+    print "converted $n springs\n";
+}
+else {
+    die "error: input file must have the extension .vertex or .spring\n";
+}
+
+close(IN);
+close(OUT);
@@ -64,7 +64,11 @@ IBTK_ENABLE_EXTRA_WARNINGS
 
 #include <algorithm>
 #include <istream>
+#include <limits>
 #include <memory>
+#include <numeric>
+#include <utility>
+#include <vector>
 
 namespace IBTK
 {
@@ -88,6 +92,56 @@ class RefineSchedule;
 
 namespace IBAMR
 {
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Split the nodes in the range [begin, end) into spatially compact clusters of
+// at most max_cluster_nodes nodes by recursive coordinate bisection.  The
+// result depends only on the node positions, so that all processors compute
+// the same clusters.
+void
+bisect_nodes(const double* const X,
+             const std::vector<int>::iterator begin,
+             const std::vector<int>::iterator end,
+             const unsigned int max_cluster_nodes,
+             std::vector<std::vector<int> >& clusters)
+{
+    const auto num_nodes = static_cast<unsigned int>(end - begin);
+    if (num_nodes <= max_cluster_nodes)
+    {
+        clusters.emplace_back(begin, end);
+        std::sort(clusters.back().begin(), clusters.back().end());
+        return;
+    }
+
+    // Split along the longest edge of the bounding box of the nodes.
+    double X_min[NDIM], X_max[NDIM];
+    std::fill(X_min, X_min + NDIM, std::numeric_limits<double>::max());
+    std::fill(X_max, X_max + NDIM, std::numeric_limits<double>::lowest());
+    for (auto it = begin; it != end; ++it)
+    {
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            X_min[d] = std::min(X_min[d], X[*it * NDIM + d]);
+            X_max[d] = std::max(X_max[d], X[*it * NDIM + d]);
+        }
+    }
+    unsigned int axis = 0;
+    for (unsigned int d = 1; d < NDIM; ++d)
+    {
+        if (X_max[d] - X_min[d] > X_max[axis] - X_min[axis]) axis = d;
+    }
+    const auto mid = begin + num_nodes / 2;
+    std::nth_element(begin, mid, end, [X, axis](const int i, const int j) {
+        return std::make_pair(X[i * NDIM + axis], i) < std::make_pair(X[j * NDIM + axis], j);
+    });
+    bisect_nodes(X, begin, mid, max_cluster_nodes, clusters);
+    bisect_nodes(X, mid, end, max_cluster_nodes, clusters);
+    return;
+} // bisect_nodes
+} // namespace
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 CIBMethod::CIBMethod(std::string object_name,
@@ -1513,6 +1567,124 @@ CIBMethod::constructMobilityMatrix(const std::string& /*mat_name*/,
     return;
 } // constructMobilityMatrix
 
+void
+CIBMethod::constructMobilityMatrixBlocks(const std::string& /*mat_name*/,
+                                         MobilityMatrixType mat_type,
+                                         std::vector<std::vector<int> >& block_nodes,
+                                         std::vector<std::vector<double> >& block_mats,
+                                         const unsigned int max_block_nodes,
+                                         const std::vector<unsigned>& prototype_struct_ids,
+                                         const double* grid_dx,
+                                         const double* domain_extents,
+                                         const bool initial_time,
+                                         double rho,
+                                         double mu,
+                                         const std::pair<double, double>& scale,
+                                         double f_periodic_corr,
+                                         const int managing_rank)
+{
+    const double dt = d_new_time - d_current_time;
+    const int struct_ln = getStructuresLevelNumber();
+    const char* ib_kernel = d_l_data_manager->getDefaultInterpKernelFunction().c_str();
+    const int rank = SAMRAI_MPI::getRank();
+    const int n_nodes = SAMRAI_MPI::getNodes();
+
+    // Get the size of matrix.
+    unsigned num_nodes = 0;
+    for (const auto& prototype_struct_id : prototype_struct_ids)
+    {
+        num_nodes += getNumberOfNodes(prototype_struct_id);
+    }
+    int size = num_nodes * NDIM;
+
+    // Get the position and regulator data on all processors.
+    Vec X;
+    if (initial_time)
+    {
+        X = d_l_data_manager->getLData("X0_unshifted", struct_ln)->getVec();
+    }
+    else
+    {
+        std::vector<Pointer<LData> >* X_half_data;
+        bool* X_half_needs_ghost_fill;
+        getPositionData(&X_half_data, &X_half_needs_ghost_fill, d_half_time);
+        X = (*X_half_data)[struct_ln]->getVec();
+    }
+    Vec W = d_l_data_manager->getLData("regulator", struct_ln)->getVec();
+    std::vector<double> XW(2 * size);
+    copyVecToArray(X, XW.data(), prototype_struct_ids, /*depth*/ NDIM, managing_rank);
+    copyVecToArray(W, XW.data() + size, prototype_struct_ids, /*depth*/ NDIM, managing_rank);
+    int buffer_size = 2 * size;
+    SAMRAI_MPI::bcast(XW.data(), buffer_size, managing_rank);
+    const double* const X_data = XW.data();
+    const double* const W_data = XW.data() + size;
+
+    // Split the nodes into clusters and generate the blocks assigned to this
+    // processor.
+    std::vector<int> nodes(num_nodes);
+    std::iota(nodes.begin(), nodes.end(), 0);
+    std::vector<std::vector<int> > clusters;
+    bisect_nodes(X_data, nodes.begin(), nodes.end(), std::max(max_block_nodes, 1u), clusters);
+
+    block_nodes.clear();
+    block_mats.clear();
+    for (unsigned int k = 0; k < clusters.size(); ++k)
+    {
+        if (static_cast<int>((managing_rank + k) % n_nodes) != rank) continue;
+        const std::vector<int>& cluster = clusters[k];
+        const auto cluster_num_nodes = static_cast<int>(cluster.size());
+        const int block_size = cluster_num_nodes * NDIM;
+        std::vector<double> X_block(block_size);
+        for (int i = 0; i < cluster_num_nodes; ++i)
+        {
+            std::copy(X_data + cluster[i] * NDIM, X_data + (cluster[i] + 1) * NDIM, &X_block[i * NDIM]);
+        }
+
+        std::vector<double> block_mat(block_size * block_size);
+        if (mat_type == RPY)
+        {
+            MobilityFunctions::constructRPYMobilityMatrix(
+                ib_kernel, mu, grid_dx[0], X_block.data(), cluster_num_nodes, f_periodic_corr, block_mat.data());
+        }
+        else if (mat_type == EMPIRICAL)
+        {
+            MobilityFunctions::constructEmpiricalMobilityMatrix(ib_kernel,
+                                                                mu,
+                                                                rho,
+                                                                dt,
+                                                                grid_dx[0],
+                                                                X_block.data(),
+                                                                cluster_num_nodes,
+                                                                0,
+                                                                f_periodic_corr,
+                                                                domain_extents[0],
+                                                                block_mat.data());
+        }
+        else
+        {
+            TBOX_ERROR(
+                "CIBMethod::constructMobilityMatrixBlocks(): Invalid type of a "
+                "mobility matrix."
+                << std::endl);
+        }
+
+        // Regularize the block.
+        for (int i = 0; i < block_size; ++i)
+        {
+            for (int j = 0; j < block_size; ++j)
+            {
+                block_mat[i * block_size + j] *= scale.first;
+            }
+            block_mat[i * block_size + i] += scale.second * W_data[cluster[i / NDIM] * NDIM + i % NDIM];
+        }
+
+        block_nodes.push_back(cluster);
+        block_mats.push_back(std::move(block_mat));
+    }
+
+    return;
+} // constructMobilityMatrixBlocks
+
 void
 CIBMethod::constructGeometricMatrix(const std::string& /*mat_name*/,
                                     Mat& geometric_mat,
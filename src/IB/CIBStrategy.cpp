@@ -825,6 +825,27 @@ CIBStrategy::constructMobilityMatrix(const std::string& /*mat_name*/,
     return;
 } // constructMobilityMatrix
 
+void
+CIBStrategy::constructMobilityMatrixBlocks(const std::string& /*mat_name*/,
+                                           MobilityMatrixType /*mat_type*/,
+                                           std::vector<std::vector<int> >& /*block_nodes*/,
+                                           std::vector<std::vector<double> >& /*block_mats*/,
+                                           const unsigned int /*max_block_nodes*/,
+                                           const std::vector<unsigned>& /*prototype_struct_ids*/,
+                                           const double* /*grid_dx*/,
+                                           const double* /*domain_extents*/,
+                                           const bool /*initial_time*/,
+                                           double /*rho*/,
+                                           double /*mu*/,
+                                           const std::pair<double, double>& /*scale*/,
+                                           double /*f_periodic_corr*/,
+                                           const int /*managing_rank*/)
+{
+    // intentionally left blank.
+
+    return;
+} // constructMobilityMatrixBlocks
+
 void
 CIBStrategy::constructGeometricMatrix(const std::string& /*mat_name*/,
                                       Mat& /*geometric_mat*/,
@@ -78,6 +78,7 @@ IBTK_ENABLE_EXTRA_WARNINGS
 #include <algorithm>
 #include <limits>
 #include <utility>
+#include <vector>
 
 namespace SAMRAI
 {
@@ -177,6 +178,31 @@ find_struct_handle_position(itr begin, itr end, const T& value)
     return -1;
 }
 
+// Sum the given buffers over all processes using a single reduction.  The
+// buffers must be listed in the same order on all processes.
+void
+sum_reduction(const std::vector<std::pair<double*, int> >& buffers)
+{
+    int size = 0;
+    for (const auto& buffer : buffers) size += buffer.second;
+    if (size == 0) return;
+
+    std::vector<double> packed_buffer;
+    packed_buffer.reserve(size);
+    for (const auto& buffer : buffers)
+    {
+        packed_buffer.insert(packed_buffer.end(), buffer.first, buffer.first + buffer.second);
+    }
+    SAMRAI_MPI::sumReduction(packed_buffer.data(), size);
+    std::vector<double>::const_iterator it = packed_buffer.begin();
+    for (const auto& buffer : buffers)
+    {
+        std::copy(it, it + buffer.second, buffer.first);
+        it += buffer.second;
+    }
+    return;
+}
+
 #if (NDIM == 3)
 // Routine to solve 3X3 equation to get rigid body rotational velocity.
 inline void
@@ -972,15 +998,22 @@ ConstraintIBMethod::calculateCOMandMOIOfStructures()
         ptr_x_lag_data_new->restoreArrays();
     }
 
+    std::vector<std::pair<double*, int> > com_buffers;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        com_buffers.push_back(std::make_pair(d_center_of_mass_current[struct_no].data(),
+                                             static_cast<int>(d_center_of_mass_current[struct_no].size())));
+        com_buffers.push_back(std::make_pair(d_center_of_mass_new[struct_no].data(),
+                                             static_cast<int>(d_center_of_mass_new[struct_no].size())));
+        com_buffers.push_back(std::make_pair(tagged_position[struct_no].data(), 3));
+    }
+    sum_reduction(com_buffers);
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
         const int total_nodes = struct_param.getTotalNodes();
 
-        SAMRAI_MPI::sumReduction(d_center_of_mass_current[struct_no].data(),
-                                 d_center_of_mass_current[struct_no].size());
-        SAMRAI_MPI::sumReduction(d_center_of_mass_new[struct_no].data(), d_center_of_mass_new[struct_no].size());
-
         for (int i = 0; i < 3; ++i)
         {
             d_center_of_mass_current[struct_no][i] /= total_nodes;
@@ -990,7 +1023,6 @@ ConstraintIBMethod::calculateCOMandMOIOfStructures()
 
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        SAMRAI_MPI::sumReduction(&tagged_position[struct_no][0], 3);
         d_tagged_pt_position[struct_no] = tagged_position[struct_no];
     }
 
@@ -1092,15 +1124,17 @@ ConstraintIBMethod::calculateCOMandMOIOfStructures()
         ptr_x_lag_data_new->restoreArrays();
     } // all levels
 
+    std::vector<std::pair<double*, int> > moi_buffers;
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
         if (struct_param.getStructureIsSelfRotating())
         {
-            SAMRAI_MPI::sumReduction(&d_moment_of_inertia_current[struct_no](0, 0), 9);
-            SAMRAI_MPI::sumReduction(&d_moment_of_inertia_new[struct_no](0, 0), 9);
+            moi_buffers.push_back(std::make_pair(d_moment_of_inertia_current[struct_no].data(), 9));
+            moi_buffers.push_back(std::make_pair(d_moment_of_inertia_new[struct_no].data(), 9));
         }
     }
+    sum_reduction(moi_buffers);
 
     // Fill-in symmetric part of inertia tensor.
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
@@ -1151,6 +1185,7 @@ ConstraintIBMethod::calculateKinematicsVelocity()
 {
     using StructureParameters = ConstraintIBKinematics::StructureParameters;
     const double dt = d_FuRMoRP_new_time - d_FuRMoRP_current_time;
+    std::vector<int> self_translating_structs;
     // Theta_new = Theta_old + Omega_old*dt
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
@@ -1167,77 +1202,33 @@ ConstraintIBMethod::calculateKinematicsVelocity()
 
         d_ib_kinematics[struct_no]->setShape(d_FuRMoRP_new_time, d_incremented_angle_from_reference_axis[struct_no]);
 
-        if (struct_param.getStructureIsSelfTranslating()) calculateMomentumOfKinematicsVelocity(struct_no);
+        if (struct_param.getStructureIsSelfTranslating()) self_translating_structs.push_back(struct_no);
     }
+    calculateMomentumOfKinematicsVelocity(self_translating_structs);
 
     return;
 } // calculateKinematicsVelocity
 
 void
-ConstraintIBMethod::calculateMomentumOfKinematicsVelocity(const int position_handle)
+ConstraintIBMethod::calculateMomentumOfKinematicsVelocity(const std::vector<int>& position_handles)
 {
     using StructureParameters = ConstraintIBKinematics::StructureParameters;
-    Pointer<ConstraintIBKinematics> ptr_ib_kinematics = d_ib_kinematics[position_handle];
-    const StructureParameters& struct_param = ptr_ib_kinematics->getStructureParameters();
-    tbox::Array<int> calculate_trans_mom = struct_param.getCalculateTranslationalMomentum();
-    tbox::Array<int> calculate_rot_mom = struct_param.getCalculateRotationalMomentum();
-    const int coarsest_ln = struct_param.getCoarsestLevelNumber();
-    const int finest_ln = struct_param.getFinestLevelNumber();
-    const std::vector<std::pair<int, int> >& range = struct_param.getLagIdxRange();
-    const int total_nodes = struct_param.getTotalNodes();
-
-    // Zero out linear momentum of kinematics velocity of the structure.
-    for (int d = 0; d < 3; ++d) d_vel_com_def_new[position_handle][d] = 0.0;
-
-    // Calculate linear momentum
-    for (int ln = coarsest_ln, itr = 0; ln <= finest_ln && static_cast<unsigned int>(itr) < range.size(); ++ln, ++itr)
-    {
-#if !defined(NDEBUG)
-        TBOX_ASSERT(d_l_data_manager->levelContainsLagrangianData(ln));
-#endif
-
-        std::pair<int, int> lag_idx_range = range[itr];
-        const int offset = lag_idx_range.first;
-        double U_com_def[NDIM] = { 0.0 };
-
-        // Get LMesh corresponding to the present position of the structures
-        // on this level.
-        const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
-        const std::vector<std::vector<double> >& def_vel = ptr_ib_kinematics->getKinematicsVelocity(ln);
-
-        for (const auto& node_idx : local_nodes)
-        {
-            const int lag_idx = node_idx->getLagrangianIndex();
-            if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-            {
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    U_com_def[d] += def_vel[d][lag_idx - offset];
-                }
-            }
-        }
-        for (int d = 0; d < NDIM; ++d)
-        {
-            d_vel_com_def_new[position_handle][d] += U_com_def[d];
-        }
-    }
-    SAMRAI_MPI::sumReduction(d_vel_com_def_new[position_handle].data(), d_vel_com_def_new[position_handle].size());
 
-    for (int d = 0; d < 3; ++d)
+    // Accumulate the local contributions to the momenta of all structures so
+    // that they can be summed with a single reduction.
+    std::vector<std::pair<double*, int> > mom_buffers;
+    for (const int position_handle : position_handles)
     {
-        if (calculate_trans_mom[d])
-            d_vel_com_def_new[position_handle][d] /= total_nodes;
-        else
-            d_vel_com_def_new[position_handle][d] = 0.0;
-    }
+        Pointer<ConstraintIBKinematics> ptr_ib_kinematics = d_ib_kinematics[position_handle];
+        const StructureParameters& struct_param = ptr_ib_kinematics->getStructureParameters();
+        const int coarsest_ln = struct_param.getCoarsestLevelNumber();
+        const int finest_ln = struct_param.getFinestLevelNumber();
+        const std::vector<std::pair<int, int> >& range = struct_param.getLagIdxRange();
 
-    // Calculate angular momentum.
-    if (struct_param.getStructureIsSelfRotating())
-    {
-        // Zero out angular momentum of kinematics velocity of the structure.
-        for (int d = 0; d < 3; ++d) d_omega_com_def_new[position_handle][d] = 0.0;
+        // Zero out linear momentum of kinematics velocity of the structure.
+        for (int d = 0; d < 3; ++d) d_vel_com_def_new[position_handle][d] = 0.0;
 
+        // Calculate linear momentum
         for (int ln = coarsest_ln, itr = 0; ln <= finest_ln && static_cast<unsigned int>(itr) < range.size();
              ++ln, ++itr)
         {
@@ -1247,20 +1238,10 @@ ConstraintIBMethod::calculateMomentumOfKinematicsVelocity(const int position_han
 
             std::pair<int, int> lag_idx_range = range[itr];
             const int offset = lag_idx_range.first;
-            double R_cross_U_def[3] = { 0.0 };
+            double U_com_def[NDIM] = { 0.0 };
 
-            // Get LData corresponding to the present position of the structures.
-            Pointer<LData> ptr_x_lag_data;
-            if (MathUtilities<double>::equalEps(d_FuRMoRP_current_time, 0.0))
-            {
-                ptr_x_lag_data = d_l_data_manager->getLData("X", ln);
-            }
-            else
-            {
-                ptr_x_lag_data = d_l_data_X_half_Euler[ln];
-            }
-
-            const boost::multi_array_ref<double, 2>& X_data = *ptr_x_lag_data->getLocalFormVecArray();
+            // Get LMesh corresponding to the present position of the structures
+            // on this level.
             const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
             const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
             const std::vector<std::vector<double> >& def_vel = ptr_ib_kinematics->getKinematicsVelocity(ln);
@@ -1270,47 +1251,120 @@ ConstraintIBMethod::calculateMomentumOfKinematicsVelocity(const int position_han
                 const int lag_idx = node_idx->getLagrangianIndex();
                 if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
                 {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const X = &X_data[local_idx][0];
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        U_com_def[d] += def_vel[d][lag_idx - offset];
+                    }
+                }
+            }
+            for (int d = 0; d < NDIM; ++d)
+            {
+                d_vel_com_def_new[position_handle][d] += U_com_def[d];
+            }
+        }
+        mom_buffers.push_back(std::make_pair(d_vel_com_def_new[position_handle].data(),
+                                             static_cast<int>(d_vel_com_def_new[position_handle].size())));
+
+        // Calculate angular momentum.
+        if (struct_param.getStructureIsSelfRotating())
+        {
+            // Zero out angular momentum of kinematics velocity of the structure.
+            for (int d = 0; d < 3; ++d) d_omega_com_def_new[position_handle][d] = 0.0;
+
+            for (int ln = coarsest_ln, itr = 0; ln <= finest_ln && static_cast<unsigned int>(itr) < range.size();
+                 ++ln, ++itr)
+            {
+#if !defined(NDEBUG)
+                TBOX_ASSERT(d_l_data_manager->levelContainsLagrangianData(ln));
+#endif
+
+                std::pair<int, int> lag_idx_range = range[itr];
+                const int offset = lag_idx_range.first;
+                double R_cross_U_def[3] = { 0.0 };
+
+                // Get LData corresponding to the present position of the structures.
+                Pointer<LData> ptr_x_lag_data;
+                if (MathUtilities<double>::equalEps(d_FuRMoRP_current_time, 0.0))
+                {
+                    ptr_x_lag_data = d_l_data_manager->getLData("X", ln);
+                }
+                else
+                {
+                    ptr_x_lag_data = d_l_data_X_half_Euler[ln];
+                }
+
+                const boost::multi_array_ref<double, 2>& X_data = *ptr_x_lag_data->getLocalFormVecArray();
+                const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
+                const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
+                const std::vector<std::vector<double> >& def_vel = ptr_ib_kinematics->getKinematicsVelocity(ln);
+
+                for (const auto& node_idx : local_nodes)
+                {
+                    const int lag_idx = node_idx->getLagrangianIndex();
+                    if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
+                    {
+                        const int local_idx = node_idx->getLocalPETScIndex();
+                        const double* const X = &X_data[local_idx][0];
 #if (NDIM == 2)
-                    double x = X[0] - d_center_of_mass_new[position_handle][0];
-                    double y = X[1] - d_center_of_mass_new[position_handle][1];
-                    R_cross_U_def[2] += (x * (def_vel[1][lag_idx - offset]) - y * (def_vel[0][lag_idx - offset]));
+                        double x = X[0] - d_center_of_mass_new[position_handle][0];
+                        double y = X[1] - d_center_of_mass_new[position_handle][1];
+                        R_cross_U_def[2] += (x * (def_vel[1][lag_idx - offset]) - y * (def_vel[0][lag_idx - offset]));
 
 #endif
 
 #if (NDIM == 3)
-                    double x = X[0] - d_center_of_mass_new[position_handle][0];
-                    double y = X[1] - d_center_of_mass_new[position_handle][1];
-                    double z = X[2] - d_center_of_mass_new[position_handle][2];
+                        double x = X[0] - d_center_of_mass_new[position_handle][0];
+                        double y = X[1] - d_center_of_mass_new[position_handle][1];
+                        double z = X[2] - d_center_of_mass_new[position_handle][2];
 
-                    R_cross_U_def[0] += (y * (def_vel[2][lag_idx - offset]) - z * (def_vel[1][lag_idx - offset]));
+                        R_cross_U_def[0] += (y * (def_vel[2][lag_idx - offset]) - z * (def_vel[1][lag_idx - offset]));
 
-                    R_cross_U_def[1] += (-x * (def_vel[2][lag_idx - offset]) + z * (def_vel[0][lag_idx - offset]));
+                        R_cross_U_def[1] += (-x * (def_vel[2][lag_idx - offset]) + z * (def_vel[0][lag_idx - offset]));
 
-                    R_cross_U_def[2] += (x * (def_vel[1][lag_idx - offset]) - y * (def_vel[0][lag_idx - offset]));
+                        R_cross_U_def[2] += (x * (def_vel[1][lag_idx - offset]) - y * (def_vel[0][lag_idx - offset]));
 #endif
+                    }
                 }
-            }
-            for (int d = 0; d < 3; ++d)
-            {
-                d_omega_com_def_new[position_handle][d] += R_cross_U_def[d];
-            }
-            ptr_x_lag_data->restoreArrays();
-        } // all levels
-        SAMRAI_MPI::sumReduction(&d_omega_com_def_new[position_handle][0], 3);
+                for (int d = 0; d < 3; ++d)
+                {
+                    d_omega_com_def_new[position_handle][d] += R_cross_U_def[d];
+                }
+                ptr_x_lag_data->restoreArrays();
+            } // all levels
+            mom_buffers.push_back(std::make_pair(d_omega_com_def_new[position_handle].data(), 3));
+        }
+    }
+    sum_reduction(mom_buffers);
+
+    for (const int position_handle : position_handles)
+    {
+        const StructureParameters& struct_param = d_ib_kinematics[position_handle]->getStructureParameters();
+        tbox::Array<int> calculate_trans_mom = struct_param.getCalculateTranslationalMomentum();
+        tbox::Array<int> calculate_rot_mom = struct_param.getCalculateRotationalMomentum();
+        const int total_nodes = struct_param.getTotalNodes();
 
+        for (int d = 0; d < 3; ++d)
+        {
+            if (calculate_trans_mom[d])
+                d_vel_com_def_new[position_handle][d] /= total_nodes;
+            else
+                d_vel_com_def_new[position_handle][d] = 0.0;
+        }
+
+        if (struct_param.getStructureIsSelfRotating())
+        {
 // Find angular velocity of deformational velocity.
 #if (NDIM == 2)
-        d_omega_com_def_new[position_handle][2] /= d_moment_of_inertia_new[position_handle](2, 2);
+            d_omega_com_def_new[position_handle][2] /= d_moment_of_inertia_new[position_handle](2, 2);
 #endif
 
 #if (NDIM == 3)
-        solveSystemOfEqns(d_omega_com_def_new[position_handle], d_moment_of_inertia_new[position_handle]);
-        for (int d = 0; d < 3; ++d)
-            if (!calculate_rot_mom[d]) d_omega_com_def_new[position_handle][d] = 0.0;
+            solveSystemOfEqns(d_omega_com_def_new[position_handle], d_moment_of_inertia_new[position_handle]);
+            for (int d = 0; d < 3; ++d)
+                if (!calculate_rot_mom[d]) d_omega_com_def_new[position_handle][d] = 0.0;
 #endif
-    } // if struct is rotating
+        } // if struct is rotating
+    }
 
     return;
 } // calculateMomentumOfKinematicsVelocity
@@ -1520,12 +1574,23 @@ ConstraintIBMethod::calculateRigidTranslationalMomentum()
         d_l_data_U_interp[ln]->restoreArrays();
     } // all levels
 
+    std::vector<std::pair<double*, int> > trans_vel_buffers;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
+        if (struct_param.getStructureIsSelfTranslating())
+        {
+            trans_vel_buffers.push_back(std::make_pair(d_rigid_trans_vel_new[struct_no].data(),
+                                                       static_cast<int>(d_rigid_trans_vel_new[struct_no].size())));
+        }
+    }
+    sum_reduction(trans_vel_buffers);
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
         if (struct_param.getStructureIsSelfTranslating())
         {
-            SAMRAI_MPI::sumReduction(d_rigid_trans_vel_new[struct_no].data(), d_rigid_trans_vel_new[struct_no].size());
             tbox::Array<int> calculate_trans_mom = struct_param.getCalculateTranslationalMomentum();
             for (int d = 0; d < NDIM; ++d)
             {
@@ -1624,12 +1689,22 @@ ConstraintIBMethod::calculateRigidRotationalMomentum()
         d_l_data_X_half_Euler[ln]->restoreArrays();
     } // all levels
 
+    std::vector<std::pair<double*, int> > rot_vel_buffers;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
+        if (struct_param.getStructureIsSelfRotating())
+        {
+            rot_vel_buffers.push_back(std::make_pair(d_rigid_rot_vel_new[struct_no].data(), 3));
+        }
+    }
+    sum_reduction(rot_vel_buffers);
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
         if (struct_param.getStructureIsSelfRotating())
         {
-            SAMRAI_MPI::sumReduction(&d_rigid_rot_vel_new[struct_no][0], 3);
 #if (NDIM == 2)
             d_rigid_rot_vel_new[struct_no][2] /= d_moment_of_inertia_new[struct_no](2, 2);
 #endif
@@ -2469,10 +2544,16 @@ ConstraintIBMethod::calculateDrag()
         d_l_data_U_correction[ln]->restoreArrays();
     }
 
+    std::vector<std::pair<double*, int> > force_buffers;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        force_buffers.push_back(std::make_pair(inertia_force[struct_no].data(), 3));
+        force_buffers.push_back(std::make_pair(constraint_force[struct_no].data(), 3));
+    }
+    sum_reduction(force_buffers);
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        SAMRAI_MPI::sumReduction(&inertia_force[struct_no][0], 3);
-        SAMRAI_MPI::sumReduction(&constraint_force[struct_no][0], 3);
         for (int d = 0; d < NDIM; ++d)
         {
             inertia_force[struct_no][d] *= (d_rho_solid[struct_no] / dt) * d_vol_element[struct_no];
@@ -2579,10 +2660,16 @@ ConstraintIBMethod::calculateTorque()
         d_l_data_U_correction[ln]->restoreArrays();
         d_X_new_data[ln]->restoreArrays();
     }
+    std::vector<std::pair<double*, int> > torque_buffers;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        torque_buffers.push_back(std::make_pair(inertia_torque[struct_no].data(), 3));
+        torque_buffers.push_back(std::make_pair(constraint_torque[struct_no].data(), 3));
+    }
+    sum_reduction(torque_buffers);
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        SAMRAI_MPI::sumReduction(&inertia_torque[struct_no][0], 3);
-        SAMRAI_MPI::sumReduction(&constraint_torque[struct_no][0], 3);
         for (int d = 0; d < 3; ++d)
         {
             inertia_torque[struct_no][d] *= (d_rho_solid[struct_no] / dt) * d_vol_element[struct_no];
@@ -2661,10 +2748,16 @@ ConstraintIBMethod::calculatePower()
         d_l_data_U_correction[ln]->restoreArrays();
     }
 
+    std::vector<std::pair<double*, int> > power_buffers;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        power_buffers.push_back(std::make_pair(inertia_power[struct_no].data(), 3));
+        power_buffers.push_back(std::make_pair(constraint_power[struct_no].data(), 3));
+    }
+    sum_reduction(power_buffers);
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        SAMRAI_MPI::sumReduction(&inertia_power[struct_no][0], 3);
-        SAMRAI_MPI::sumReduction(&constraint_power[struct_no][0], 3);
         for (int d = 0; d < NDIM; ++d)
         {
             inertia_power[struct_no][d] *= (d_rho_solid[struct_no] / dt) * d_vol_element[struct_no];
@@ -2731,9 +2824,15 @@ ConstraintIBMethod::calculateStructureMomentum()
         d_l_data_U_new[ln]->restoreArrays();
     }
 
+    std::vector<std::pair<double*, int> > mom_buffers;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        mom_buffers.push_back(std::make_pair(d_structure_mom[struct_no].data(), 3));
+    }
+    sum_reduction(mom_buffers);
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        SAMRAI_MPI::sumReduction(&d_structure_mom[struct_no][0], 3);
         for (int d = 0; d < NDIM; ++d)
         {
             d_structure_mom[struct_no][d] *= d_rho_solid[struct_no] * d_vol_element[struct_no];
@@ -2810,9 +2909,15 @@ ConstraintIBMethod::calculateStructureRotationalMomentum()
         d_l_data_U_new[ln]->restoreArrays();
         d_X_new_data[ln]->restoreArrays();
     }
+    std::vector<std::pair<double*, int> > rot_mom_buffers;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        rot_mom_buffers.push_back(std::make_pair(d_structure_rotational_mom[struct_no].data(), 3));
+    }
+    sum_reduction(rot_mom_buffers);
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        SAMRAI_MPI::sumReduction(&d_structure_rotational_mom[struct_no][0], 3);
         for (int d = 0; d < 3; ++d)
         {
             d_structure_rotational_mom[struct_no][d] *= d_rho_solid[struct_no] * d_vol_element[struct_no];
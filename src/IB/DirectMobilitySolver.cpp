@@ -220,20 +220,34 @@ DirectMobilitySolver::registerMobilityMat(const std::string& mat_name,
     d_ipiv_map[mat_name] = { {}, {} };
     d_petsc_mat_map[mat_name] = { nullptr, nullptr };
     d_petsc_geometric_mat_map[mat_name] = nullptr;
+    d_mat_use_blocks_map[mat_name] = d_max_block_nodes > 0 && num_nodes > d_max_block_nodes;
+    d_mat_block_nodes_map[mat_name] = {};
+    d_mat_block_data_map[mat_name] = {};
+    d_mat_block_ipiv_map[mat_name] = {};
+    if (d_mat_use_blocks_map[mat_name] && mat_type == READ_FROM_FILE)
+    {
+        TBOX_ERROR("DirectMobilitySolver::registerMobilityMat(): Mobility matrix with handle "
+                   << mat_name << " cannot be read from file " << filename << " since it has " << num_nodes
+                   << " nodes, which exceeds max_block_nodes = " << d_max_block_nodes << std::endl);
+    }
 
-    // Allocate the actual matrices.
+    // Allocate the actual matrices. The dense mobility matrix is not needed
+    // when it is replaced by a block-diagonal approximation.
     const int mobility_mat_size = num_nodes * NDIM;
     const int body_mobility_mat_size = d_mat_parts_map[mat_name] * s_max_free_dofs;
     const int rank = SAMRAI_MPI::getRank();
 
     if (rank == managing_proc)
     {
-        d_mat_map[mat_name].first.resize(mobility_mat_size * mobility_mat_size);
-        MatCreateSeqDense(PETSC_COMM_SELF,
-                          mobility_mat_size,
-                          mobility_mat_size,
-                          d_mat_map[mat_name].first.data(),
-                          &d_petsc_mat_map[mat_name].first);
+        if (!d_mat_use_blocks_map[mat_name])
+        {
+            d_mat_map[mat_name].first.resize(mobility_mat_size * mobility_mat_size);
+            MatCreateSeqDense(PETSC_COMM_SELF,
+                              mobility_mat_size,
+                              mobility_mat_size,
+                              d_mat_map[mat_name].first.data(),
+                              &d_petsc_mat_map[mat_name].first);
+        }
 
         d_mat_map[mat_name].second.resize(body_mobility_mat_size * body_mobility_mat_size);
         MatCreateSeqDense(PETSC_COMM_SELF,
@@ -249,7 +263,7 @@ DirectMobilitySolver::registerMobilityMat(const std::string& mat_name,
                           d_geometric_mat_map[mat_name].data(),
                           &d_petsc_geometric_mat_map[mat_name]);
 
-        if (d_mat_inv_type_map[mat_name].first == LAPACK_LU)
+        if (d_mat_inv_type_map[mat_name].first == LAPACK_LU && !d_mat_use_blocks_map[mat_name])
         {
             d_ipiv_map[mat_name].first.resize(mobility_mat_size);
         }
@@ -348,7 +362,14 @@ DirectMobilitySolver::solveSystem(Vec x, Vec b)
                                             managing_proc,
                                             data_depth);
             }
-            if (rank == managing_proc) computeSolution(mat, inv_type, d_ipiv_map[mat_name].first.data(), rhs.data());
+            if (d_mat_use_blocks_map[mat_name])
+            {
+                applyBlockMobilityInverse(mat_name, rhs.data());
+            }
+            else if (rank == managing_proc)
+            {
+                computeSolution(mat, inv_type, d_ipiv_map[mat_name].first.data(), rhs.data());
+            }
             if (!d_recompute_mob_mat)
             {
                 d_cib_strategy->rotateArray(rhs.data(),
@@ -481,6 +502,23 @@ DirectMobilitySolver::initializeSolverState(Vec x, Vec /*b*/)
 
                 read_files[file_counter] = true;
             }
+            else if (d_mat_use_blocks_map[mat_name])
+            {
+                d_cib_strategy->constructMobilityMatrixBlocks(mat_name,
+                                                              mat_type,
+                                                              d_mat_block_nodes_map[mat_name],
+                                                              d_mat_block_data_map[mat_name],
+                                                              d_max_block_nodes,
+                                                              struct_ids,
+                                                              dx,
+                                                              domain_extents,
+                                                              initial_time,
+                                                              d_rho,
+                                                              d_mu,
+                                                              scale,
+                                                              d_f_periodic_corr,
+                                                              managing_proc);
+            }
             else
             {
                 d_cib_strategy->constructMobilityMatrix(mat_name,
@@ -558,6 +596,8 @@ DirectMobilitySolver::getFromInput(Pointer<Database> input_db)
     // Other parameters
     d_f_periodic_corr = input_db->getDoubleWithDefault("f_periodic_correction", d_f_periodic_corr);
     d_recompute_mob_mat = input_db->getBoolWithDefault("recompute_mob_mat_perstep", d_recompute_mob_mat);
+    const int max_block_nodes = input_db->getIntegerWithDefault("max_block_nodes", 0);
+    d_max_block_nodes = static_cast<unsigned int>(std::max(max_block_nodes, 0));
 
     return;
 } // getFromInput
@@ -569,10 +609,27 @@ DirectMobilitySolver::factorizeMobilityMatrix()
     for (const auto& petsc_mat_pair : d_petsc_mat_map)
     {
         const std::string& mat_name = petsc_mat_pair.first;
+        const MobilityMatrixInverseType& inv_type = d_mat_inv_type_map[mat_name].first;
+
+        // Each processor factorizes the blocks assigned to it.
+        if (d_mat_use_blocks_map[mat_name])
+        {
+            const std::vector<std::vector<int> >& block_nodes = d_mat_block_nodes_map[mat_name];
+            std::vector<std::vector<double> >& block_data = d_mat_block_data_map[mat_name];
+            std::vector<std::vector<int> >& block_ipiv = d_mat_block_ipiv_map[mat_name];
+            block_ipiv.resize(block_nodes.size());
+            for (unsigned int k = 0; k < block_nodes.size(); ++k)
+            {
+                const auto block_size = static_cast<int>(block_nodes[k].size() * NDIM);
+                block_ipiv[k].resize(inv_type == LAPACK_LU ? block_size : 0);
+                factorizeDenseMatrix(
+                    block_data[k].data(), block_size, inv_type, block_ipiv[k].data(), mat_name, "Mobility block");
+            }
+            continue;
+        }
         if (rank != d_mat_proc_map[mat_name]) continue;
 
         Mat& mat = d_petsc_mat_map[mat_name].first;
-        const MobilityMatrixInverseType& inv_type = d_mat_inv_type_map[mat_name].first;
         const int mat_size = d_mat_nodes_map[mat_name] * NDIM;
         double* mat_data = nullptr;
         MatDenseGetArray(mat, &mat_data);
@@ -590,8 +647,7 @@ DirectMobilitySolver::constructBodyMobilityMatrix()
     for (const auto& petsc_mat_pair : d_petsc_mat_map)
     {
         const std::string& mat_name = petsc_mat_pair.first;
-        if (rank != d_mat_proc_map[mat_name]) continue;
-
+        const int managing_proc = d_mat_proc_map[mat_name];
         const int row_size = d_mat_nodes_map[mat_name] * NDIM;
         const int col_size = d_mat_parts_map[mat_name] * s_max_free_dofs;
         const MobilityMatrixInverseType& mobility_inv_type = d_mat_inv_type_map[mat_name].first;
@@ -600,6 +656,33 @@ DirectMobilitySolver::constructBodyMobilityMatrix()
         Mat& body_mob_mat = d_petsc_mat_map[mat_name].second;
         Mat& geometric_mat = d_petsc_geometric_mat_map[mat_name];
 
+        // The block-diagonal approximation to the mobility matrix is
+        // distributed, so that all processors take part in applying its
+        // inverse to the columns of the geometric matrix.
+        if (d_mat_use_blocks_map[mat_name])
+        {
+            std::vector<double> product_mat_data;
+            Mat product_mat = nullptr;
+            if (rank == managing_proc)
+            {
+                product_mat_data.resize(row_size * col_size);
+                MatCreateSeqDense(PETSC_COMM_SELF, row_size, col_size, product_mat_data.data(), &product_mat);
+                MatCopy(geometric_mat, product_mat, SAME_NONZERO_PATTERN);
+            }
+            for (int col = 0; col < col_size; ++col)
+            {
+                double* col_data = rank == managing_proc ? &product_mat_data[col * row_size] : nullptr;
+                applyBlockMobilityInverse(mat_name, col_data);
+            }
+            if (rank == managing_proc)
+            {
+                MatTransposeMatMult(geometric_mat, product_mat, MAT_REUSE_MATRIX, PETSC_DEFAULT, &body_mob_mat);
+                MatDestroy(&product_mat);
+            }
+            continue;
+        }
+        if (rank != managing_proc) continue;
+
         // Allocate a temporary matrix that holds the Matrix-Matrix product.
         // Here we are multiplying inverse of mobility matrix with geometric matrix.
         std::vector<double> product_mat_data(row_size * col_size);
@@ -809,7 +892,19 @@ DirectMobilitySolver::computeSolution(Mat& mat, const MobilityMatrixInverseType&
     double* mat_data = nullptr;
     MatGetSize(mat, &mat_size, nullptr);
     MatDenseGetArray(mat, &mat_data);
+    computeSolution(mat_data, mat_size, inv_type, ipiv, rhs);
+    MatDenseRestoreArray(mat, &mat_data);
 
+    return;
+} // computeSolution
+
+void
+DirectMobilitySolver::computeSolution(double* mat_data,
+                                      const int mat_size,
+                                      const MobilityMatrixInverseType& inv_type,
+                                      int* ipiv,
+                                      double* rhs)
+{
     int err = 0;
     if (inv_type == LAPACK_CHOLESKY)
     {
@@ -856,11 +951,50 @@ DirectMobilitySolver::computeSolution(Mat& mat, const MobilityMatrixInverseType&
         TBOX_ERROR("DirectMobilitySolver::computeSolution(). Inverse method not supported." << std::endl);
     }
 
-    MatDenseRestoreArray(mat, &mat_data);
-
     return;
 } // computeSolution
 
+void
+DirectMobilitySolver::applyBlockMobilityInverse(const std::string& mat_name, double* rhs)
+{
+    const int rank = SAMRAI_MPI::getRank();
+    const int managing_proc = d_mat_proc_map[mat_name];
+    const int mat_size = d_mat_nodes_map[mat_name] * NDIM;
+    const MobilityMatrixInverseType& inv_type = d_mat_inv_type_map[mat_name].first;
+    const std::vector<std::vector<int> >& block_nodes = d_mat_block_nodes_map[mat_name];
+    std::vector<std::vector<double> >& block_data = d_mat_block_data_map[mat_name];
+    std::vector<std::vector<int> >& block_ipiv = d_mat_block_ipiv_map[mat_name];
+
+    // Make the right-hand side available on all processors.
+    std::vector<double> b(mat_size);
+    if (rank == managing_proc) std::copy(rhs, rhs + mat_size, b.begin());
+    int buffer_size = mat_size;
+    SAMRAI_MPI::bcast(b.data(), buffer_size, managing_proc);
+
+    // Solve with the blocks assigned to this processor and accumulate the
+    // solution.
+    std::vector<double> x(mat_size, 0.0);
+    for (unsigned int k = 0; k < block_nodes.size(); ++k)
+    {
+        const std::vector<int>& nodes = block_nodes[k];
+        const auto block_size = static_cast<int>(nodes.size() * NDIM);
+        std::vector<double> block_rhs(block_size);
+        for (unsigned int i = 0; i < nodes.size(); ++i)
+        {
+            std::copy(&b[nodes[i] * NDIM], &b[nodes[i] * NDIM] + NDIM, &block_rhs[i * NDIM]);
+        }
+        computeSolution(block_data[k].data(), block_size, inv_type, block_ipiv[k].data(), block_rhs.data());
+        for (unsigned int i = 0; i < nodes.size(); ++i)
+        {
+            std::copy(&block_rhs[i * NDIM], &block_rhs[i * NDIM] + NDIM, &x[nodes[i] * NDIM]);
+        }
+    }
+    SAMRAI_MPI::sumReduction(x.data(), mat_size);
+    if (rank == managing_proc) std::copy(x.begin(), x.end(), rhs);
+
+    return;
+} // applyBlockMobilityInverse
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBAMR
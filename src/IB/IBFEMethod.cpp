@@ -25,6 +25,7 @@
 #include "ibtk/BoxPartitioner.h"
 #include "ibtk/FEDataInterpolation.h"
 #include "ibtk/FEDataManager.h"
+#include "ibtk/HilbertLoadBalancer.h"
 #include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/IndexUtilities.h"
 #include "ibtk/LEInteractor.h"
@@ -133,8 +134,10 @@ IBTK_ENABLE_EXTRA_WARNINGS
 #include <iomanip>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -466,6 +469,58 @@ IBFEMethod::getInitialVelocityFunction(unsigned int part) const
     return d_initial_velocity_fcn_data[part];
 } // getInitialVelocityFunction
 
+void
+IBFEMethod::PK1StressFcnData::evaluate(TensorValue<double>& PP,
+                                       const TensorValue<double>& FF,
+                                       const libMesh::Point& x,
+                                       const libMesh::Point& X,
+                                       Elem* const elem,
+                                       const std::vector<const std::vector<double>*>& var_data,
+                                       const std::vector<const std::vector<VectorValue<double> >*>& grad_var_data,
+                                       const double data_time) const
+{
+    if (batch_fcn)
+    {
+        const std::vector<std::vector<const std::vector<double>*> > batch_var_data(1, var_data);
+        const std::vector<std::vector<const std::vector<VectorValue<double> >*> > batch_grad_var_data(1, grad_var_data);
+        batch_fcn(&PP, &FF, &x, &X, 1, elem, batch_var_data, batch_grad_var_data, data_time, ctx);
+    }
+    else
+    {
+        TBOX_ASSERT(fcn);
+        fcn(PP, FF, x, X, elem, var_data, grad_var_data, data_time, ctx);
+    }
+    return;
+} // evaluate
+
+void
+IBFEMethod::PK1StressFcnData::evaluateBatch(
+    TensorValue<double>* const PP,
+    const TensorValue<double>* const FF,
+    const libMesh::Point* const x,
+    const libMesh::Point* const X,
+    const unsigned int n_points,
+    Elem* const elem,
+    const std::vector<std::vector<const std::vector<double>*> >& var_data,
+    const std::vector<std::vector<const std::vector<VectorValue<double> >*> >& grad_var_data,
+    const double data_time) const
+{
+    if (batch_fcn)
+    {
+        batch_fcn(PP, FF, x, X, n_points, elem, var_data, grad_var_data, data_time, ctx);
+    }
+    else
+    {
+        // Adapter for pointwise stress functions.
+        TBOX_ASSERT(fcn);
+        for (unsigned int qp = 0; qp < n_points; ++qp)
+        {
+            fcn(PP[qp], FF[qp], x[qp], X[qp], elem, var_data[qp], grad_var_data[qp], data_time, ctx);
+        }
+    }
+    return;
+} // evaluateBatch
+
 void
 IBFEMethod::registerPK1StressFunction(const PK1StressFcnData& data, const unsigned int part)
 {
@@ -1818,7 +1873,15 @@ void IBFEMethod::endDataRedistribution(Pointer<PatchHierarchy<NDIM> > /*hierarch
 
             // At this point the primary hierarchy has been regridded but the
             // scratch hierarchy has not.
-            d_scratch_load_balancer->setWorkloadPatchDataIndex(d_lagrangian_workload_current_idx);
+            Pointer<HilbertLoadBalancer> hilbert_load_balancer = d_scratch_load_balancer;
+            if (hilbert_load_balancer)
+            {
+                hilbert_load_balancer->setWorkloadPatchDataIndex(d_lagrangian_workload_current_idx);
+            }
+            else
+            {
+                d_scratch_load_balancer->setWorkloadPatchDataIndex(d_lagrangian_workload_current_idx);
+            }
 
             for (int ln = 0; ln <= d_scratch_hierarchy->getFinestLevelNumber(); ++ln)
             {
@@ -2169,22 +2232,15 @@ IBFEMethod::computeStressNormalization(PetscVector<double>& Phi_vec,
                 double Phi = 0.0;
                 for (unsigned int k = 0; k < num_PK1_fcns; ++k)
                 {
-                    if (d_PK1_stress_fcn_data[part][k].fcn)
+                    if (d_PK1_stress_fcn_data[part][k].hasStressFunction())
                     {
                         // Compute the value of the first Piola-Kirchhoff stress
                         // tensor at the quadrature point and add the corresponding
                         // traction force to the right-hand-side vector.
                         fe.setInterpolatedDataPointers(
                             PK1_var_data[k], PK1_grad_var_data[k], PK1_fcn_system_idxs[k], elem, qp);
-                        d_PK1_stress_fcn_data[part][k].fcn(PP,
-                                                           FF,
-                                                           x,
-                                                           X,
-                                                           elem,
-                                                           PK1_var_data[k],
-                                                           PK1_grad_var_data[k],
-                                                           data_time,
-                                                           d_PK1_stress_fcn_data[part][k].ctx);
+                        d_PK1_stress_fcn_data[part][k].evaluate(
+                            PP, FF, x, X, elem, PK1_var_data[k], PK1_grad_var_data[k], data_time);
                         Phi += n * ((PP * FF_trans) * n) / J;
                     }
                 }
@@ -2285,17 +2341,26 @@ IBFEMethod::assembleInteriorForceDensityRHS(PetscVector<double>& G_rhs_vec,
     double* G_rhs_local_soln = nullptr;
     ierr = VecGetArray(G_rhs_vec_local, &G_rhs_local_soln);
     IBTK_CHKERRQ(ierr);
-    DenseVector<double> G_rhs_e[NDIM];
-    std::vector<libMesh::dof_id_type> dof_id_scratch;
+    int G_rhs_local_size = 0;
+    ierr = VecGetLocalSize(G_rhs_vec_local, &G_rhs_local_size);
+    IBTK_CHKERRQ(ierr);
 
     // First handle the stress contributions.  These are handled separately
     // because each stress function may use a different quadrature rule.
+    std::vector<Elem*> local_elems;
+    const MeshBase::const_element_iterator el_begin = mesh.active_local_elements_begin();
+    const MeshBase::const_element_iterator el_end = mesh.active_local_elements_end();
+    for (MeshBase::const_element_iterator el_it = el_begin; el_it != el_end; ++el_it)
+    {
+        local_elems.push_back(*el_it);
+    }
     const size_t num_PK1_fcns = d_PK1_stress_fcn_data[part].size();
     for (unsigned int k = 0; k < num_PK1_fcns; ++k)
     {
-        if (!d_PK1_stress_fcn_data[part][k].fcn) continue;
+        const PK1StressFcnData& PK1_stress_fcn_data = d_PK1_stress_fcn_data[part][k];
+        if (!PK1_stress_fcn_data.hasStressFunction()) continue;
 
-        // Extract the FE systems and DOF maps, and setup the FE object.
+        // Extract the FE systems and DOF maps.
         const DofMap& G_dof_map = G_system.get_dof_map();
         FEDataManager::SystemDofMapCache& G_dof_map_cache =
             *d_primary_fe_data_managers[part]->getDofMapCache(FORCE_SYSTEM_NAME);
@@ -2308,172 +2373,244 @@ IBFEMethod::assembleInteriorForceDensityRHS(PetscVector<double>& G_rhs_vec,
         std::vector<int> vars(NDIM);
         for (unsigned int d = 0; d < NDIM; ++d) vars[d] = d;
 
-        FEDataInterpolation fe(dim, d_primary_fe_data_managers[part]->getFEData());
-        std::unique_ptr<QBase> qrule =
-            QBase::build(d_PK1_stress_fcn_data[part][k].quad_type, dim, d_PK1_stress_fcn_data[part][k].quad_order);
-        std::unique_ptr<QBase> qrule_face =
-            QBase::build(d_PK1_stress_fcn_data[part][k].quad_type, dim - 1, d_PK1_stress_fcn_data[part][k].quad_order);
-        fe.attachQuadratureRule(qrule.get());
-        fe.attachQuadratureRuleFace(qrule_face.get());
-        fe.evalNormalsFace();
-        fe.evalQuadraturePoints();
-        fe.evalQuadraturePointsFace();
-        fe.evalQuadratureWeights();
-        fe.evalQuadratureWeightsFace();
-        fe.registerSystem(G_system, std::vector<int>(),
-                          vars); // compute dphi for the force system
-        const size_t X_sys_idx = fe.registerInterpolatedSystem(X_system, vars, vars, &X_vec);
-        std::vector<size_t> PK1_fcn_system_idxs;
-        fe.setupInterpolatedSystemDataIndexes(
-            PK1_fcn_system_idxs, d_PK1_stress_fcn_data[part][k].system_data, &equation_systems);
-        fe.init();
-
-        const std::vector<libMesh::Point>& q_point = fe.getQuadraturePoints();
-        const std::vector<double>& JxW = fe.getQuadratureWeights();
-        const std::vector<std::vector<VectorValue<double> > >& dphi = fe.getDphi(G_fe_type);
-
-        const std::vector<libMesh::Point>& q_point_face = fe.getQuadraturePointsFace();
-        const std::vector<double>& JxW_face = fe.getQuadratureWeightsFace();
-        const std::vector<libMesh::Point>& normal_face = fe.getNormalsFace();
-        const std::vector<std::vector<double> >& phi_face = fe.getPhiFace(G_fe_type);
-
-        const std::vector<std::vector<std::vector<double> > >& fe_interp_var_data = fe.getVarInterpolation();
-        const std::vector<std::vector<std::vector<VectorValue<double> > > >& fe_interp_grad_var_data =
-            fe.getGradVarInterpolation();
-
-        std::vector<const std::vector<double>*> PK1_var_data;
-        std::vector<const std::vector<VectorValue<double> >*> PK1_grad_var_data;
-
-        // Loop over the elements to compute the right-hand side vector.  This
-        // is computed via
-        //
-        //    rhs_k = -int{PP(s,t) grad phi_k(s)}ds + int{PP(s,t) N(s,t)
-        //    phi_k(s)}dA(s)
-        //
-        // This right-hand side vector is used to solve for the nodal values of
-        // the interior elastic force density.
-        TensorValue<double> PP, FF, FF_inv_trans;
-        VectorValue<double> F, F_qp, n, x;
-        const MeshBase::const_element_iterator el_begin = mesh.active_local_elements_begin();
-        const MeshBase::const_element_iterator el_end = mesh.active_local_elements_end();
-        for (MeshBase::const_element_iterator el_it = el_begin; el_it != el_end; ++el_it)
-        {
-            Elem* const elem = *el_it;
-            const auto& G_dof_indices = G_dof_map_cache.dof_indices(elem);
-            for (unsigned int d = 0; d < NDIM; ++d)
-            {
-                G_rhs_e[d].resize(static_cast<int>(G_dof_indices[d].size()));
-            }
-            fe.reinit(elem);
-            fe.collectDataForInterpolation(elem);
-            fe.interpolate(elem);
-            const unsigned int n_qp = qrule->n_points();
-            const size_t n_basis = dphi.size();
-            for (unsigned int qp = 0; qp < n_qp; ++qp)
+        // The DOF map cache is populated on demand, so look up the DOF indices
+        // of all local elements before any elements are processed concurrently.
+        std::vector<const std::vector<std::vector<libMesh::dof_id_type> >*> G_elem_dof_indices(local_elems.size());
+        for (size_t e = 0; e < local_elems.size(); ++e)
+        {
+            G_elem_dof_indices[e] = &G_dof_map_cache.dof_indices(local_elems[e]);
+        }
+
+        // Assemble the contributions of the local elements in the range
+        // [elem_begin, elem_end) into G_rhs, which is indexed like the local form
+        // of G_rhs_vec.  Shared data structures (the DOF map caches and the
+        // solution vectors) are only accessed while holding shared_data_mutex.
+        std::mutex shared_data_mutex;
+        auto assemble_elems = [&](const size_t elem_begin, const size_t elem_end, double* const G_rhs) {
+            // Setup the FE object.
+            std::unique_lock<std::mutex> setup_lock(shared_data_mutex);
+            FEDataInterpolation fe(dim, d_primary_fe_data_managers[part]->getFEData());
+            std::unique_ptr<QBase> qrule =
+                QBase::build(d_PK1_stress_fcn_data[part][k].quad_type, dim, d_PK1_stress_fcn_data[part][k].quad_order);
+            std::unique_ptr<QBase> qrule_face = QBase::build(
+                d_PK1_stress_fcn_data[part][k].quad_type, dim - 1, d_PK1_stress_fcn_data[part][k].quad_order);
+            fe.attachQuadratureRule(qrule.get());
+            fe.attachQuadratureRuleFace(qrule_face.get());
+            fe.evalNormalsFace();
+            fe.evalQuadraturePoints();
+            fe.evalQuadraturePointsFace();
+            fe.evalQuadratureWeights();
+            fe.evalQuadratureWeightsFace();
+            fe.registerSystem(G_system, std::vector<int>(),
+                              vars); // compute dphi for the force system
+            const size_t X_sys_idx = fe.registerInterpolatedSystem(X_system, vars, vars, &X_vec);
+            std::vector<size_t> PK1_fcn_system_idxs;
+            fe.setupInterpolatedSystemDataIndexes(
+                PK1_fcn_system_idxs, d_PK1_stress_fcn_data[part][k].system_data, &equation_systems);
+            fe.init();
+            setup_lock.unlock();
+
+            const std::vector<libMesh::Point>& q_point = fe.getQuadraturePoints();
+            const std::vector<double>& JxW = fe.getQuadratureWeights();
+            const std::vector<std::vector<VectorValue<double> > >& dphi = fe.getDphi(G_fe_type);
+
+            const std::vector<libMesh::Point>& q_point_face = fe.getQuadraturePointsFace();
+            const std::vector<double>& JxW_face = fe.getQuadratureWeightsFace();
+            const std::vector<libMesh::Point>& normal_face = fe.getNormalsFace();
+            const std::vector<std::vector<double> >& phi_face = fe.getPhiFace(G_fe_type);
+
+            const std::vector<std::vector<std::vector<double> > >& fe_interp_var_data = fe.getVarInterpolation();
+            const std::vector<std::vector<std::vector<VectorValue<double> > > >& fe_interp_grad_var_data =
+                fe.getGradVarInterpolation();
+
+            // The stress function is evaluated at all of the quadrature points of
+            // an element (or of an element side) at once.
+            std::vector<TensorValue<double> > PP_qp, FF_qp;
+            std::vector<libMesh::Point> x_qp;
+            std::vector<std::vector<const std::vector<double>*> > PK1_var_data;
+            std::vector<std::vector<const std::vector<VectorValue<double> >*> > PK1_grad_var_data;
+            auto resize_qp_data = [&](const unsigned int n_qp) {
+                PP_qp.resize(n_qp);
+                FF_qp.resize(n_qp);
+                x_qp.resize(n_qp);
+                PK1_var_data.resize(n_qp);
+                PK1_grad_var_data.resize(n_qp);
+            };
+
+            // Loop over the elements to compute the right-hand side vector.
+            // This is computed via
+            //
+            //    rhs_k = -int{PP(s,t) grad phi_k(s)}ds + int{PP(s,t) N(s,t)
+            //    phi_k(s)}dA(s)
+            //
+            // This right-hand side vector is used to solve for the nodal values
+            // of the interior elastic force density.
+            DenseVector<double> G_rhs_e[NDIM];
+            std::vector<libMesh::dof_id_type> dof_id_scratch;
+            TensorValue<double> FF_inv_trans;
+            VectorValue<double> F, F_qp, n;
+            for (size_t e = elem_begin; e < elem_end; ++e)
             {
-                const libMesh::Point& X = q_point[qp];
-                const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
-                const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
-                get_x_and_FF(x, FF, x_data, grad_x_data);
-
-                // Compute the value of the first Piola-Kirchhoff stress tensor
-                // at the quadrature point and add the corresponding forces to
-                // the right-hand-side vector.
-                fe.setInterpolatedDataPointers(PK1_var_data, PK1_grad_var_data, PK1_fcn_system_idxs, elem, qp);
-                d_PK1_stress_fcn_data[part][k].fcn(
-                    PP, FF, x, X, elem, PK1_var_data, PK1_grad_var_data, data_time, d_PK1_stress_fcn_data[part][k].ctx);
-                for (unsigned int basis_n = 0; basis_n < n_basis; ++basis_n)
+                Elem* const elem = local_elems[e];
+                const auto& G_dof_indices = *G_elem_dof_indices[e];
+                for (unsigned int d = 0; d < NDIM; ++d)
                 {
-                    F_qp = -PP * dphi[basis_n][qp] * JxW[qp];
-                    for (unsigned int i = 0; i < NDIM; ++i)
-                    {
-                        G_rhs_e[i](basis_n) += F_qp(i);
-                    }
+                    G_rhs_e[d].resize(static_cast<int>(G_dof_indices[d].size()));
                 }
-            }
-
-            // Loop over the element boundaries.
-            for (unsigned short int side = 0; side < elem->n_sides(); ++side)
-            {
-                // Skip non-physical boundaries.
-                if (!is_physical_bdry(elem, side, boundary_info, G_dof_map)) continue;
-
-                // Determine if we need to integrate surface forces along this
-                // part of the physical boundary; if not, skip the present side.
-                const bool at_dirichlet_bdry = is_dirichlet_bdry(elem, side, boundary_info, G_dof_map);
-                const bool integrate_normal_force =
-                    (d_split_normal_force && !at_dirichlet_bdry) || (!d_split_normal_force && at_dirichlet_bdry);
-                const bool integrate_tangential_force = (d_split_tangential_force && !at_dirichlet_bdry) ||
-                                                        (!d_split_tangential_force && at_dirichlet_bdry);
-                if (!integrate_normal_force && !integrate_tangential_force) continue;
-
-                fe.reinit(elem, side);
-                fe.interpolate(elem, side);
-                const unsigned int n_qp_face = qrule_face->n_points();
-                const size_t n_basis_face = phi_face.size();
-                for (unsigned int qp = 0; qp < n_qp_face; ++qp)
+                fe.reinit(elem);
+                {
+                    std::lock_guard<std::mutex> data_lock(shared_data_mutex);
+                    fe.collectDataForInterpolation(elem);
+                }
+                fe.interpolate(elem);
+                const unsigned int n_qp = qrule->n_points();
+                const size_t n_basis = dphi.size();
+                resize_qp_data(n_qp);
+                for (unsigned int qp = 0; qp < n_qp; ++qp)
                 {
-                    const libMesh::Point& X = q_point_face[qp];
                     const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
                     const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
-                    get_x_and_FF(x, FF, x_data, grad_x_data);
-                    tensor_inverse_transpose(FF_inv_trans, FF, NDIM);
-
-                    F.zero();
+                    get_x_and_FF(x_qp[qp], FF_qp[qp], x_data, grad_x_data);
+                    fe.setInterpolatedDataPointers(
+                        PK1_var_data[qp], PK1_grad_var_data[qp], PK1_fcn_system_idxs, elem, qp);
+                }
 
-                    // Compute the value of the first Piola-Kirchhoff stress
-                    // tensor at the quadrature point and add the corresponding
-                    // traction force to the right-hand-side vector.
-                    if (d_PK1_stress_fcn_data[part][k].fcn)
+                // Compute the values of the first Piola-Kirchhoff stress tensor
+                // at the quadrature points and add the corresponding forces to
+                // the right-hand-side vector.
+                PK1_stress_fcn_data.evaluateBatch(PP_qp.data(),
+                                                  FF_qp.data(),
+                                                  x_qp.data(),
+                                                  q_point.data(),
+                                                  n_qp,
+                                                  elem,
+                                                  PK1_var_data,
+                                                  PK1_grad_var_data,
+                                                  data_time);
+                for (unsigned int qp = 0; qp < n_qp; ++qp)
+                {
+                    for (unsigned int basis_n = 0; basis_n < n_basis; ++basis_n)
                     {
-                        fe.setInterpolatedDataPointers(PK1_var_data, PK1_grad_var_data, PK1_fcn_system_idxs, elem, qp);
-                        d_PK1_stress_fcn_data[part][k].fcn(PP,
-                                                           FF,
-                                                           x,
-                                                           X,
-                                                           elem,
-                                                           PK1_var_data,
-                                                           PK1_grad_var_data,
-                                                           data_time,
-                                                           d_PK1_stress_fcn_data[part][k].ctx);
-                        F += PP * normal_face[qp];
+                        F_qp = -PP_qp[qp] * dphi[basis_n][qp] * JxW[qp];
+                        for (unsigned int i = 0; i < NDIM; ++i)
+                        {
+                            G_rhs_e[i](basis_n) += F_qp(i);
+                        }
                     }
+                }
 
-                    n = (FF_inv_trans * normal_face[qp]).unit();
-
-                    if (!integrate_normal_force)
+                // Loop over the element boundaries.
+                for (unsigned short int side = 0; side < elem->n_sides(); ++side)
+                {
+                    // Skip non-physical boundaries.
+                    if (!is_physical_bdry(elem, side, boundary_info, G_dof_map)) continue;
+
+                    // Determine if we need to integrate surface forces along
+                    // this part of the physical boundary; if not, skip the
+                    // present side.
+                    const bool at_dirichlet_bdry = is_dirichlet_bdry(elem, side, boundary_info, G_dof_map);
+                    const bool integrate_normal_force =
+                        (d_split_normal_force && !at_dirichlet_bdry) || (!d_split_normal_force && at_dirichlet_bdry);
+                    const bool integrate_tangential_force = (d_split_tangential_force && !at_dirichlet_bdry) ||
+                                                            (!d_split_tangential_force && at_dirichlet_bdry);
+                    if (!integrate_normal_force && !integrate_tangential_force) continue;
+
+                    fe.reinit(elem, side);
+                    fe.interpolate(elem, side);
+                    const unsigned int n_qp_face = qrule_face->n_points();
+                    const size_t n_basis_face = phi_face.size();
+                    resize_qp_data(n_qp_face);
+                    for (unsigned int qp = 0; qp < n_qp_face; ++qp)
                     {
-                        F -= (F * n) * n; // remove the normal component.
+                        const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
+                        const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
+                        get_x_and_FF(x_qp[qp], FF_qp[qp], x_data, grad_x_data);
+                        fe.setInterpolatedDataPointers(
+                            PK1_var_data[qp], PK1_grad_var_data[qp], PK1_fcn_system_idxs, elem, qp);
                     }
 
-                    if (!integrate_tangential_force)
+                    // Compute the values of the first Piola-Kirchhoff stress
+                    // tensor at the quadrature points and add the corresponding
+                    // traction forces to the right-hand-side vector.
+                    PK1_stress_fcn_data.evaluateBatch(PP_qp.data(),
+                                                      FF_qp.data(),
+                                                      x_qp.data(),
+                                                      q_point_face.data(),
+                                                      n_qp_face,
+                                                      elem,
+                                                      PK1_var_data,
+                                                      PK1_grad_var_data,
+                                                      data_time);
+                    for (unsigned int qp = 0; qp < n_qp_face; ++qp)
                     {
-                        F -= (F - (F * n) * n); // remove the tangential component.
-                    }
+                        tensor_inverse_transpose(FF_inv_trans, FF_qp[qp], NDIM);
+                        F = PP_qp[qp] * normal_face[qp];
 
-                    // Add the boundary forces to the right-hand-side vector.
-                    for (unsigned int basis_face_n = 0; basis_face_n < n_basis_face; ++basis_face_n)
-                    {
-                        F_qp = F * phi_face[basis_face_n][qp] * JxW_face[qp];
-                        for (unsigned int i = 0; i < NDIM; ++i)
+                        n = (FF_inv_trans * normal_face[qp]).unit();
+
+                        if (!integrate_normal_force)
+                        {
+                            F -= (F * n) * n; // remove the normal component.
+                        }
+
+                        if (!integrate_tangential_force)
+                        {
+                            F -= (F - (F * n) * n); // remove the tangential component.
+                        }
+
+                        // Add the boundary forces to the right-hand-side vector.
+                        for (unsigned int basis_face_n = 0; basis_face_n < n_basis_face; ++basis_face_n)
                         {
-                            G_rhs_e[i](basis_face_n) += F_qp(i);
+                            F_qp = F * phi_face[basis_face_n][qp] * JxW_face[qp];
+                            for (unsigned int i = 0; i < NDIM; ++i)
+                            {
+                                G_rhs_e[i](basis_face_n) += F_qp(i);
+                            }
                         }
                     }
                 }
-            }
 
-            // Apply constraints (e.g., enforce periodic boundary conditions)
-            // and add the elemental contributions to the global vector.
-            for (unsigned int i = 0; i < NDIM; ++i)
-            {
-                dof_id_scratch = G_dof_indices[i];
-                G_dof_map.constrain_element_vector(G_rhs_e[i], dof_id_scratch);
-                for (unsigned int j = 0; j < dof_id_scratch.size(); ++j)
+                // Apply constraints (e.g., enforce periodic boundary conditions)
+                // and add the elemental contributions to the global vector.
+                for (unsigned int i = 0; i < NDIM; ++i)
                 {
-                    G_rhs_local_soln[G_rhs_vec.map_global_to_local_index(dof_id_scratch[j])] += G_rhs_e[i](j);
+                    dof_id_scratch = G_dof_indices[i];
+                    G_dof_map.constrain_element_vector(G_rhs_e[i], dof_id_scratch);
+                    for (unsigned int j = 0; j < dof_id_scratch.size(); ++j)
+                    {
+                        G_rhs[G_rhs_vec.map_global_to_local_index(dof_id_scratch[j])] += G_rhs_e[i](j);
+                    }
                 }
             }
+        };
+
+        const size_t num_elems = local_elems.size();
+        const size_t num_threads = std::min(static_cast<size_t>(d_num_force_assembly_threads), num_elems);
+        if (num_threads <= 1)
+        {
+            assemble_elems(0, num_elems, G_rhs_local_soln);
+            continue;
+        }
+
+        // Each thread processes a contiguous block of elements.  The first
+        // thread accumulates directly into the local form of G_rhs_vec and the
+        // others accumulate into separate buffers, which are summed in a fixed
+        // order so that the result does not depend on thread scheduling.
+        std::vector<std::vector<double> > G_rhs_thread_buffers(num_threads - 1,
+                                                               std::vector<double>(G_rhs_local_size, 0.0));
+        std::vector<std::thread> threads;
+        threads.reserve(num_threads);
+        for (size_t t = 0; t < num_threads; ++t)
+        {
+            const size_t elem_begin = (t * num_elems) / num_threads;
+            const size_t elem_end = ((t + 1) * num_elems) / num_threads;
+            double* const G_rhs = t == 0 ? G_rhs_local_soln : G_rhs_thread_buffers[t - 1].data();
+            threads.emplace_back(assemble_elems, elem_begin, elem_end, G_rhs);
+        }
+        for (auto& thread : threads) thread.join();
+        for (const auto& G_rhs_thread_buffer : G_rhs_thread_buffers)
+        {
+            for (int i = 0; i < G_rhs_local_size; ++i) G_rhs_local_soln[i] += G_rhs_thread_buffer[i];
         }
     }
 
@@ -2540,15 +2677,14 @@ IBFEMethod::assembleInteriorForceDensityRHS(PetscVector<double>& G_rhs_vec,
         surface_pressure_grad_var_data;
 
     // Loop over the elements to compute the right-hand side vector.
+    DenseVector<double> G_rhs_e[NDIM];
+    std::vector<libMesh::dof_id_type> dof_id_scratch;
     TensorValue<double> PP, FF, FF_inv_trans;
     VectorValue<double> F, F_b, F_s, F_qp, n, x;
     boost::multi_array<double, 2> X_node;
     boost::multi_array<double, 1> Phi_node;
-    const MeshBase::const_element_iterator el_begin = mesh.active_local_elements_begin();
-    const MeshBase::const_element_iterator el_end = mesh.active_local_elements_end();
-    for (MeshBase::const_element_iterator el_it = el_begin; el_it != el_end; ++el_it)
+    for (Elem* const elem : local_elems)
     {
-        Elem* const elem = *el_it;
         const auto& G_dof_indices = G_dof_map_cache.dof_indices(elem);
         for (unsigned int d = 0; d < NDIM; ++d)
         {
@@ -2912,22 +3048,15 @@ IBFEMethod::spreadTransmissionForceDensity(const int f_data_idx,
 
                     for (unsigned int k = 0; k < num_PK1_fcns; ++k)
                     {
-                        if (d_PK1_stress_fcn_data[part][k].fcn)
+                        if (d_PK1_stress_fcn_data[part][k].hasStressFunction())
                         {
                             // Compute the value of the first Piola-Kirchhoff stress
                             // tensor at the quadrature point and compute the
                             // corresponding force.
                             fe.setInterpolatedDataPointers(
                                 PK1_var_data[k], PK1_grad_var_data[k], PK1_fcn_system_idxs[k], elem, qp);
-                            d_PK1_stress_fcn_data[part][k].fcn(PP,
-                                                               FF,
-                                                               x,
-                                                               X,
-                                                               elem,
-                                                               PK1_var_data[k],
-                                                               PK1_grad_var_data[k],
-                                                               data_time,
-                                                               d_PK1_stress_fcn_data[part][k].ctx);
+                            d_PK1_stress_fcn_data[part][k].evaluate(
+                                PP, FF, x, X, elem, PK1_var_data[k], PK1_grad_var_data[k], data_time);
                             F -= PP * normal_face[qp] * JxW_face[qp];
                         }
                     }
@@ -3299,22 +3428,15 @@ IBFEMethod::imposeJumpConditions(const int f_data_idx,
 
                     for (unsigned int k = 0; k < num_PK1_fcns; ++k)
                     {
-                        if (d_PK1_stress_fcn_data[part][k].fcn)
+                        if (d_PK1_stress_fcn_data[part][k].hasStressFunction())
                         {
                             // Compute the value of the first Piola-Kirchhoff
                             // stress tensor at the quadrature point and compute
                             // the corresponding force.
                             fe.setInterpolatedDataPointers(
                                 PK1_var_data[k], PK1_grad_var_data[k], PK1_fcn_system_idxs[k], elem, qp);
-                            d_PK1_stress_fcn_data[part][k].fcn(PP,
-                                                               FF,
-                                                               x,
-                                                               X,
-                                                               elem,
-                                                               PK1_var_data[k],
-                                                               PK1_grad_var_data[k],
-                                                               data_time,
-                                                               d_PK1_stress_fcn_data[part][k].ctx);
+                            d_PK1_stress_fcn_data[part][k].evaluate(
+                                PP, FF, x, X, elem, PK1_var_data[k], PK1_grad_var_data[k], data_time);
                             F -= PP * normal_face[qp];
                         }
                     }
@@ -3684,6 +3806,8 @@ IBFEMethod::commonConstructor(const std::string& object_name,
             d_scratch_load_balancer = new LoadBalancer<NDIM>(d_scratch_load_balancer_db);
         else if (load_balancer_type == "MERGING")
             d_scratch_load_balancer = new MergingLoadBalancer(d_scratch_load_balancer_db);
+        else if (load_balancer_type == "HILBERT")
+            d_scratch_load_balancer = new HilbertLoadBalancer(d_scratch_load_balancer_db);
         else
             TBOX_ERROR(d_object_name << "::IBFEMethod():\n"
                                      << "unimplemented load balancer type " << load_balancer_type << std::endl);
@@ -3819,6 +3943,14 @@ IBFEMethod::getFromInput(Pointer<Database> db, bool /*is_from_restart*/)
     if (db->isBool("use_jump_conditions")) d_use_jump_conditions = db->getBool("use_jump_conditions");
     if (db->isBool("use_consistent_mass_matrix"))
         d_use_consistent_mass_matrix = db->getBool("use_consistent_mass_matrix");
+    if (db->isInteger("num_force_assembly_threads"))
+        d_num_force_assembly_threads = db->getInteger("num_force_assembly_threads");
+    if (d_num_force_assembly_threads < 1)
+    {
+        TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                 << "  num_force_assembly_threads must be positive, but is "
+                                 << d_num_force_assembly_threads << std::endl);
+    }
 
     // Restart settings.
     if (db->isString("libmesh_restart_file_extension"))
@@ -3847,6 +3979,8 @@ IBFEMethod::getFromInput(Pointer<Database> db, bool /*is_from_restart*/)
     if (db->keyExists("skip_initial_workload_log"))
         d_skip_initial_workload_log = db->getBool("skip_initial_workload_log");
 
+    if (db->isDatabase("LEInteractor")) LEInteractor::setFromDatabase(db->getDatabase("LEInteractor"));
+
     if (db->isDouble("epsilon")) d_epsilon = db->getDouble("epsilon");
 
     d_libmesh_partitioner_type =
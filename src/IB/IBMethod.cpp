@@ -175,6 +175,8 @@ IBMethod::IBMethod(std::string object_name, Pointer<Database> input_db, bool reg
                                                 d_ghosts,
                                                 d_registered_for_restart);
     d_ghosts = d_l_data_manager->getGhostCellWidth();
+    d_l_data_manager->setSortLocalNodes(d_sort_local_nodes);
+    d_l_data_manager->setIncrementalRedistribution(d_incremental_redistribution);
 
     // Create the instrument panel object.
     d_instrument_panel =
@@ -2023,11 +2025,15 @@ IBMethod::getFromInput(Pointer<Database> db, bool is_from_restart)
     }
     if (db->keyExists("error_if_points_leave_domain"))
         d_error_if_points_leave_domain = db->getBool("error_if_points_leave_domain");
+    if (db->keyExists("sort_local_nodes")) d_sort_local_nodes = db->getBool("sort_local_nodes");
+    if (db->keyExists("incremental_redistribution"))
+        d_incremental_redistribution = db->getBool("incremental_redistribution");
     if (db->keyExists("force_jac_mffd")) d_force_jac_mffd = db->getBool("force_jac_mffd");
     if (db->keyExists("do_log"))
         d_do_log = db->getBool("do_log");
     else if (db->keyExists("enable_logging"))
         d_do_log = db->getBool("enable_logging");
+    if (db->isDatabase("LEInteractor")) LEInteractor::setFromDatabase(db->getDatabase("LEInteractor"));
     return;
 } // getFromInput
 
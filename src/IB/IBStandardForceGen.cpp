@@ -58,6 +58,7 @@ IBTK_ENABLE_EXTRA_WARNINGS
 #include <limits>
 #include <map>
 #include <memory>
+#include <numeric>
 #include <ostream>
 #include <set>
 #include <string>
@@ -119,6 +120,15 @@ resetLocalOrNonlocalPETScIndices(std::vector<int>& inds,
     }
     return;
 } // resetLocalOrNonlocalPETScIndices
+
+template <typename T>
+void
+permute(std::vector<T>& v, const std::vector<int>& order)
+{
+    const std::vector<T> v_copy = v;
+    for (unsigned int k = 0; k < v.size(); ++k) v[k] = v_copy[order[k]];
+    return;
+} // permute
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -785,6 +795,26 @@ IBStandardForceGen::initializeSpringLevelData(std::set<int>& nonlocal_petsc_idx_
         }
     }
 
+    // Reorder the springs so that all springs that use the default force
+    // function come first.
+    std::vector<int> spring_order(total_num_springs);
+    std::iota(spring_order.begin(), spring_order.end(), 0);
+    const auto default_springs_end =
+        std::stable_partition(spring_order.begin(), spring_order.end(), [&force_fcns, &parameters](const int k) {
+            return force_fcns[k] == &default_spring_force && parameters[k];
+        });
+    d_spring_data[level_number].num_default_springs =
+        static_cast<int>(std::distance(spring_order.begin(), default_springs_end));
+    if (d_spring_data[level_number].num_default_springs != static_cast<int>(total_num_springs))
+    {
+        permute(lag_mastr_node_idxs, spring_order);
+        permute(lag_slave_node_idxs, spring_order);
+        permute(petsc_mastr_node_idxs, spring_order);
+        permute(force_fcns, spring_order);
+        permute(force_deriv_fcns, spring_order);
+        permute(parameters, spring_order);
+    }
+
     // Map the Lagrangian slave node indices to the PETSc indices corresponding
     // to the present data distribution.
     petsc_slave_node_idxs = lag_slave_node_idxs;
@@ -817,18 +847,70 @@ IBStandardForceGen::computeLagrangianSpringForce(Pointer<LData> F_data,
                                                  const double /*data_time*/,
                                                  LDataManager* const /*l_data_manager*/)
 {
-    const int num_springs = static_cast<int>(d_spring_data[level_number].lag_mastr_node_idxs.size());
+    const SpringData& spring_data = d_spring_data[level_number];
+    double* const F_node = F_data->getLocalFormVecArray()->data();
+    const double* const X_node = X_data->getGhostedLocalFormVecArray()->data();
+
+    // Evaluate the springs that use the default linear force function.  The
+    // forces are computed in batches (which allows the computation to be
+    // vectorized) and are then accumulated one spring at a time (which
+    // resolves conflicts between springs that share nodes).
+    static const int BATCHSIZE = 8;
+    const int num_default_springs = spring_data.num_default_springs;
+    for (int k_begin = 0; k_begin < num_default_springs; k_begin += BATCHSIZE)
+    {
+        const int batch_size = std::min(BATCHSIZE, num_default_springs - k_begin);
+        const int* const mastr_idxs = &spring_data.petsc_mastr_node_idxs[k_begin];
+        const int* const slave_idxs = &spring_data.petsc_slave_node_idxs[k_begin];
+        const double* const* const params = &spring_data.parameters[k_begin];
+        double D_batch[NDIM][BATCHSIZE], T_over_R_batch[BATCHSIZE];
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            for (int b = 0; b < batch_size; ++b)
+            {
+                D_batch[d][b] = X_node[slave_idxs[b] + d] - X_node[mastr_idxs[b] + d];
+            }
+        }
+        for (int b = 0; b < batch_size; ++b)
+        {
+#if (NDIM == 2)
+            const double R = std::sqrt(D_batch[0][b] * D_batch[0][b] + D_batch[1][b] * D_batch[1][b]);
+#endif
+#if (NDIM == 3)
+            const double R = std::sqrt(D_batch[0][b] * D_batch[0][b] + D_batch[1][b] * D_batch[1][b] +
+                                       D_batch[2][b] * D_batch[2][b]);
+#endif
+            T_over_R_batch[b] =
+                (R < std::numeric_limits<double>::epsilon()) ? 0.0 : params[b][0] * (R - params[b][1]) / R;
+        }
+        for (int b = 0; b < batch_size; ++b)
+        {
+#if !defined(NDEBUG)
+            TBOX_ASSERT(mastr_idxs[b] != slave_idxs[b]);
+#endif
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                const double F = T_over_R_batch[b] * D_batch[d][b];
+                F_node[mastr_idxs[b] + d] += F;
+                F_node[slave_idxs[b] + d] -= F;
+            }
+        }
+    }
+
+    // Evaluate the remaining springs.
+    const int num_springs = static_cast<int>(spring_data.lag_mastr_node_idxs.size()) - num_default_springs;
     const bool uses_springs = (num_springs > 0);
-    const int* const lag_mastr_node_idxs = uses_springs ? &d_spring_data[level_number].lag_mastr_node_idxs[0] : nullptr;
-    const int* const lag_slave_node_idxs = uses_springs ? &d_spring_data[level_number].lag_slave_node_idxs[0] : nullptr;
+    const int* const lag_mastr_node_idxs =
+        uses_springs ? &spring_data.lag_mastr_node_idxs[num_default_springs] : nullptr;
+    const int* const lag_slave_node_idxs =
+        uses_springs ? &spring_data.lag_slave_node_idxs[num_default_springs] : nullptr;
     const int* const petsc_mastr_node_idxs =
-        uses_springs ? &d_spring_data[level_number].petsc_mastr_node_idxs[0] : nullptr;
+        uses_springs ? &spring_data.petsc_mastr_node_idxs[num_default_springs] : nullptr;
     const int* const petsc_slave_node_idxs =
-        uses_springs ? &d_spring_data[level_number].petsc_slave_node_idxs[0] : nullptr;
-    const SpringForceFcnPtr* const force_fcns = uses_springs ? &d_spring_data[level_number].force_fcns[0] : nullptr;
-    const double** const parameters = uses_springs ? &d_spring_data[level_number].parameters[0] : nullptr;
-    double* const F_node = F_data->getLocalFormVecArray()->data();
-    const double* const X_node = X_data->getGhostedLocalFormVecArray()->data();
+        uses_springs ? &spring_data.petsc_slave_node_idxs[num_default_springs] : nullptr;
+    const SpringForceFcnPtr* const force_fcns =
+        uses_springs ? &spring_data.force_fcns[num_default_springs] : nullptr;
+    const double* const* const parameters = uses_springs ? &spring_data.parameters[num_default_springs] : nullptr;
 
     static const int BLOCKSIZE = 16; // this parameter needs to be tuned
     int k, kblock, kunroll, mastr_idx, slave_idx;
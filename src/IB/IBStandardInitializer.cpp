@@ -42,6 +42,9 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
 #include <ios>
 #include <iosfwd>
 #include <istream>
@@ -89,6 +92,64 @@ discard_comments(const std::string& input_string)
     string_stream.clear();
     return output_string;
 } // discard_comments
+
+// Read the contents of a binary input file on MPI process 0 and broadcast them
+// to all other MPI processes.  Returns false if the file cannot be read.
+bool
+read_and_broadcast_binary_file(const std::string& filename, std::vector<char>& buffer)
+{
+    int size = -1;
+    if (SAMRAI_MPI::getRank() == 0)
+    {
+        std::ifstream file_stream(filename, std::ios::in | std::ios::binary | std::ios::ate);
+        if (file_stream.is_open())
+        {
+            const std::streamoff file_size = file_stream.tellg();
+            if (file_size > std::numeric_limits<int>::max())
+            {
+                TBOX_ERROR("IBStandardInitializer: binary input file " << filename << " is too large" << std::endl);
+            }
+            size = static_cast<int>(file_size);
+            buffer.resize(size);
+            file_stream.seekg(0);
+            if (!file_stream.read(buffer.data(), size)) size = -1;
+        }
+    }
+    size = SAMRAI_MPI::bcast(size, 0);
+    if (size < 0) return false;
+    buffer.resize(size);
+    if (size > 0) SAMRAI_MPI::bcast(buffer.data(), size, 0);
+    return true;
+} // read_and_broadcast_binary_file
+
+template <typename T>
+T
+read_binary_value(const std::vector<char>& buffer, std::size_t& pos, const std::string& filename)
+{
+    if (pos + sizeof(T) > buffer.size())
+    {
+        TBOX_ERROR("IBStandardInitializer: premature end to binary input file " << filename << std::endl);
+    }
+    T val;
+    std::memcpy(&val, &buffer[pos], sizeof(T));
+    pos += sizeof(T);
+    return val;
+} // read_binary_value
+
+void
+check_binary_file_tag(const std::vector<char>& buffer,
+                      std::size_t& pos,
+                      const std::string& tag,
+                      const std::string& filename)
+{
+    if (buffer.size() < pos + tag.size() || tag.compare(0, tag.size(), &buffer[pos], tag.size()) != 0)
+    {
+        TBOX_ERROR("IBStandardInitializer: binary input file " << filename << " does not begin with the tag "
+                                                                << tag << std::endl);
+    }
+    pos += tag.size();
+    return;
+} // check_binary_file_tag
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -201,9 +262,6 @@ IBStandardInitializer::readVertexFiles(const std::string& extension)
         d_vertex_posn[ln].resize(num_base_filename);
         for (unsigned int j = 0; j < num_base_filename; ++j)
         {
-            // Wait for the previous MPI process to finish reading the current file.
-            if (d_use_file_batons && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
-
             if (j == 0)
             {
                 d_vertex_offset[ln][j] = 0;
@@ -213,6 +271,17 @@ IBStandardInitializer::readVertexFiles(const std::string& extension)
                 d_vertex_offset[ln][j] = d_vertex_offset[ln][j - 1] + d_num_vertex[ln][j - 1];
             }
 
+            // Binary input files are read collectively and do not require
+            // batons.
+            if (d_use_binary_files)
+            {
+                readBinaryVertexFile(d_base_filename[ln][j] + extension + ".bin", ln, j);
+                continue;
+            }
+
+            // Wait for the previous MPI process to finish reading the current file.
+            if (d_use_file_batons && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
+
             // Ensure that the file exists.
             const std::string vertex_filename = d_base_filename[ln][j] + extension;
             std::ifstream file_stream(vertex_filename);
@@ -297,6 +366,71 @@ IBStandardInitializer::readVertexFiles(const std::string& extension)
     return;
 } // readVertexFiles
 
+void
+IBStandardInitializer::readBinaryVertexFile(const std::string& vertex_filename, const int ln, const int j)
+{
+    std::ifstream file_stream(vertex_filename, std::ios::in | std::ios::binary);
+    if (SAMRAI_MPI::minReduction(file_stream.is_open() ? 1 : 0) == 0)
+    {
+        TBOX_ERROR(d_object_name << ":\n  Cannot find required vertex file: " << vertex_filename << std::endl);
+    }
+    plog << d_object_name << ":  "
+         << "processing vertex data from binary input file named " << vertex_filename << std::endl;
+
+    // Every MPI process reads the (fixed-size) header of the file.
+    std::vector<char> header(8 + 2 * sizeof(std::int32_t));
+    if (!file_stream.read(header.data(), header.size())) header.clear();
+    std::size_t pos = 0;
+    check_binary_file_tag(header, pos, "IBVERTEX", vertex_filename);
+    const int dim = read_binary_value<std::int32_t>(header, pos, vertex_filename);
+    if (dim != NDIM)
+    {
+        TBOX_ERROR(d_object_name << ":\n  Binary input file " << vertex_filename << " contains " << dim
+                                 << "D vertex data, but NDIM = " << NDIM << std::endl);
+    }
+    d_num_vertex[ln][j] = read_binary_value<std::int32_t>(header, pos, vertex_filename);
+    if (d_num_vertex[ln][j] <= 0)
+    {
+        TBOX_ERROR(d_object_name << ":\n  Invalid number of vertices " << d_num_vertex[ln][j]
+                                 << " in binary input file " << vertex_filename << std::endl);
+    }
+
+    // Each MPI process reads a contiguous slice of the vertex coordinates, and
+    // the slices are then gathered on every process: the vertices that are
+    // local to each process are determined from the positions of all of the
+    // vertices.
+    const int rank = SAMRAI_MPI::getRank();
+    const int nodes = SAMRAI_MPI::getNodes();
+    const auto num_vertex = static_cast<long long>(d_num_vertex[ln][j]);
+    const auto k_begin = static_cast<int>((num_vertex * rank) / nodes);
+    const auto k_end = static_cast<int>((num_vertex * (rank + 1)) / nodes);
+    std::vector<double> X_slice(NDIM * (k_end - k_begin));
+    file_stream.seekg(static_cast<std::streamoff>(header.size() + sizeof(double) * NDIM * k_begin));
+    if (!X_slice.empty() &&
+        !file_stream.read(reinterpret_cast<char*>(X_slice.data()), sizeof(double) * X_slice.size()))
+    {
+        TBOX_ERROR("IBStandardInitializer: premature end to binary input file " << vertex_filename << std::endl);
+    }
+    std::vector<double> X_all(NDIM * d_num_vertex[ln][j]);
+    SAMRAI_MPI::allGather(
+        X_slice.data(), static_cast<int>(X_slice.size()), X_all.data(), static_cast<int>(X_all.size()));
+
+    d_vertex_posn[ln][j].resize(d_num_vertex[ln][j]);
+    for (int k = 0; k < d_num_vertex[ln][j]; ++k)
+    {
+        Point& X = d_vertex_posn[ln][j][k];
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            X[d] = d_length_scale_factor * (X_all[d + k * NDIM] + d_posn_shift[d]);
+        }
+    }
+
+    plog << d_object_name << ":  "
+         << "read " << d_num_vertex[ln][j] << " vertices from binary input file named " << vertex_filename
+         << std::endl;
+    return;
+} // readBinaryVertexFile
+
 void
 IBStandardInitializer::readSpringFiles(const std::string& extension, const bool input_uses_global_idxs)
 {
@@ -321,6 +455,14 @@ IBStandardInitializer::readSpringFiles(const std::string& extension, const bool
                 (input_uses_global_idxs ? std::accumulate(d_num_vertex[ln].begin(), d_num_vertex[ln].end(), 0) :
                                           d_num_vertex[ln][j]);
 
+            // Binary input files are read by a single MPI process and do not
+            // require batons.
+            if (d_use_binary_files)
+            {
+                readBinarySpringFile(d_base_filename[ln][j] + extension + ".bin", ln, j, input_uses_global_idxs);
+                continue;
+            }
+
             // Wait for the previous MPI process to finish reading the current file.
             if (d_use_file_batons && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
 
@@ -439,72 +581,14 @@ IBStandardInitializer::readSpringFiles(const std::string& extension, const bool
                         }
                     }
 
-                    // Modify kappa and length according to whether uniform
-                    // values are to be employed for this particular structure.
-                    if (d_using_uniform_spring_stiffness[ln][j])
-                    {
-                        parameters[0] = d_uniform_spring_stiffness[ln][j];
-                    }
-                    if (d_using_uniform_spring_rest_length[ln][j])
-                    {
-                        parameters[1] = d_uniform_spring_rest_length[ln][j];
-                    }
-                    if (d_using_uniform_spring_force_fcn_idx[ln][j])
-                    {
-                        force_fcn_idx = d_uniform_spring_force_fcn_idx[ln][j];
-                    }
-
-                    // Check to see if the spring constant is zero and, if so,
-                    // emit a warning.
-                    if (!warned && d_enable_springs[ln][j] &&
-                        (parameters[0] == 0.0 || MathUtilities<double>::equalEps(parameters[0], 0.0)))
-                    {
-                        TBOX_WARNING(d_object_name << ":\n  Spring with zero spring constant "
-                                                      "encountered in ASCII input file named "
-                                                   << spring_filename << "." << std::endl);
-                        warned = true;
-                    }
-
-                    // Correct the edge numbers to be in the global Lagrangian indexing
-                    // scheme.
-                    if (!input_uses_global_idxs)
-                    {
-                        e.first += d_vertex_offset[ln][j];
-                        e.second += d_vertex_offset[ln][j];
-                    }
-
-                    // Initialize the map data corresponding to the present edge.
-                    //
-                    // Note that in the edge map, each edge is associated with only the
-                    // first vertex.
-                    if (e.first > e.second)
-                    {
-                        std::swap<int>(e.first, e.second);
-                    }
-                    bool found_connection = false;
-                    std::pair<std::multimap<int, Edge>::iterator, std::multimap<int, Edge>::iterator> range =
-                        d_spring_edge_map[ln][j].equal_range(e.first);
-                    for (auto it = range.first; it != range.second; ++it)
-                    {
-                        if (it->second == e) found_connection = true;
-                    }
-                    if (found_connection)
-                    {
-                        TBOX_WARNING(d_object_name
-                                     << ":\n  Duplicate spring connection between nodes "
-                                     << (e.first + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j])) << " and "
-                                     << (e.second + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j]))
-                                     << " encountered in ASCII input file named " << spring_filename << ".\n"
-                                     << "  Skipping duplicated connection." << std::endl);
-                    }
-                    else
-                    {
-                        d_spring_edge_map[ln][j].insert(std::make_pair(e.first, e));
-                        SpringSpec spec_data;
-                        spec_data.parameters = parameters;
-                        spec_data.force_fcn_idx = force_fcn_idx;
-                        d_spring_spec_data[ln][j].insert(std::make_pair(e, spec_data));
-                    }
+                    addSpring(e,
+                              std::move(parameters),
+                              force_fcn_idx,
+                              ln,
+                              j,
+                              input_uses_global_idxs,
+                              spring_filename,
+                              warned);
                 }
 
                 // Close the input file.
@@ -531,6 +615,157 @@ IBStandardInitializer::readSpringFiles(const std::string& extension, const bool
     return;
 } // readSpringFiles
 
+void
+IBStandardInitializer::readBinarySpringFile(const std::string& spring_filename,
+                                            const int ln,
+                                            const int j,
+                                            const bool input_uses_global_idxs)
+{
+    std::vector<char> buffer;
+    if (!read_and_broadcast_binary_file(spring_filename, buffer))
+    {
+        plog << d_object_name << ":  "
+             << " file " << spring_filename << " does not exist: skipping read." << std::endl;
+        return;
+    }
+    plog << d_object_name << ":  "
+         << "processing spring data from binary input file named " << spring_filename << std::endl;
+
+    // Determine min/max index ranges.
+    const int min_idx = 0;
+    const int max_idx =
+        (input_uses_global_idxs ? std::accumulate(d_num_vertex[ln].begin(), d_num_vertex[ln].end(), 0) :
+                                  d_num_vertex[ln][j]);
+
+    std::size_t pos = 0;
+    check_binary_file_tag(buffer, pos, "IBSPRING", spring_filename);
+    const int num_edges = read_binary_value<std::int32_t>(buffer, pos, spring_filename);
+    if (num_edges <= 0)
+    {
+        TBOX_ERROR(d_object_name << ":\n  Invalid number of springs " << num_edges << " in binary input file "
+                                 << spring_filename << std::endl);
+    }
+    bool warned = false;
+    for (int k = 0; k < num_edges; ++k)
+    {
+        Edge e;
+        e.first = read_binary_value<std::int32_t>(buffer, pos, spring_filename);
+        e.second = read_binary_value<std::int32_t>(buffer, pos, spring_filename);
+        if (e.first < min_idx || e.first >= max_idx || e.second < min_idx || e.second >= max_idx)
+        {
+            TBOX_ERROR(d_object_name << ":\n  Invalid entry for spring " << k << " in binary input file "
+                                     << spring_filename << std::endl
+                                     << "  vertex index is out of range" << std::endl);
+        }
+        const int force_fcn_idx = read_binary_value<std::int32_t>(buffer, pos, spring_filename);
+        const int num_parameters = read_binary_value<std::int32_t>(buffer, pos, spring_filename);
+        if (num_parameters < 2)
+        {
+            TBOX_ERROR(d_object_name << ":\n  Invalid entry for spring " << k << " in binary input file "
+                                     << spring_filename << std::endl
+                                     << "  at least two parameters are required" << std::endl);
+        }
+        std::vector<double> parameters(num_parameters);
+        for (auto& param : parameters) param = read_binary_value<double>(buffer, pos, spring_filename);
+        if (parameters[0] < 0.0)
+        {
+            TBOX_ERROR(d_object_name << ":\n  Invalid entry for spring " << k << " in binary input file "
+                                     << spring_filename << std::endl
+                                     << "  spring constant is negative" << std::endl);
+        }
+        if (parameters[1] < 0.0)
+        {
+            TBOX_ERROR(d_object_name << ":\n  Invalid entry for spring " << k << " in binary input file "
+                                     << spring_filename << std::endl
+                                     << "  spring resting length is negative" << std::endl);
+        }
+        parameters[1] *= d_length_scale_factor;
+        addSpring(e, std::move(parameters), force_fcn_idx, ln, j, input_uses_global_idxs, spring_filename, warned);
+    }
+
+    plog << d_object_name << ":  "
+         << "read " << num_edges << " edges from binary input file named " << spring_filename << std::endl;
+    return;
+} // readBinarySpringFile
+
+bool
+IBStandardInitializer::addSpring(Edge e,
+                                 std::vector<double> parameters,
+                                 int force_fcn_idx,
+                                 const int ln,
+                                 const int j,
+                                 const bool input_uses_global_idxs,
+                                 const std::string& spring_filename,
+                                 bool& warned)
+{
+    // Modify kappa and length according to whether uniform
+    // values are to be employed for this particular structure.
+    if (d_using_uniform_spring_stiffness[ln][j])
+    {
+        parameters[0] = d_uniform_spring_stiffness[ln][j];
+    }
+    if (d_using_uniform_spring_rest_length[ln][j])
+    {
+        parameters[1] = d_uniform_spring_rest_length[ln][j];
+    }
+    if (d_using_uniform_spring_force_fcn_idx[ln][j])
+    {
+        force_fcn_idx = d_uniform_spring_force_fcn_idx[ln][j];
+    }
+
+    // Check to see if the spring constant is zero and, if so,
+    // emit a warning.
+    if (!warned && d_enable_springs[ln][j] &&
+        (parameters[0] == 0.0 || MathUtilities<double>::equalEps(parameters[0], 0.0)))
+    {
+        TBOX_WARNING(d_object_name << ":\n  Spring with zero spring constant "
+                                      "encountered in input file named "
+                                   << spring_filename << "." << std::endl);
+        warned = true;
+    }
+
+    // Correct the edge numbers to be in the global Lagrangian indexing
+    // scheme.
+    if (!input_uses_global_idxs)
+    {
+        e.first += d_vertex_offset[ln][j];
+        e.second += d_vertex_offset[ln][j];
+    }
+
+    // Initialize the map data corresponding to the present edge.
+    //
+    // Note that in the edge map, each edge is associated with only the
+    // first vertex.
+    if (e.first > e.second)
+    {
+        std::swap<int>(e.first, e.second);
+    }
+    bool found_connection = false;
+    std::pair<std::multimap<int, Edge>::iterator, std::multimap<int, Edge>::iterator> range =
+        d_spring_edge_map[ln][j].equal_range(e.first);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (it->second == e) found_connection = true;
+    }
+    if (found_connection)
+    {
+        TBOX_WARNING(d_object_name
+                     << ":\n  Duplicate spring connection between nodes "
+                     << (e.first + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j])) << " and "
+                     << (e.second + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j]))
+                     << " encountered in input file named " << spring_filename << ".\n"
+                     << "  Skipping duplicated connection." << std::endl);
+        return false;
+    }
+    d_spring_edge_map[ln][j].insert(std::make_pair(e.first, e));
+    SpringSpec spec_data;
+    spec_data.parameters = std::move(parameters);
+    spec_data.force_fcn_idx = force_fcn_idx;
+    d_spring_spec_data[ln][j].insert(std::make_pair(e, spec_data));
+    return true;
+
+} // addSpring
+
 void
 IBStandardInitializer::readXSpringFiles(const std::string& extension, const bool input_uses_global_idxs)
 {
@@ -2582,6 +2817,9 @@ IBStandardInitializer::getFromInput(Pointer<Database> db)
     // reading the same file at once.
     if (db->keyExists("use_file_batons")) d_use_file_batons = db->getBool("use_file_batons");
 
+    // Determine whether to read vertex and spring data from binary files.
+    if (db->keyExists("use_binary_files")) d_use_binary_files = db->getBool("use_binary_files");
+
     // Determine the (maximum) number of levels in the locally refined grid.
     // Note that each piece of the Lagrangian structure must be assigned to a
     // particular level of the grid.
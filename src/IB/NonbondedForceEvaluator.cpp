@@ -16,6 +16,7 @@
 #include "ibamr/NonbondedForceEvaluator.h"
 #include "ibamr/app_namespaces.h" // IWYU pragma: keep
 
+#include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/LData.h"
 #include "ibtk/LDataManager.h"
 #include "ibtk/LIndexSetData.h"
@@ -25,10 +26,9 @@
 #include "ibtk/LSetData.h"
 
 #include "Box.h"
-#include "CartesianPatchGeometry.h"
-#include "CellIndex.h"
-#include "CellIterator.h"
+#include "BoxArray.h"
 #include "Index.h"
+#include "IntVector.h"
 #include "Patch.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
@@ -42,7 +42,9 @@
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
 #include <string>
+#include <vector>
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
@@ -65,6 +67,7 @@ NonbondedForceEvaluator::NonbondedForceEvaluator(Pointer<Database> input_db,
     {
         TBOX_ERROR("Must specify interaction_radius for NonbondedForceEvaluator.");
     }
+    if (d_interaction_radius <= 0.0) TBOX_ERROR("interaction_radius for NonbondedForceEvaluator must be positive.");
 
     // get regrid_alpha
     if (input_db->keyExists("regrid_alpha"))
@@ -79,6 +82,13 @@ NonbondedForceEvaluator::NonbondedForceEvaluator(Pointer<Database> input_db,
     // this will only work if the domain is a single box.
     assert(d_grid_geometry->getDomainIsSingleBox());
 
+    // get neighbor list skin distance
+    if (input_db->keyExists("skin"))
+    {
+        d_skin = input_db->getDouble("skin");
+    }
+    if (d_skin < 0.0) TBOX_ERROR("skin for NonbondedForceEvaluator must be nonnegative.");
+
     // get parameters for force function
     d_parameters = input_db->getDoubleArray("parameters");
 }
@@ -87,7 +97,7 @@ void
 NonbondedForceEvaluator::evaluateForces(int mstr_petsc_idx,
                                         int search_petsc_idx,
                                         Pointer<LData> X_data,
-                                        std::vector<int> cell_offset,
+                                        const std::vector<int>& cell_offset,
                                         Pointer<LData> F_data)
 {
     //   Function to add nonbonded forces from the interaction between the nodes at
@@ -107,39 +117,61 @@ NonbondedForceEvaluator::evaluateForces(int mstr_petsc_idx,
     //
     //////////////////////////////////////////////////////////////////////////////////
 
-    // get vectors of data
-    // How costly is this?  TODO: Check, maybe just do this once in the loop.
-    PetscScalar* position;
-    VecGetArray(X_data->getVec(), &position);
-    PetscScalar* force;
-    VecGetArray(F_data->getVec(), &force);
-
     // get domain bounds
-    const double* x_lower = d_grid_geometry->getXLower();
-    const double* x_upper = d_grid_geometry->getXUpper();
+    const double* const x_lower = d_grid_geometry->getXLower();
+    const double* const x_upper = d_grid_geometry->getXUpper();
+    double periodic_shift[NDIM];
+    for (int k = 0; k < NDIM; ++k)
+    {
+        periodic_shift[k] = cell_offset[k] * (x_upper[k] - x_lower[k]);
+    }
 
-    double R = 0.0; // distance between particles
-    double D[NDIM]; // vector connecting particles.
+    const double* const X = X_data->getGhostedLocalFormVecArray()->data();
+    double* const F = F_data->getGhostedLocalFormVecArray()->data();
+    evaluateForces(mstr_petsc_idx, search_petsc_idx, X, periodic_shift, F);
+    X_data->restoreArrays();
+    F_data->restoreArrays();
+    return;
+} // evaluateForces
 
+void
+NonbondedForceEvaluator::evaluateForces(int mstr_petsc_idx,
+                                        int search_petsc_idx,
+                                        const double* const X,
+                                        const double* const periodic_shift,
+                                        double* const F) const
+{
+    TBOX_ASSERT(d_force_fcn_ptr);
+    double D[NDIM]; // vector connecting particles.
     for (int k = 0; k < NDIM; ++k)
     {
-        D[k] = (position[mstr_petsc_idx * NDIM + k] - position[search_petsc_idx * NDIM + k] -
-                cell_offset[k] * (x_upper[k] - x_lower[k]));
-        R += std::pow(D[k], 2);
+        D[k] = X[mstr_petsc_idx * NDIM + k] - X[search_petsc_idx * NDIM + k] - periodic_shift[k];
     }
-    R = std::sqrt(R);
 
     double nonbdd_force[NDIM];
     (d_force_fcn_ptr)(D, d_parameters, nonbdd_force);
     for (int k = 0; k < NDIM; ++k)
     {
-        force[mstr_petsc_idx * NDIM + k] += nonbdd_force[k];
-        force[search_petsc_idx * NDIM + k] += -1.0 * nonbdd_force[k];
+        F[mstr_petsc_idx * NDIM + k] += nonbdd_force[k];
+        F[search_petsc_idx * NDIM + k] -= nonbdd_force[k];
     }
-    VecRestoreArray(F_data->getVec(), &force);
     return;
 } // evaluateForces
 
+void
+NonbondedForceEvaluator::initializeLevelData(const Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
+                                             const int level_number,
+                                             const double /*init_data_time*/,
+                                             const bool /*initial_time*/,
+                                             LDataManager* const /*l_data_manager*/)
+{
+    // The local PETSc indices are no longer valid after the Lagrangian data
+    // have been redistributed.
+    if (static_cast<int>(d_neighbor_lists.size()) <= level_number) d_neighbor_lists.resize(level_number + 1);
+    d_neighbor_lists[level_number] = NeighborList();
+    return;
+} // initializeLevelData
+
 void
 NonbondedForceEvaluator::computeLagrangianForce(Pointer<LData> F_data,
                                                 Pointer<LData> X_data,
@@ -148,98 +180,270 @@ NonbondedForceEvaluator::computeLagrangianForce(Pointer<LData> F_data,
                                                 const int level_number,
                                                 const double /*data_time*/,
                                                 LDataManager* const l_data_manager)
+{
+    TBOX_ASSERT(d_force_fcn_ptr);
+    if (static_cast<int>(d_neighbor_lists.size()) <= level_number) d_neighbor_lists.resize(level_number + 1);
+
+    // Positions of ghost nodes are needed to evaluate forces with nodes owned by
+    // other processors.
+    const int num_local_nodes = X_data->getLocalNodeCount();
+    const int num_ghosted_nodes = num_local_nodes + X_data->getGhostNodeCount();
+    X_data->beginGhostUpdate();
+    X_data->endGhostUpdate();
+
+    // Acquire the arrays once for all of the interacting pairs.
+    const double* const X = X_data->getGhostedLocalFormVecArray()->data();
+    if (!neighborListIsValid(level_number, X, num_ghosted_nodes))
+    {
+        buildNeighborList(X, num_ghosted_nodes, hierarchy, level_number, l_data_manager);
+    }
+    double* const F = F_data->getGhostedLocalFormVecArray()->data();
+    std::fill(F + NDIM * num_local_nodes, F + NDIM * num_ghosted_nodes, 0.0);
+
+    // Evaluate the forces between all pairs within the interaction radius.  Each
+    // pair is stored once, and the equal and opposite forces are applied to both
+    // nodes.  The list also contains pairs that are within the skin distance of
+    // the interaction radius; these are skipped so that the computed forces do
+    // not depend on the skin.
+    const NeighborList& neighbor_list = d_neighbor_lists[level_number];
+    const double cutoff_sq = std::pow(d_interaction_radius * neighbor_list.dx_min, 2);
+    const std::size_t num_pairs = neighbor_list.pairs.size() / 2;
+    for (std::size_t p = 0; p < num_pairs; ++p)
+    {
+        const int mstr_petsc_idx = neighbor_list.pairs[2 * p];
+        const int search_petsc_idx = neighbor_list.pairs[2 * p + 1];
+        const double* const periodic_shift = &neighbor_list.periodic_shifts[NDIM * p];
+        double D[NDIM];
+        double R_sq = 0.0;
+        for (int k = 0; k < NDIM; ++k)
+        {
+            D[k] = X[mstr_petsc_idx * NDIM + k] - X[search_petsc_idx * NDIM + k] - periodic_shift[k];
+            R_sq += D[k] * D[k];
+        }
+        if (R_sq > cutoff_sq) continue;
+
+        double nonbdd_force[NDIM];
+        (d_force_fcn_ptr)(D, d_parameters, nonbdd_force);
+        for (int k = 0; k < NDIM; ++k)
+        {
+            F[mstr_petsc_idx * NDIM + k] += nonbdd_force[k];
+            F[search_petsc_idx * NDIM + k] -= nonbdd_force[k];
+        }
+    }
+    X_data->restoreArrays();
+    F_data->restoreArrays();
+
+    // Accumulate the forces on ghost nodes onto the processors that own them.
+    int ierr;
+    ierr = VecGhostUpdateBegin(F_data->getVec(), ADD_VALUES, SCATTER_REVERSE);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGhostUpdateEnd(F_data->getVec(), ADD_VALUES, SCATTER_REVERSE);
+    IBTK_CHKERRQ(ierr);
+    double* const F_ghosted = F_data->getGhostedLocalFormVecArray()->data();
+    std::fill(F_ghosted + NDIM * num_local_nodes, F_ghosted + NDIM * num_ghosted_nodes, 0.0);
+    F_data->restoreArrays();
+    return;
+} // computeLagrangianForce
+
+void
+NonbondedForceEvaluator::registerForceFcnPtr(NonBddForceFcnPtr force_fcn_ptr)
+{
+    // set the nonbonded force function pointer to the given force function pointer
+    d_force_fcn_ptr = force_fcn_ptr;
+    return;
+} // registerForceFcnPtr
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+bool
+NonbondedForceEvaluator::neighborListIsValid(const int level_number,
+                                             const double* const X,
+                                             const int num_ghosted_nodes) const
+{
+    const NeighborList& neighbor_list = d_neighbor_lists[level_number];
+    if (!neighbor_list.valid || d_skin <= 0.0) return false;
+    if (neighbor_list.X_ref.size() != static_cast<std::size_t>(NDIM * num_ghosted_nodes)) return false;
+
+    // The list remains valid as long as no node has moved more than half of
+    // the skin distance since the list was built.
+    const double max_displacement_sq = std::pow(0.5 * d_skin * neighbor_list.dx_min, 2);
+    for (int i = 0; i < num_ghosted_nodes; ++i)
+    {
+        double displacement_sq = 0.0;
+        for (int k = 0; k < NDIM; ++k)
+        {
+            displacement_sq += std::pow(X[NDIM * i + k] - neighbor_list.X_ref[NDIM * i + k], 2);
+        }
+        if (displacement_sq > max_displacement_sq) return false;
+    }
+    return true;
+} // neighborListIsValid
+
+void
+NonbondedForceEvaluator::buildNeighborList(const double* const X,
+                                           const int num_ghosted_nodes,
+                                           const Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                           const int level_number,
+                                           LDataManager* const l_data_manager)
 {
     // Get grid geometry and relevant lower and upper limits.
     Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
     if (!grid_geom->getDomainIsSingleBox()) TBOX_ERROR("physical domain must be a single box...\n");
-
-    // These will only work if the domain is a single box.
-    assert(grid_geom->getDomainIsSingleBox());
     const double* const x_lower = grid_geom->getXLower();
     const double* const x_upper = grid_geom->getXUpper();
+    const double* const dx_coarsest = grid_geom->getDx();
 
-    // we will grow the search box by interaction_radius + 2.0*regrid_alpha
-    IntVector<NDIM> grow_amount(static_cast<int>(ceil(d_interaction_radius + 2.0 * d_regrid_alpha)));
+    Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
+    const Box<NDIM> domain_box = level->getPhysicalDomain()[0];
+    const IntVector<NDIM>& ratio = level->getRatio();
+    double dx_min = std::numeric_limits<double>::max();
+    for (int k = 0; k < NDIM; ++k)
+    {
+        dx_min = std::min(dx_min, dx_coarsest[k] / static_cast<double>(ratio(k)));
+    }
+
+    NeighborList& neighbor_list = d_neighbor_lists[level_number];
+    neighbor_list.valid = true;
+    neighbor_list.dx_min = dx_min;
+    neighbor_list.pairs.clear();
+    neighbor_list.periodic_shifts.clear();
+    neighbor_list.X_ref.assign(X, X + NDIM * num_ghosted_nodes);
+
+    // Pairs are retained if they are within the interaction radius plus the
+    // skin distance.  Because nodes may have moved by up to regrid_alpha cells
+    // since they were last binned, we search over interaction_radius + skin +
+    // 2.0*regrid_alpha cells.
+    const double list_radius = (d_interaction_radius + d_skin) * dx_min;
+    const double list_radius_sq = list_radius * list_radius;
+    const IntVector<NDIM> grow_amount(
+        static_cast<int>(std::ceil(d_interaction_radius + d_skin + 2.0 * d_regrid_alpha)));
     const int lag_node_idx_current_idx = l_data_manager->getLNodePatchDescriptorIndex();
 
-    // iterate through levels.
-    Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
+    std::vector<int> node_petsc_idxs, node_lag_idxs;
+    std::vector<char> node_is_mstr;
+    std::vector<double> node_X, node_shift;
+    std::vector<int> bin_head, bin_next;
     for (PatchLevel<NDIM>::Iterator p(level); p; p++)
     {
         Pointer<Patch<NDIM> > patch = level->getPatch(p());
         Pointer<LNodeSetData> current_idx_data = patch->getPatchData(lag_node_idx_current_idx);
         const Box<NDIM>& patch_box = patch->getBox();
-        const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
-        const double* const patch_dx = patch_geom->getDx();
-
-        std::vector<int> cell_offset(NDIM);
-        // Loop through cells in this processors patch. For each iteration, this
-        // is the "master" cell. Iterate through particles in the box, and add
-        // springs.
-        for (LNodeSetData::CellIterator cit(patch_box); cit; cit++)
+        const Box<NDIM> search_box = Box<NDIM>::grow(patch_box, grow_amount) * current_idx_data->getGhostBox();
+
+        // Collect the nodes in the search box along with the positions of their
+        // periodic images.  The periodic offset of each node is determined
+        // directly from the index of the cell that contains it.
+        node_petsc_idxs.clear();
+        node_lag_idxs.clear();
+        node_is_mstr.clear();
+        node_X.clear();
+        node_shift.clear();
+        for (LNodeSetData::DataIterator it = current_idx_data->data_begin(search_box);
+             it != current_idx_data->data_end();
+             ++it)
         {
-            // get list of particles in this cell
-            const hier::Index<NDIM>& first_cell_idx = *cit;
-            LNodeSet* const mstr_node_set = current_idx_data->getItem(first_cell_idx);
-            if (mstr_node_set)
+            const LNode* const node_idx = *it;
+            const hier::Index<NDIM>& cell_idx = it.getCellIndex();
+            const int petsc_idx = node_idx->getLocalPETScIndex();
+            node_petsc_idxs.push_back(petsc_idx);
+            node_lag_idxs.push_back(node_idx->getLagrangianIndex());
+            node_is_mstr.push_back(patch_box.contains(cell_idx));
+            for (int k = 0; k < NDIM; ++k)
             {
-                Box<NDIM> search_box(first_cell_idx, first_cell_idx);
-                // loop over neighboring cells, up to interaction_radius +
-                // 2*regrid_alpha away.
-                for (LNodeSetData::CellIterator scit(Box<NDIM>::grow(search_box, grow_amount)); scit; scit++)
-                {
-                    // loop over particles in the neighbor cell, adding up
-                    // forces onto the particle in the "master" cell At this
-                    // point we know both cells, need to figure out periodic
-                    // additions.
-                    const hier::Index<NDIM>& search_cell_idx = *scit;
+                const double cell_diff = static_cast<double>(cell_idx(k) - domain_box.lower(k));
+                const int cell_offset =
+                    static_cast<int>(std::floor(cell_diff / static_cast<double>(domain_box.numberCells(k))));
+                const double shift = cell_offset * (x_upper[k] - x_lower[k]);
+                node_shift.push_back(shift);
+                node_X.push_back(X[NDIM * petsc_idx + k] + shift);
+            }
+        }
+        const int num_nodes = static_cast<int>(node_petsc_idxs.size());
+        if (num_nodes == 0) continue;
 
-                    // search across periodic boundaries.
+        // Bin the periodic images into a linked-cell structure with bins that are
+        // at least as wide as the neighbor list radius.
+        double X_min[NDIM], X_max[NDIM], bin_width[NDIM];
+        int num_bins[NDIM];
+        std::fill(X_min, X_min + NDIM, std::numeric_limits<double>::max());
+        std::fill(X_max, X_max + NDIM, -std::numeric_limits<double>::max());
+        for (int i = 0; i < num_nodes; ++i)
+        {
+            for (int k = 0; k < NDIM; ++k)
+            {
+                X_min[k] = std::min(X_min[k], node_X[NDIM * i + k]);
+                X_max[k] = std::max(X_max[k], node_X[NDIM * i + k]);
+            }
+        }
+        int total_num_bins = 1;
+        for (int k = 0; k < NDIM; ++k)
+        {
+            num_bins[k] = std::max(1, static_cast<int>(std::floor((X_max[k] - X_min[k]) / list_radius)));
+            bin_width[k] = std::max((X_max[k] - X_min[k]) / static_cast<double>(num_bins[k]), list_radius);
+            total_num_bins *= num_bins[k];
+        }
+        auto bin_index = [&](const double* const x, int* const bin) {
+            for (int k = 0; k < NDIM; ++k)
+            {
+                bin[k] = std::min(num_bins[k] - 1, static_cast<int>((x[k] - X_min[k]) / bin_width[k]));
+            }
+        };
+        bin_head.assign(total_num_bins, -1);
+        bin_next.assign(num_nodes, -1);
+        for (int i = num_nodes - 1; i >= 0; --i)
+        {
+            int bin[NDIM];
+            bin_index(&node_X[NDIM * i], bin);
+            int b = 0;
+            for (int k = NDIM - 1; k >= 0; --k) b = b * num_bins[k] + bin[k];
+            bin_next[i] = bin_head[b];
+            bin_head[b] = i;
+        }
+
+        // Loop over the "master" nodes in the patch interior and search the
+        // neighboring bins.  Each pair is recorded only once, from the node with
+        // the smaller Lagrangian index.
+        for (int i = 0; i < num_nodes; ++i)
+        {
+            if (!node_is_mstr[i]) continue;
+            int bin[NDIM];
+            bin_index(&node_X[NDIM * i], bin);
+            int num_neighbor_bins = 1;
+            for (int k = 0; k < NDIM; ++k) num_neighbor_bins *= 3;
+            for (int n = 0; n < num_neighbor_bins; ++n)
+            {
+                int b = 0, code = n;
+                bool in_range = true;
+                int neighbor_bin[NDIM];
+                for (int k = 0; k < NDIM; ++k)
+                {
+                    neighbor_bin[k] = bin[k] + code % 3 - 1;
+                    code /= 3;
+                    in_range = in_range && neighbor_bin[k] >= 0 && neighbor_bin[k] < num_bins[k];
+                }
+                if (!in_range) continue;
+                for (int k = NDIM - 1; k >= 0; --k) b = b * num_bins[k] + neighbor_bin[k];
+                for (int j = bin_head[b]; j != -1; j = bin_next[j])
+                {
+                    if (node_lag_idxs[i] >= node_lag_idxs[j]) continue;
+                    double R_sq = 0.0;
                     for (int k = 0; k < NDIM; ++k)
                     {
-                        // Difference between lower boundary and this search cell.
-                        double absolute_diff = search_cell_idx[k] * patch_dx[k];
-                        // Periodic offset of this cell.
-                        cell_offset[k] = floor(absolute_diff / (x_upper[k] - x_lower[k]));
+                        R_sq += std::pow(node_X[NDIM * i + k] - node_X[NDIM * j + k], 2);
                     }
-                    LNodeSet* search_node_set = current_idx_data->getItem(search_cell_idx);
-                    if (search_node_set)
+                    if (R_sq > list_radius_sq) continue;
+                    neighbor_list.pairs.push_back(node_petsc_idxs[i]);
+                    neighbor_list.pairs.push_back(node_petsc_idxs[j]);
+                    for (int k = 0; k < NDIM; ++k)
                     {
-                        // we have a set of nodes in the first cell and the search cell,
-                        // add up forces
-                        // and accumulate for the first cell.
-                        for (const auto& mstr_node_idx : *mstr_node_set)
-                        {
-                            // master nodes
-                            const int mstr_lag_idx = mstr_node_idx->getLagrangianIndex();
-                            const int mstr_petsc_idx = mstr_node_idx->getLocalPETScIndex();
-
-                            for (const auto& search_node_idx : *search_node_set)
-                            {
-                                const int search_lag_idx = search_node_idx->getLagrangianIndex();
-                                const int search_petsc_idx = search_node_idx->getLocalPETScIndex();
-                                if (mstr_lag_idx < search_lag_idx)
-                                {
-                                    // apply forces with the force evaluator
-                                    evaluateForces(mstr_petsc_idx, search_petsc_idx, X_data, cell_offset, F_data);
-                                }
-                            } // search node index
-                        }     // mstr node index
-                    }         // if(search node set)
-                }             // search cell loop
-            }                 // if mastr_node_idx
-        }                     // first cell
-    }                         // patches
-    return;
-} // computeLagrangianForce
-
-void
-NonbondedForceEvaluator::registerForceFcnPtr(NonBddForceFcnPtr force_fcn_ptr)
-{
-    // set the nonbonded force function pointer to the given force function pointer
-    d_force_fcn_ptr = force_fcn_ptr;
+                        neighbor_list.periodic_shifts.push_back(node_shift[NDIM * j + k] - node_shift[NDIM * i + k]);
+                    }
+                }
+            }
+        }
+    }
     return;
-} // registerForceFcnPtr
+} // buildNeighborList
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -52,10 +52,10 @@ IBTK_DISABLE_EXTRA_WARNINGS
 #include <Eigen/Cholesky>
 #include <Eigen/Core>
 #include <Eigen/Eigenvalues>
-#include <unsupported/Eigen/MatrixFunctions>
 IBTK_ENABLE_EXTRA_WARNINGS
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <ostream>
 #include <utility>
@@ -117,6 +117,199 @@ extern "C"
 // Namespace
 namespace IBAMR
 {
+namespace
+{
+// Number of independent components of a symmetric NDIM x NDIM tensor.
+static const int NVOIGT = NDIM * (NDIM + 1) / 2;
+
+// Pointers to the Voigt components of the symmetric tensors stored in a
+// patch data object.
+using VoigtArrays = std::array<double*, NVOIGT>;
+
+/*!
+ * Apply kernel to the symmetric tensors stored in data on the cells of box.
+ *
+ * The kernel is called once for each contiguous row of cells along the first
+ * coordinate direction, so that it operates on unit-stride arrays.
+ */
+template <class Kernel>
+void
+apply_sym_tensor_kernel(CellData<NDIM, double>& data, const Box<NDIM>& box, Kernel kernel)
+{
+    if (box.empty()) return;
+    const Box<NDIM>& ghost_box = data.getGhostBox();
+    VoigtArrays s;
+    for (int k = 0; k < NVOIGT; ++k) s[k] = data.getPointer(k);
+    Box<NDIM> row_box = box;
+    row_box.upper()(0) = row_box.lower()(0);
+    const int n = box.numberCells(0);
+    for (Box<NDIM>::Iterator b(row_box); b; b++)
+    {
+        kernel(s, ghost_box.offset(b()), n);
+    }
+    return;
+} // apply_sym_tensor_kernel
+
+#if (NDIM == 3)
+/*!
+ * Replace the tensor stored at offset i by f(tens), computed from the
+ * closed-form eigendecomposition of the tensor.
+ */
+template <class Function>
+inline void
+apply_sym_tensor_function(const VoigtArrays& s, const int i, Function f)
+{
+    MatrixNd tens;
+    for (int k = 0; k < NVOIGT; ++k)
+    {
+        const std::pair<int, int>& idx = voigt_to_tensor_idx(k);
+        tens(idx.first, idx.second) = tens(idx.second, idx.first) = s[k][i];
+    }
+    Eigen::SelfAdjointEigenSolver<MatrixNd> eigs;
+    eigs.computeDirect(tens);
+    VectorNd eig_vals;
+    for (int d = 0; d < NDIM; ++d) eig_vals(d) = f(eigs.eigenvalues()(d));
+    const MatrixNd& eig_vecs = eigs.eigenvectors();
+    tens = eig_vecs * eig_vals.asDiagonal() * eig_vecs.transpose();
+    for (int k = 0; k < NVOIGT; ++k)
+    {
+        const std::pair<int, int>& idx = voigt_to_tensor_idx(k);
+        s[k][i] = tens(idx.first, idx.second);
+    }
+    return;
+} // apply_sym_tensor_function
+
+inline double
+clip_eigenvalue(const double lambda)
+{
+    return std::max(lambda, 0.0);
+} // clip_eigenvalue
+
+inline double
+exp_eigenvalue(const double lambda)
+{
+    return std::exp(lambda);
+} // exp_eigenvalue
+#endif
+
+// Replace each tensor by its square.
+void
+square_sym_tensors(const VoigtArrays& s, const int offset, const int n)
+{
+#if (NDIM == 2)
+    double* const xx = s[0] + offset;
+    double* const yy = s[1] + offset;
+    double* const xy = s[2] + offset;
+    for (int i = 0; i < n; ++i)
+    {
+        const double a = xx[i], b = yy[i], c = xy[i];
+        xx[i] = a * a + c * c;
+        yy[i] = b * b + c * c;
+        xy[i] = c * (a + b);
+    }
+#endif
+#if (NDIM == 3)
+    double* const xx = s[0] + offset;
+    double* const yy = s[1] + offset;
+    double* const zz = s[2] + offset;
+    double* const yz = s[3] + offset;
+    double* const xz = s[4] + offset;
+    double* const xy = s[5] + offset;
+    for (int i = 0; i < n; ++i)
+    {
+        const double a = xx[i], b = yy[i], c = zz[i], d = yz[i], e = xz[i], f = xy[i];
+        xx[i] = a * a + e * e + f * f;
+        yy[i] = b * b + d * d + f * f;
+        zz[i] = c * c + d * d + e * e;
+        yz[i] = d * (b + c) + e * f;
+        xz[i] = e * (a + c) + d * f;
+        xy[i] = f * (a + b) + d * e;
+    }
+#endif
+    return;
+} // square_sym_tensors
+
+// Replace each tensor by its matrix exponential.
+void
+exp_sym_tensors(const VoigtArrays& s, const int offset, const int n)
+{
+#if (NDIM == 2)
+    // With m = (a + b) / 2 and r = sqrt(((a - b) / 2)^2 + c^2), the matrix
+    // exponential is exp(m) * (cosh(r) I + sinh(r) / r (A - m I)).
+    double* const xx = s[0] + offset;
+    double* const yy = s[1] + offset;
+    double* const xy = s[2] + offset;
+    for (int i = 0; i < n; ++i)
+    {
+        const double m = 0.5 * (xx[i] + yy[i]);
+        const double h = 0.5 * (xx[i] - yy[i]);
+        const double c = xy[i];
+        const double r = std::sqrt(h * h + c * c);
+        const double exp_m = std::exp(m);
+        const double cosh_r = std::cosh(r);
+        const double sinhc_r = r > 0.0 ? std::sinh(r) / r : 1.0;
+        xx[i] = exp_m * (cosh_r + sinhc_r * h);
+        yy[i] = exp_m * (cosh_r - sinhc_r * h);
+        xy[i] = exp_m * sinhc_r * c;
+    }
+#endif
+#if (NDIM == 3)
+    for (int i = offset; i < offset + n; ++i) apply_sym_tensor_function(s, i, exp_eigenvalue);
+#endif
+    return;
+} // exp_sym_tensors
+
+// Replace each tensor by its projection onto the symmetric positive
+// semi-definite tensors, i.e., clip its negative eigenvalues to zero.
+void
+project_sym_tensors(const VoigtArrays& s, const int offset, const int n)
+{
+#if (NDIM == 2)
+    double* const xx = s[0] + offset;
+    double* const yy = s[1] + offset;
+    double* const xy = s[2] + offset;
+    for (int i = 0; i < n; ++i)
+    {
+        const double m = 0.5 * (xx[i] + yy[i]);
+        const double h = 0.5 * (xx[i] - yy[i]);
+        const double r = std::sqrt(h * h + xy[i] * xy[i]);
+        const double lambda_min = m - r, lambda_max = m + r;
+        if (lambda_min >= 0.0) continue;
+        if (lambda_max <= 0.0)
+        {
+            xx[i] = yy[i] = xy[i] = 0.0;
+            continue;
+        }
+        // The projection is lambda_max * v v^T, in which v is the unit
+        // eigenvector for lambda_max, and (A - lambda_min I) = 2 r v v^T.
+        const double fac = lambda_max / (2.0 * r);
+        xx[i] = fac * (xx[i] - lambda_min);
+        yy[i] = fac * (yy[i] - lambda_min);
+        xy[i] = fac * xy[i];
+    }
+#endif
+#if (NDIM == 3)
+    double* const xx = s[0] + offset;
+    double* const yy = s[1] + offset;
+    double* const zz = s[2] + offset;
+    double* const yz = s[3] + offset;
+    double* const xz = s[4] + offset;
+    double* const xy = s[5] + offset;
+    for (int i = 0; i < n; ++i)
+    {
+        // Skip positive definite tensors, which are identified by their
+        // leading principal minors.
+        const double a = xx[i], b = yy[i], c = zz[i], d = yz[i], e = xz[i], f = xy[i];
+        const double minor_2 = a * b - f * f;
+        const double det = a * (b * c - d * d) - f * (f * c - d * e) + e * (f * d - b * e);
+        if (a > 0.0 && minor_2 > 0.0 && det > 0.0) continue;
+        apply_sym_tensor_function(s, offset + i, clip_eigenvalue);
+    }
+#endif
+    return;
+} // project_sym_tensors
+} // namespace
+
 CFINSForcing::CFINSForcing(const std::string& object_name,
                            Pointer<Database> input_db,
                            Pointer<CartGridFunction> u_fcn,
@@ -736,24 +929,7 @@ CFINSForcing::squareMatrix(const int data_idx,
             if (initial_time) return;
             Pointer<CellData<NDIM, double> > data = patch->getPatchData(data_idx);
             const Box<NDIM>& box = extended_box ? data->getGhostBox() : patch->getBox();
-            const Pointer<PatchGeometry<NDIM> > p_geom = patch->getPatchGeometry();
-
-            for (CellIterator<NDIM> it(box); it; it++)
-            {
-                CellIndex<NDIM> i = *it;
-                MatrixNd tens;
-                for (int k = 0; k < NDIM * (NDIM + 1) / 2; ++k)
-                {
-                    const std::pair<int, int>& idx = voigt_to_tensor_idx(k);
-                    tens(idx.first, idx.second) = tens(idx.second, idx.first) = (*data)(i, k);
-                }
-                tens = tens * tens;
-                for (int k = 0; k < NDIM * (NDIM + 1) / 2; ++k)
-                {
-                    const std::pair<int, int>& idx = voigt_to_tensor_idx(k);
-                    (*data)(i, k) = tens(idx.first, idx.second);
-                }
-            }
+            apply_sym_tensor_kernel(*data, box, square_sym_tensors);
         }
     }
     return;
@@ -812,22 +988,7 @@ CFINSForcing::exponentiateMatrix(const int data_idx,
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             Pointer<CellData<NDIM, double> > data = patch->getPatchData(data_idx);
             const Box<NDIM>& box = extended_box ? data->getGhostBox() : patch->getBox();
-            for (CellIterator<NDIM> it(box); it; it++)
-            {
-                CellIndex<NDIM> i = *it;
-                MatrixNd tens;
-                for (int k = 0; k < NDIM * (NDIM + 1) / 2; ++k)
-                {
-                    const std::pair<int, int>& idx = voigt_to_tensor_idx(k);
-                    tens(idx.first, idx.second) = tens(idx.second, idx.first) = (*data)(i, k);
-                }
-                tens = tens.exp();
-                for (int k = 0; k < NDIM * (NDIM + 1) / 2; ++k)
-                {
-                    const std::pair<int, int>& idx = voigt_to_tensor_idx(k);
-                    (*data)(i, k) = tens(idx.first, idx.second);
-                }
-            }
+            apply_sym_tensor_kernel(*data, box, exp_sym_tensors);
         }
     }
     return;
@@ -850,30 +1011,7 @@ CFINSForcing::projectTensor(const int data_idx,
             if (initial_time) return;
             Pointer<CellData<NDIM, double> > data = patch->getPatchData(data_idx);
             const Box<NDIM>& box = extended_box ? data->getGhostBox() : patch->getBox();
-            for (CellIterator<NDIM> it(box); it; it++)
-            {
-                CellIndex<NDIM> i = *it;
-                MatrixNd tens;
-                Eigen::SelfAdjointEigenSolver<MatrixNd> eigs;
-                for (int k = 0; k < NDIM * (NDIM + 1) / 2; ++k)
-                {
-                    const std::pair<int, int>& idx = voigt_to_tensor_idx(k);
-                    tens(idx.first, idx.second) = tens(idx.second, idx.first) = (*data)(i, k);
-                }
-                eigs.computeDirect(tens);
-                MatrixNd eig_vals(MatrixNd::Zero());
-                for (int d = 0; d < NDIM; ++d)
-                {
-                    eig_vals(d, d) = std::max(eigs.eigenvalues()(d), 0.0);
-                }
-                MatrixNd eig_vecs = eigs.eigenvectors();
-                tens = eig_vecs * eig_vals * eig_vecs.transpose();
-                for (int k = 0; k < NDIM * (NDIM + 1) / 2; ++k)
-                {
-                    const std::pair<int, int>& idx = voigt_to_tensor_idx(k);
-                    (*data)(i, k) = tens(idx.first, idx.second);
-                }
-            }
+            apply_sym_tensor_kernel(*data, box, project_sym_tensors);
         }
     }
     return;
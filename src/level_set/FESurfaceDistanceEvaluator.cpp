@@ -91,6 +91,7 @@
 
 #include <algorithm>
 #include <array>
+#include <functional>
 #include <limits>
 #include <map>
 #include <memory>
@@ -159,6 +160,47 @@ make_edge(T2 n0, T2 n1)
     T1 e0(n1(0) - n0(0), n1(1) - n0(1), n1(2) - n0(2));
     return (e0);
 } // make_edge
+
+// Maximum number of elements in a leaf of a bounding volume hierarchy.
+static const int BVH_MAX_LEAF_ELEMS = 4;
+
+// Compute the bounding box of the nodes of an element.
+inline void
+get_elem_bounding_box(const Elem* const elem, IBTK::Vector3d& lower, IBTK::Vector3d& upper)
+{
+    lower.setZero();
+    upper.setZero();
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        lower[d] = std::numeric_limits<double>::max();
+        upper[d] = -std::numeric_limits<double>::max();
+    }
+    const unsigned int n_nodes = elem->n_nodes();
+    for (unsigned int k = 0; k < n_nodes; ++k)
+    {
+        const libMesh::Point& n = elem->point(k);
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            lower[d] = std::min(lower[d], n(d));
+            upper[d] = std::max(upper[d], n(d));
+        }
+    }
+    return;
+} // get_elem_bounding_box
+
+// Check whether two closed boxes overlap.
+inline bool
+boxes_overlap(const IBTK::Vector3d& lower0,
+              const IBTK::Vector3d& upper0,
+              const IBTK::Vector3d& lower1,
+              const IBTK::Vector3d& upper1)
+{
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        if (upper0[d] < lower1[d] || upper1[d] < lower0[d]) return false;
+    }
+    return true;
+} // boxes_overlap
 } // namespace
 
 const double FESurfaceDistanceEvaluator::s_large_distance = 1234567.0;
@@ -218,14 +260,18 @@ FESurfaceDistanceEvaluator::mapIntersections()
     IBTK_TIMER_STOP(t_collectNeighboringPatchElements);
     IBTK_TIMER_START(t_buildIntersectionMap);
 
-    // Clear out the data structure.
-    d_cell_elem_neighbor_map.clear();
-
     // Loop over patches on finest level, while keeping track of the local patch
     // indexing.
     Pointer<PatchLevel<NDIM> > level = d_patch_hierarchy->getPatchLevel(finest_ln);
     int local_patch_num = 0;
 
+    // Clear out the data structures.
+    const int num_local_patches = level->getProcessorMapping().getNumberOfLocalIndices();
+    d_patch_cell_elem_offsets.assign(num_local_patches, std::vector<int>());
+    d_patch_cell_elems.assign(num_local_patches, std::vector<Elem*>());
+    d_cell_elem_neighbor_map.clear();
+    d_cell_elem_neighbor_map_is_current = false;
+
     // Desired ghost cell width.
     IntVector<NDIM> ghost_width = d_gcw;
 
@@ -294,12 +340,13 @@ FESurfaceDistanceEvaluator::mapIntersections()
                                    IndexUtilities::getCellIndex(large_struct_tr.data(), grid_geom, level_ratio));
 
     // Map the neighbor intersections.
+    std::vector<int> bvh_stack;
+    std::vector<Elem*> cell_elems;
     for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
     {
         // The relevant collection of elements.
-        const std::vector<Elem*>& patch_elems = d_active_neighbor_patch_bdry_elem_map[local_patch_num];
-        const size_t num_active_patch_elems = patch_elems.size();
-        if (!num_active_patch_elems) continue;
+        const ElemBVH& bvh = d_patch_elem_bvh[local_patch_num];
+        if (bvh.nodes.empty()) continue;
 
         Pointer<Patch<NDIM> > patch = level->getPatch(p());
         const Box<NDIM>& patch_box = patch->getBox();
@@ -312,6 +359,11 @@ FESurfaceDistanceEvaluator::mapIntersections()
         // computations.
         if (!patch_box.intersects(struct_box)) continue;
 
+        std::vector<int>& cell_elem_offsets = d_patch_cell_elem_offsets[local_patch_num];
+        std::vector<Elem*>& patch_cell_elems = d_patch_cell_elems[local_patch_num];
+        cell_elem_offsets.reserve(patch_box.size() + 1);
+        cell_elem_offsets.push_back(0);
+
         // Loop over cells
         for (Box<NDIM>::Iterator it(patch_box); it; it++)
         {
@@ -321,6 +373,8 @@ FESurfaceDistanceEvaluator::mapIntersections()
             // the elements intersecting the neighbor.
             CellIndex<NDIM> ci(it());
             IBTK::Vector3d r_bl, r_tr;
+            r_bl.setZero();
+            r_tr.setZero();
             for (unsigned int d = 0; d < NDIM; ++d)
             {
                 r_bl[d] = patch_X_lower[d] +
@@ -333,7 +387,11 @@ FESurfaceDistanceEvaluator::mapIntersections()
             // checkIntersection routines.
             Box<NDIM> ghost_box(IndexUtilities::getCellIndex(r_bl.data(), grid_geom, level_ratio),
                                 IndexUtilities::getCellIndex(r_tr.data(), grid_geom, level_ratio));
-            if (!ghost_box.intersects(struct_box)) continue;
+            if (!ghost_box.intersects(struct_box))
+            {
+                cell_elem_offsets.push_back(static_cast<int>(patch_cell_elems.size()));
+                continue;
+            }
 
                 // Prepare the required vectors.
 #if (NDIM == 2)
@@ -354,35 +412,60 @@ FESurfaceDistanceEvaluator::mapIntersections()
             }
 #endif
 
-            // Loop over elements in the patch.
-            for (const auto& elem : patch_elems)
+            // Traverse the bounding volume hierarchy and only check the
+            // elements whose bounding boxes overlap the grown cell. Both
+            // intersection tests reject elements whose bounding boxes do not
+            // overlap the grown cell, so this does not change the result.
+            cell_elems.clear();
+            bvh_stack.assign(1, 0);
+            while (!bvh_stack.empty())
             {
-                // Get the coordinates of the nodes.
-                const libMesh::Point& n0 = elem->point(0);
-                const libMesh::Point& n1 = elem->point(1);
+                const BVHNode& node = bvh.nodes[bvh_stack.back()];
+                bvh_stack.pop_back();
+                if (!boxes_overlap(r_bl, r_tr, node.lower, node.upper)) continue;
+                if (node.left >= 0)
+                {
+                    bvh_stack.push_back(node.left);
+                    bvh_stack.push_back(node.right);
+                    continue;
+                }
+
+                for (int k = node.elem_begin; k < node.elem_end; ++k)
+                {
+                    Elem* const elem = bvh.sorted_elems[k];
+
+                    // Get the coordinates of the nodes.
+                    const libMesh::Point& n0 = elem->point(0);
+                    const libMesh::Point& n1 = elem->point(1);
 
 #if (NDIM == 3)
-                const libMesh::Point& n2 = elem->point(2);
+                    const libMesh::Point& n2 = elem->point(2);
 #endif
 
-                // Intersection detection routines.
+                    // Intersection detection routines.
 #if (NDIM == 2)
-                const bool found_intersection = checkIntersection2D(r_bl, r_tr, r_br, r_tl, n0, n1);
+                    const bool found_intersection = checkIntersection2D(r_bl, r_tr, r_br, r_tl, n0, n1);
 #endif
 #if (NDIM == 3)
-                // In 3D, it is more convenient to pass vertices as IBTK::Vector3d.
-                IBTK::Vector3d vert0, vert1, vert2;
-                vert0 << n0(0), n0(1), n0(2);
-                vert1 << n1(0), n1(1), n1(2);
-                vert2 << n2(0), n2(1), n2(2);
-                const bool found_intersection =
-                    checkIntersection3D(grown_box_center, grown_box_half_dx, vert0, vert1, vert2);
+                    // In 3D, it is more convenient to pass vertices as IBTK::Vector3d.
+                    IBTK::Vector3d vert0, vert1, vert2;
+                    vert0 << n0(0), n0(1), n0(2);
+                    vert1 << n1(0), n1(1), n1(2);
+                    vert2 << n2(0), n2(1), n2(2);
+                    const bool found_intersection =
+                        checkIntersection3D(grown_box_center, grown_box_half_dx, vert0, vert1, vert2);
 #endif
-                if (found_intersection)
-                {
-                    d_cell_elem_neighbor_map[ci].insert(elem);
+                    if (found_intersection)
+                    {
+                        cell_elems.push_back(elem);
+                    }
                 }
             }
+
+            // Store the elements in the same order as std::set<Elem*> would.
+            std::sort(cell_elems.begin(), cell_elems.end(), std::less<Elem*>());
+            patch_cell_elems.insert(patch_cell_elems.end(), cell_elems.begin(), cell_elems.end());
+            cell_elem_offsets.push_back(static_cast<int>(patch_cell_elems.size()));
         }
     }
 
@@ -394,6 +477,31 @@ FESurfaceDistanceEvaluator::mapIntersections()
 const std::map<CellIndex<NDIM>, std::set<Elem*>, CellIndexFortranOrder>&
 FESurfaceDistanceEvaluator::getNeighborIntersectionsMap()
 {
+    if (d_cell_elem_neighbor_map_is_current) return d_cell_elem_neighbor_map;
+
+    d_cell_elem_neighbor_map.clear();
+    const int finest_ln = d_patch_hierarchy->getFinestLevelNumber();
+    Pointer<PatchLevel<NDIM> > level = d_patch_hierarchy->getPatchLevel(finest_ln);
+    int local_patch_num = 0;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
+    {
+        if (local_patch_num >= static_cast<int>(d_patch_cell_elem_offsets.size())) break;
+        const std::vector<int>& cell_elem_offsets = d_patch_cell_elem_offsets[local_patch_num];
+        const std::vector<Elem*>& patch_cell_elems = d_patch_cell_elems[local_patch_num];
+        if (cell_elem_offsets.empty()) continue;
+
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        int cell_num = 0;
+        for (Box<NDIM>::Iterator it(patch->getBox()); it; it++, ++cell_num)
+        {
+            const int begin = cell_elem_offsets[cell_num];
+            const int end = cell_elem_offsets[cell_num + 1];
+            if (begin == end) continue;
+            d_cell_elem_neighbor_map[CellIndex<NDIM>(it())].insert(&patch_cell_elems[begin],
+                                                                   &patch_cell_elems[begin] + (end - begin));
+        }
+    }
+    d_cell_elem_neighbor_map_is_current = true;
     return d_cell_elem_neighbor_map;
 } // getNeighborIntersectionsMap
 
@@ -405,11 +513,18 @@ FESurfaceDistanceEvaluator::computeSignedDistance(int n_idx, int d_idx)
     TBOX_ASSERT(d_idx >= 0);
 #endif
 
-    // Loop over patches on finest level.
+    // Loop over patches on finest level, while keeping track of the local patch
+    // indexing.
     const int finest_ln = d_patch_hierarchy->getFinestLevelNumber();
     Pointer<PatchLevel<NDIM> > level = d_patch_hierarchy->getPatchLevel(finest_ln);
-    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    int local_patch_num = 0;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
     {
+        if (local_patch_num >= static_cast<int>(d_patch_cell_elem_offsets.size())) break;
+        const std::vector<int>& cell_elem_offsets = d_patch_cell_elem_offsets[local_patch_num];
+        const std::vector<Elem*>& patch_cell_elems = d_patch_cell_elems[local_patch_num];
+        if (cell_elem_offsets.empty()) continue;
+
         Pointer<Patch<NDIM> > patch = level->getPatch(p());
         const Box<NDIM>& patch_box = patch->getBox();
         const SAMRAI::hier::Index<NDIM>& patch_lower_index = patch_box.lower();
@@ -420,14 +535,15 @@ FESurfaceDistanceEvaluator::computeSignedDistance(int n_idx, int d_idx)
         Pointer<CellData<NDIM, double> > d_data = patch->getPatchData(d_idx);
 
         // Note that we only work with cells that satisfy the intersecting criteria.
-        for (Box<NDIM>::Iterator it(patch_box); it; it++)
+        int cell_num = 0;
+        for (Box<NDIM>::Iterator it(patch_box); it; it++, ++cell_num)
         {
             CellIndex<NDIM> ci(it());
-            const bool contains_key = (d_cell_elem_neighbor_map.find(ci) != d_cell_elem_neighbor_map.end());
-            if (contains_key)
+            const int elem_begin = cell_elem_offsets[cell_num];
+            const int elem_end = cell_elem_offsets[cell_num + 1];
+            if (elem_begin < elem_end)
             {
-                std::set<Elem*>& elem_set = d_cell_elem_neighbor_map[ci];
-                const int num_elements = static_cast<int>(elem_set.size());
+                const int num_elements = elem_end - elem_begin;
                 (*n_data)(ci) = num_elements;
 
                 // Loop over the cutting elements and find the minimum distance.
@@ -442,8 +558,9 @@ FESurfaceDistanceEvaluator::computeSignedDistance(int n_idx, int d_idx)
                 // equidistant to multiple elements.
                 std::vector<std::pair<IBTK::VectorNd, IBTK::VectorNd> > vec_equidistant_pair;
 
-                for (auto& elem : elem_set)
+                for (int k = elem_begin; k < elem_end; ++k)
                 {
+                    Elem* const elem = patch_cell_elems[k];
                     IBTK::VectorNd v, w, proj;
                     double dist = std::numeric_limits<double>::max();
 #if (NDIM == 2)
@@ -1456,8 +1573,121 @@ FESurfaceDistanceEvaluator::collectNeighboringPatchElements(int level_number)
             }
         }
     }
+
+    // Build the bounding volume hierarchies, or refit them when the elements
+    // associated with the patches have not changed.
+    d_patch_elem_bvh.resize(num_local_patches);
+    for (int k = 0; k < num_local_patches; ++k)
+    {
+        updateElemBVH(d_patch_elem_bvh[k], d_active_neighbor_patch_bdry_elem_map[k]);
+    }
     return;
 } // collectNeighboringPatchElements
+
+void
+FESurfaceDistanceEvaluator::updateElemBVH(ElemBVH& bvh, const std::vector<Elem*>& elems)
+{
+    const auto num_elems = static_cast<int>(elems.size());
+    if (num_elems == 0)
+    {
+        bvh.elems.clear();
+        bvh.sorted_elems.clear();
+        bvh.nodes.clear();
+        return;
+    }
+
+    // Rebuild the hierarchy when the set of elements has changed.
+    if (bvh.nodes.empty() || bvh.elems != elems)
+    {
+        bvh.elems = elems;
+        bvh.nodes.clear();
+        bvh.nodes.reserve(2 * (num_elems / BVH_MAX_LEAF_ELEMS + 1));
+
+        std::vector<IBTK::Vector3d> elem_centers(num_elems);
+        std::vector<int> elem_order(num_elems);
+        for (int k = 0; k < num_elems; ++k)
+        {
+            IBTK::Vector3d lower, upper;
+            get_elem_bounding_box(elems[k], lower, upper);
+            elem_centers[k] = 0.5 * (lower + upper);
+            elem_order[k] = k;
+        }
+
+        // Recursively split the nodes at the median of the element bounding
+        // box centers along the longest axis. Children are always appended
+        // after their parents.
+        bvh.nodes.emplace_back();
+        bvh.nodes[0].elem_begin = 0;
+        bvh.nodes[0].elem_end = num_elems;
+        std::vector<int> node_stack(1, 0);
+        while (!node_stack.empty())
+        {
+            const int node_idx = node_stack.back();
+            node_stack.pop_back();
+            const int begin = bvh.nodes[node_idx].elem_begin;
+            const int end = bvh.nodes[node_idx].elem_end;
+            if (end - begin <= BVH_MAX_LEAF_ELEMS) continue;
+
+            IBTK::Vector3d center_lower, center_upper;
+            center_lower.setConstant(std::numeric_limits<double>::max());
+            center_upper.setConstant(-std::numeric_limits<double>::max());
+            for (int k = begin; k < end; ++k)
+            {
+                const IBTK::Vector3d& c = elem_centers[elem_order[k]];
+                center_lower = center_lower.cwiseMin(c);
+                center_upper = center_upper.cwiseMax(c);
+            }
+            unsigned int axis = 0;
+            for (unsigned int d = 1; d < NDIM; ++d)
+            {
+                if (center_upper[d] - center_lower[d] > center_upper[axis] - center_lower[axis]) axis = d;
+            }
+            const int mid = begin + (end - begin) / 2;
+            std::nth_element(elem_order.begin() + begin,
+                             elem_order.begin() + mid,
+                             elem_order.begin() + end,
+                             [&elem_centers, axis](const int a, const int b) {
+                                 return elem_centers[a][axis] < elem_centers[b][axis];
+                             });
+
+            const auto left = static_cast<int>(bvh.nodes.size());
+            bvh.nodes.emplace_back();
+            bvh.nodes.back().elem_begin = begin;
+            bvh.nodes.back().elem_end = mid;
+            bvh.nodes.emplace_back();
+            bvh.nodes.back().elem_begin = mid;
+            bvh.nodes.back().elem_end = end;
+            bvh.nodes[node_idx].left = left;
+            bvh.nodes[node_idx].right = left + 1;
+            node_stack.push_back(left);
+            node_stack.push_back(left + 1);
+        }
+
+        bvh.sorted_elems.resize(num_elems);
+        for (int k = 0; k < num_elems; ++k) bvh.sorted_elems[k] = elems[elem_order[k]];
+    }
+
+    // Compute the bounding boxes from the current nodal positions, children
+    // before parents.
+    for (auto node = bvh.nodes.rbegin(); node != bvh.nodes.rend(); ++node)
+    {
+        if (node->left >= 0)
+        {
+            node->lower = bvh.nodes[node->left].lower.cwiseMin(bvh.nodes[node->right].lower);
+            node->upper = bvh.nodes[node->left].upper.cwiseMax(bvh.nodes[node->right].upper);
+            continue;
+        }
+        get_elem_bounding_box(bvh.sorted_elems[node->elem_begin], node->lower, node->upper);
+        for (int k = node->elem_begin + 1; k < node->elem_end; ++k)
+        {
+            IBTK::Vector3d lower, upper;
+            get_elem_bounding_box(bvh.sorted_elems[k], lower, upper);
+            node->lower = node->lower.cwiseMin(lower);
+            node->upper = node->upper.cwiseMax(upper);
+        }
+    }
+    return;
+} // updateElemBVH
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBAMR
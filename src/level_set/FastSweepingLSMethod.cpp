@@ -30,6 +30,7 @@
 #include "CellData.h"
 #include "CellVariable.h"
 #include "HierarchyCellDataOpsReal.h"
+#include "Index.h"
 #include "IntVector.h"
 #include "Patch.h"
 #include "PatchHierarchy.h"
@@ -41,8 +42,12 @@
 #include "tbox/Database.h"
 #include "tbox/PIO.h"
 #include "tbox/Pointer.h"
+#include "tbox/SAMRAI_MPI.h"
 #include "tbox/Utilities.h"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <ostream>
 #include <string>
 #include <utility>
@@ -89,6 +94,38 @@ namespace IBAMR
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Compute the first-order upwind solution of the Eikonal equation at a cell
+// with value U, given the neighboring value that is smaller in magnitude and
+// the grid spacing for each direction. This is the same local solver used by
+// the fast sweeping kernels.
+inline double
+eikonal_update(const double U, std::array<std::pair<double, double>, NDIM> a_h)
+{
+    if (U == 0.0) return U;
+    const double sgn = U > 0.0 ? 1.0 : -1.0;
+
+    // Work with the magnitudes and consider the neighbors in increasing order.
+    for (auto& a_h_pair : a_h) a_h_pair.first *= sgn;
+    std::sort(a_h.begin(), a_h.end());
+
+    double Dbar = a_h[0].first + a_h[0].second;
+    double Q = 0.0, R = 0.0, S = -1.0;
+    for (unsigned int k = 0; k < NDIM; ++k)
+    {
+        const double a = a_h[k].first;
+        const double h2 = a_h[k].second * a_h[k].second;
+        if (k > 0 && Dbar <= a) break;
+        Q += 1.0 / h2;
+        R -= 2.0 * a / h2;
+        S += a * a / h2;
+        Dbar = (-R + std::sqrt(std::max(R * R - 4.0 * Q * S, 0.0))) / (2.0 * Q);
+    }
+    return sgn * std::min(sgn * U, Dbar);
+} // eikonal_update
+} // namespace
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 FastSweepingLSMethod::FastSweepingLSMethod(std::string object_name, Pointer<Database> db, bool register_for_restart)
@@ -167,7 +204,40 @@ FastSweepingLSMethod::initializeLSData(int D_idx,
     int outer_iter = 0;
     const int cc_wgt_idx = hier_math_ops->getCellWeightPatchDescriptorIndex();
 
-    while (diff_L2_norm > d_abs_tol && outer_iter < d_max_its)
+    // With the fast iterative method, each pass continues until the values on
+    // every patch have converged, so that we only need to check whether any
+    // cell has changed since the last exchange of ghost cell values.
+    if (d_use_fast_iterative_method)
+    {
+        int n_global_updates = 1;
+        while (n_global_updates > 0 && outer_iter < d_max_its)
+        {
+            fill_op->fillData(time);
+
+            const int n_local_updates =
+                fastIterativeUpdate(hier_math_ops, D_scratch_idx, /*activate_all_cells*/ outer_iter == 0);
+            n_global_updates = SAMRAI_MPI::sumReduction(n_local_updates);
+
+            outer_iter += 1;
+
+            if (d_enable_logging)
+            {
+                plog << d_object_name << "::initializeLSData(): After iteration # " << outer_iter << std::endl;
+                plog << d_object_name << "::initializeLSData(): Number of updated cells = " << n_global_updates
+                     << std::endl;
+            }
+
+            if (n_global_updates == 0)
+            {
+                plog << d_object_name
+                     << "::initializeLSData(): Fast iterative algorithm "
+                        "converged for entire domain"
+                     << std::endl;
+            }
+        }
+    }
+
+    while (!d_use_fast_iterative_method && diff_L2_norm > d_abs_tol && outer_iter < d_max_its)
     {
         hier_cc_data_ops.copyData(D_iter_idx, D_scratch_idx);
         fill_op->fillData(time);
@@ -200,8 +270,11 @@ FastSweepingLSMethod::initializeLSData(int D_idx,
         if (d_enable_logging)
         {
             plog << d_object_name << "::initializeLSData(): Reached maximum allowable outer iterations" << std::endl;
-            plog << d_object_name << "::initializeLSData(): ||distance_new - distance_old||_2 = " << diff_L2_norm
-                 << std::endl;
+            if (!d_use_fast_iterative_method)
+            {
+                plog << d_object_name << "::initializeLSData(): ||distance_new - distance_old||_2 = "
+                     << diff_L2_norm << std::endl;
+            }
         }
     }
 
@@ -262,20 +335,7 @@ FastSweepingLSMethod::fastSweep(Pointer<CellData<NDIM, double> > dist_data,
     // Check if the patch touches physical domain.
     int touches_wall_loc_idx[NDIM * 2] = { 0 };
     Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
-    const bool patch_touches_bdry = pgeom->getTouchesRegularBoundary() || pgeom->getTouchesPeriodicBoundary();
-    if (patch_touches_bdry)
-    {
-        int loc_idx = 0;
-        for (unsigned int axis = 0; axis < NDIM; ++axis)
-        {
-            for (int upperlower = 0; upperlower < 2; ++upperlower, ++loc_idx)
-            {
-                touches_wall_loc_idx[loc_idx] = d_consider_phys_bdry_wall &&
-                                                pgeom->getTouchesRegularBoundary(axis, upperlower) &&
-                                                d_wall_location_idx[loc_idx];
-            }
-        }
-    }
+    const bool patch_touches_bdry = getWallLocations(patch, touches_wall_loc_idx);
 
 #if !defined(NDEBUG)
     TBOX_ASSERT(dist_data->getDepth() == 1);
@@ -316,6 +376,181 @@ FastSweepingLSMethod::fastSweep(Pointer<CellData<NDIM, double> > dist_data,
     return;
 } // fastSweep
 
+int
+FastSweepingLSMethod::fastIterativeUpdate(Pointer<HierarchyMathOps> hier_math_ops,
+                                          int dist_idx,
+                                          bool activate_all_cells) const
+{
+    Pointer<PatchHierarchy<NDIM> > hierarchy = hier_math_ops->getPatchHierarchy();
+    const int coarsest_ln = 0;
+    const int finest_ln = hierarchy->getFinestLevelNumber();
+
+    int n_updates = 0;
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        const BoxArray<NDIM>& domain_boxes = level->getPhysicalDomain();
+#if !defined(NDEBUG)
+        TBOX_ASSERT(domain_boxes.size() == 1);
+#endif
+
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > dist_data = patch->getPatchData(dist_idx);
+            n_updates += fastIterativeUpdate(dist_data, patch, domain_boxes[0], activate_all_cells);
+        }
+    }
+    return n_updates;
+} // fastIterativeUpdate
+
+int
+FastSweepingLSMethod::fastIterativeUpdate(Pointer<CellData<NDIM, double> > dist_data,
+                                          const Pointer<Patch<NDIM> > patch,
+                                          const Box<NDIM>& domain_box,
+                                          bool activate_all_cells) const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(dist_data->getDepth() == 1);
+    TBOX_ASSERT((dist_data->getGhostCellWidth()).min() >= 1);
+#endif
+    if (d_ls_order != FIRST_ORDER_LS)
+    {
+        TBOX_ERROR("FastSweepingLSMethod does not support " << enum_to_string(d_ls_order) << std::endl);
+    }
+
+    int touches_wall_loc_idx[NDIM * 2] = { 0 };
+    const bool patch_touches_bdry = getWallLocations(patch, touches_wall_loc_idx);
+    Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const dx = pgeom->getDx();
+
+    // Index the patch data directly, so that cells can be stored in the active
+    // list by their offsets.
+    double* const D = dist_data->getPointer(0);
+    const Box<NDIM>& patch_box = patch->getBox();
+    const Box<NDIM>& ghost_box = dist_data->getGhostBox();
+    int stride[NDIM];
+    stride[0] = 1;
+    for (unsigned int d = 1; d < NDIM; ++d) stride[d] = stride[d - 1] * ghost_box.numberCells(d - 1);
+    auto get_offset = [&ghost_box, &stride](const SAMRAI::hier::Index<NDIM>& i) {
+        int offset = 0;
+        for (unsigned int d = 0; d < NDIM; ++d) offset += (i(d) - ghost_box.lower(d)) * stride[d];
+        return offset;
+    };
+    auto get_index = [&ghost_box, &stride](int offset) {
+        SAMRAI::hier::Index<NDIM> i;
+        for (int d = NDIM - 1; d >= 0; --d)
+        {
+            i(d) = ghost_box.lower(d) + offset / stride[d];
+            offset %= stride[d];
+        }
+        return i;
+    };
+
+    // Compute the updated value at a cell, taking into account physical
+    // boundary walls as in the fast sweeping kernels.
+    auto solve = [&](const int offset) {
+        const SAMRAI::hier::Index<NDIM> i = get_index(offset);
+        std::array<std::pair<double, double>, NDIM> a_h;
+        const double U = D[offset];
+        const double sgn = U > 0.0 ? 1.0 : -1.0;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            a_h[d].first = sgn * std::min(sgn * D[offset - stride[d]], sgn * D[offset + stride[d]]);
+            a_h[d].second = dx[d];
+            if (patch_touches_bdry &&
+                ((i(d) == domain_box.lower(d) && touches_wall_loc_idx[2 * d]) ||
+                 (i(d) == domain_box.upper(d) && touches_wall_loc_idx[2 * d + 1])))
+            {
+                a_h[d].first = 0.0;
+                a_h[d].second *= 0.5;
+            }
+        }
+        const double U_new = eikonal_update(U, a_h);
+        return std::abs(U_new) <= d_narrow_band_width ? U_new : U;
+    };
+
+    // Initialize the active list with the cells whose values change.
+    const int num_ghost_cells = ghost_box.size();
+    std::vector<char> is_interior(num_ghost_cells, 0), is_active(num_ghost_cells, 0);
+    for (Box<NDIM>::Iterator b(patch_box); b; b++) is_interior[get_offset(b())] = 1;
+    Box<NDIM> inner_box = patch_box;
+    inner_box.grow(-1);
+
+    int n_updates = 0;
+    std::vector<int> active_cells, next_active_cells;
+    for (Box<NDIM>::Iterator b(patch_box); b; b++)
+    {
+        if (!activate_all_cells && inner_box.contains(b())) continue;
+        const int offset = get_offset(b());
+        const double U_new = solve(offset);
+        if (std::abs(U_new - D[offset]) > d_abs_tol)
+        {
+            D[offset] = U_new;
+            is_active[offset] = 1;
+            active_cells.push_back(offset);
+            ++n_updates;
+        }
+    }
+
+    // Update the active cells until they converge, and activate the neighbors
+    // of the converged cells whose values change.
+    while (!active_cells.empty())
+    {
+        next_active_cells.clear();
+        for (const int offset : active_cells)
+        {
+            const double U_old = D[offset];
+            D[offset] = solve(offset);
+            if (std::abs(D[offset] - U_old) > d_abs_tol)
+            {
+                next_active_cells.push_back(offset);
+                continue;
+            }
+
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                for (const int nbr_offset : { offset - stride[d], offset + stride[d] })
+                {
+                    if (!is_interior[nbr_offset] || is_active[nbr_offset]) continue;
+                    const double U_nbr_new = solve(nbr_offset);
+                    if (std::abs(U_nbr_new - D[nbr_offset]) > d_abs_tol)
+                    {
+                        D[nbr_offset] = U_nbr_new;
+                        is_active[nbr_offset] = 1;
+                        next_active_cells.push_back(nbr_offset);
+                        ++n_updates;
+                    }
+                }
+            }
+            is_active[offset] = 0;
+        }
+        active_cells.swap(next_active_cells);
+    }
+    return n_updates;
+} // fastIterativeUpdate
+
+bool
+FastSweepingLSMethod::getWallLocations(const Pointer<Patch<NDIM> > patch, int touches_wall_loc_idx[2 * NDIM]) const
+{
+    Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const bool patch_touches_bdry = pgeom->getTouchesRegularBoundary() || pgeom->getTouchesPeriodicBoundary();
+    if (patch_touches_bdry)
+    {
+        int loc_idx = 0;
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            for (int upperlower = 0; upperlower < 2; ++upperlower, ++loc_idx)
+            {
+                touches_wall_loc_idx[loc_idx] = d_consider_phys_bdry_wall &&
+                                                pgeom->getTouchesRegularBoundary(axis, upperlower) &&
+                                                d_wall_location_idx[loc_idx];
+            }
+        }
+    }
+    return patch_touches_bdry;
+} // getWallLocations
+
 void
 FastSweepingLSMethod::getFromInput(Pointer<Database> input_db)
 {
@@ -332,6 +567,10 @@ FastSweepingLSMethod::getFromInput(Pointer<Database> input_db)
 
     d_reinit_interval = input_db->getIntegerWithDefault("reinit_interval", d_reinit_interval);
 
+    d_use_fast_iterative_method =
+        input_db->getBoolWithDefault("use_fast_iterative_method", d_use_fast_iterative_method);
+    d_narrow_band_width = input_db->getDoubleWithDefault("narrow_band_width", d_narrow_band_width);
+
     d_consider_phys_bdry_wall = input_db->getBoolWithDefault("physical_bdry_wall", d_consider_phys_bdry_wall);
     Array<int> wall_loc_idices;
     if (input_db->keyExists("physical_bdry_wall_loc_idx"))
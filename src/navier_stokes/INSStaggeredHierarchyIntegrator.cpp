@@ -1118,7 +1118,11 @@ INSStaggeredHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<PatchHier
         {
             if (p_stokes_block_pc->needsVelocitySubdomainSolver())
             {
+                // The velocity subdomain solver is updated in
+                // reinitializeOperatorsAndSolvers() when the time step size
+                // changes.
                 p_stokes_block_pc->setVelocitySubdomainSolver(getVelocitySubdomainSolver());
+                p_stokes_block_pc->setVelocitySubdomainSolverUpdatedExternally(true);
             }
             if (p_stokes_block_pc->needsPressureSubdomainSolver())
             {
@@ -2543,9 +2547,10 @@ INSStaggeredHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double cu
     P_problem_coefs.setDConstant(rho == 0.0 ? -1.0 : -1.0 / rho);
 
     // Ensure that solver components are appropriately reinitialized when the
-    // time step size changes.
+    // time step size changes.  Solvers that are already initialized are first
+    // given the opportunity to update their state in place; see below.
     const bool dt_change = initial_time || !MathUtilities<double>::equalEps(dt, d_dt_previous[0]);
-    if (dt_change)
+    if (initial_time)
     {
         d_velocity_solver_needs_init = true;
         d_stokes_solver_needs_init = true;
@@ -2681,7 +2686,16 @@ INSStaggeredHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double cu
     // Setup subdomain solvers.
     if (d_velocity_solver)
     {
-        d_velocity_solver->setPoissonSpecifications(U_problem_coefs);
+        // The solver must see the old coefficients when they are updated, so
+        // that it can determine whether its state can be reused.
+        if (dt_change && !d_velocity_solver_needs_init)
+        {
+            d_velocity_solver_needs_init = !d_velocity_solver->updatePoissonSpecifications(U_problem_coefs);
+        }
+        else
+        {
+            d_velocity_solver->setPoissonSpecifications(U_problem_coefs);
+        }
         d_velocity_solver->setPhysicalBcCoefs(d_U_star_bc_coefs);
         d_velocity_solver->setSolutionTime(new_time);
         d_velocity_solver->setTimeInterval(current_time, new_time);
@@ -2728,7 +2742,14 @@ INSStaggeredHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double cu
     }
 
     // Setup Stokes solver.
-    d_stokes_solver->setVelocityPoissonSpecifications(U_problem_coefs);
+    if (dt_change && !d_stokes_solver_needs_init)
+    {
+        d_stokes_solver_needs_init = !d_stokes_solver->updateVelocityPoissonSpecifications(U_problem_coefs);
+    }
+    else
+    {
+        d_stokes_solver->setVelocityPoissonSpecifications(U_problem_coefs);
+    }
     d_stokes_solver->setPhysicalBcCoefs(d_U_bc_coefs, d_P_bc_coef);
     d_stokes_solver->setPhysicalBoundaryHelper(d_bc_helper);
     d_stokes_solver->setSolutionTime(new_time);
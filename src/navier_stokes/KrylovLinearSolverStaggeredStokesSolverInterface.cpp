@@ -59,6 +59,25 @@ KrylovLinearSolverStaggeredStokesSolverInterface::setVelocityPoissonSpecificatio
     return;
 } // setVelocityPoissonSpecifications
 
+bool
+KrylovLinearSolverStaggeredStokesSolverInterface::updateVelocityPoissonSpecifications(
+    const PoissonSpecifications& U_problem_coefs)
+{
+    auto p_this = dynamic_cast<KrylovLinearSolver*>(this);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(p_this);
+#endif
+    StaggeredStokesSolver::setVelocityPoissonSpecifications(U_problem_coefs);
+    Pointer<StaggeredStokesOperator> p_operator = p_this->getOperator();
+    if (p_operator) p_operator->setVelocityPoissonSpecifications(d_U_problem_coefs);
+    Pointer<StaggeredStokesSolver> p_preconditioner = p_this->getPreconditioner();
+    if (p_preconditioner)
+    {
+        return p_preconditioner->updateVelocityPoissonSpecifications(d_U_problem_coefs) || !d_is_initialized;
+    }
+    return true;
+} // updateVelocityPoissonSpecifications
+
 void
 KrylovLinearSolverStaggeredStokesSolverInterface::setComponentsHaveNullspace(const bool has_velocity_nullspace,
                                                                              const bool has_pressure_nullspace)
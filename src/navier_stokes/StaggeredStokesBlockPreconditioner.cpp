@@ -82,6 +82,13 @@ StaggeredStokesBlockPreconditioner::setVelocitySubdomainSolver(Pointer<PoissonSo
     return;
 } // setVelocitySubdomainSolver
 
+void
+StaggeredStokesBlockPreconditioner::setVelocitySubdomainSolverUpdatedExternally(const bool updated_externally)
+{
+    d_velocity_solver_updated_externally = updated_externally;
+    return;
+} // setVelocitySubdomainSolverUpdatedExternally
+
 void
 StaggeredStokesBlockPreconditioner::setVelocityPoissonSpecifications(const PoissonSpecifications& U_problem_coefs)
 {
@@ -90,6 +97,17 @@ StaggeredStokesBlockPreconditioner::setVelocityPoissonSpecifications(const Poiss
     return;
 } // setVelocityPoissonSpecifications
 
+bool
+StaggeredStokesBlockPreconditioner::updateVelocityPoissonSpecifications(const PoissonSpecifications& U_problem_coefs)
+{
+    StaggeredStokesSolver::setVelocityPoissonSpecifications(U_problem_coefs);
+    if (d_velocity_solver && !d_velocity_solver_updated_externally)
+    {
+        return d_velocity_solver->updatePoissonSpecifications(U_problem_coefs);
+    }
+    return true;
+} // updateVelocityPoissonSpecifications
+
 bool
 StaggeredStokesBlockPreconditioner::needsPressureSubdomainSolver() const
 {
@@ -18,7 +18,6 @@
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 
 #include "ibtk/CoarseFineBoundaryRefinePatchStrategy.h"
-#include "ibtk/IBTK_CHKERRQ.h"
 
 #include "ArrayData.h"
 #include "BasePatchLevel.h"
@@ -44,15 +43,9 @@
 #include "tbox/Pointer.h"
 #include "tbox/Utilities.h"
 
-#include "petscksp.h"
-#include "petscmat.h"
-#include "petscpc.h"
-#include "petscsys.h"
-#include "petscvec.h"
-
 #include <algorithm>
 #include <array>
-#include <limits>
+#include <cmath>
 #include <ostream>
 #include <string>
 #include <utility>
@@ -69,363 +62,253 @@ namespace
 // Number of ghosts cells used for each variable quantity.
 static const int GHOSTS = 1;
 
-inline int
-compute_side_index(const hier::Index<NDIM>& i, const Box<NDIM>& box, const unsigned int axis)
-{
-    const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(box, axis);
-    if (!side_box.contains(i)) return -1;
-    int offset = 0;
-    for (unsigned int d = 0; d < axis; ++d)
-    {
-        offset += SideGeometry<NDIM>::toSideBox(box, d).size();
-    }
-    return offset + side_box.offset(i);
-} // compute_side_index
+// Number of unknowns in a single-cell (Vanka) box: the 2*NDIM cell faces
+// followed by the cell-centered pressure.
+static const int BOX_SIZE = 2 * NDIM + 1;
+static const int P_DOF = 2 * NDIM;
+
+// Number of colors needed to decouple the box solves of a multiplicative
+// sweep.  Boxes whose indices differ by less than three in each direction may
+// share unknowns or stencil entries.
+static const int NUM_COLORS = NDIM == 2 ? 9 : 27;
+
+// Damping factor used when updating the error from the box solutions.
+static const double OMEGA = 0.65;
 
 inline int
-compute_cell_index(const hier::Index<NDIM>& i, const Box<NDIM>& box)
+face_dof(const unsigned int axis, const int side)
 {
-    if (!box.contains(i)) return -1;
-    int offset = 0;
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        offset += SideGeometry<NDIM>::toSideBox(box, axis).size();
-    }
-    return box.offset(i) + offset;
-} // compute_cell_index
-
+    return 2 * axis + side;
+} // face_dof
+
+/*!
+ * Compute the inverse of the local box operator, stored in row-major order.
+ *
+ * The box operator is the standard finite difference approximation to the
+ * time-dependent incompressible Stokes operator restricted to the unknowns of
+ * a single cell.  Because the problem coefficients are constant, all boxes on
+ * a level share the same inverse.
+ */
 void
-buildBoxOperator(Mat& A,
-                 const PoissonSpecifications& U_problem_coefs,
-                 const Box<NDIM>& box,
-                 const Box<NDIM>& ghost_box,
-                 const std::array<double, NDIM>& dx)
+build_box_inverse(std::vector<double>& A_inv, const PoissonSpecifications& U_problem_coefs, const double* const dx)
 {
-    int ierr;
-
     const double C = U_problem_coefs.getCConstant();
     const double D = U_problem_coefs.getDConstant();
 
-    // Allocate a PETSc matrix for the box operator.
-    std::array<Box<NDIM>, NDIM> side_boxes;
-    std::array<BoxList<NDIM>, NDIM> side_ghost_boxes;
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    std::vector<double> A(BOX_SIZE * BOX_SIZE, 0.0);
+    double diag = C;
+    for (unsigned int d = 0; d < NDIM; ++d)
     {
-        side_boxes[axis] = SideGeometry<NDIM>::toSideBox(box, axis);
-        side_ghost_boxes[axis] = SideGeometry<NDIM>::toSideBox(ghost_box, axis);
-        side_ghost_boxes[axis].removeIntersections(side_boxes[axis]);
+        diag -= 2.0 * D / (dx[d] * dx[d]);
     }
-    BoxList<NDIM> cell_ghost_boxes(ghost_box);
-    cell_ghost_boxes.removeIntersections(box);
-
-    int size = 0;
     for (unsigned int axis = 0; axis < NDIM; ++axis)
     {
-        size += SideGeometry<NDIM>::toSideBox(ghost_box, axis).size();
-    }
-    size += ghost_box.size();
-
-    static const int U_stencil_sz = 2 * NDIM + 3;
-    static const int P_stencil_sz = 2 * NDIM + 1;
-    std::vector<int> nnz(size, 0);
-
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        for (Box<NDIM>::Iterator b(side_boxes[axis]); b; b++)
+        for (int side = 0; side <= 1; ++side)
         {
-            nnz[compute_side_index(b(), ghost_box, axis)] = std::min(size, U_stencil_sz);
-        }
-        for (BoxList<NDIM>::Iterator bl(side_ghost_boxes[axis]); bl; bl++)
-        {
-            for (Box<NDIM>::Iterator b(bl()); b; b++)
-            {
-                nnz[compute_side_index(b(), ghost_box, axis)] = 1;
-            }
+            const int row = face_dof(axis, side);
+            const double grad = (side == 0 ? 1.0 : -1.0) / dx[axis];
+            A[row * BOX_SIZE + row] = diag;
+            A[row * BOX_SIZE + face_dof(axis, 1 - side)] = D / (dx[axis] * dx[axis]);
+            A[row * BOX_SIZE + P_DOF] = grad;
+            A[P_DOF * BOX_SIZE + row] = grad;
         }
     }
 
-    for (Box<NDIM>::Iterator b(box); b; b++)
-    {
-        nnz[compute_cell_index(b(), ghost_box)] = std::min(size, P_stencil_sz);
-    }
-    for (BoxList<NDIM>::Iterator bl(cell_ghost_boxes); bl; bl++)
+    // Invert the box operator by Gauss-Jordan elimination with partial
+    // pivoting.  Pivoting is required because the pressure block is zero.
+    A_inv.assign(BOX_SIZE * BOX_SIZE, 0.0);
+    for (int k = 0; k < BOX_SIZE; ++k) A_inv[k * BOX_SIZE + k] = 1.0;
+    for (int col = 0; col < BOX_SIZE; ++col)
     {
-        for (Box<NDIM>::Iterator b(bl()); b; b++)
+        int piv = col;
+        for (int row = col + 1; row < BOX_SIZE; ++row)
         {
-            nnz[compute_cell_index(b(), ghost_box)] = 1;
+            if (std::abs(A[row * BOX_SIZE + col]) > std::abs(A[piv * BOX_SIZE + col])) piv = row;
         }
-    }
-
-    ierr = MatCreateSeqAIJ(PETSC_COMM_SELF, size, size, 0, size ? &nnz[0] : nullptr, &A);
-    IBTK_CHKERRQ(ierr);
-
-// Set some general matrix options.
-#if !defined(NDEBUG)
-    ierr = MatSetOption(A, MAT_NEW_NONZERO_LOCATION_ERR, PETSC_TRUE);
-    IBTK_CHKERRQ(ierr);
-    ierr = MatSetOption(A, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_TRUE);
-    IBTK_CHKERRQ(ierr);
-#endif
-
-    // Set the matrix coefficients to correspond to the standard finite
-    // difference approximation to the time-dependent incompressible Stokes
-    // operator.
-    //
-    // Note that boundary conditions at both physical boundaries and at
-    // coarse-fine interfaces are implicitly treated by setting ghost cell
-    // values appropriately.  Thus the matrix coefficients are independent of
-    // any boundary conditions.
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        for (Box<NDIM>::Iterator b(side_boxes[axis]); b; b++)
+        if (A[piv * BOX_SIZE + col] == 0.0)
         {
-            hier::Index<NDIM> i = b();
-            const int mat_row = compute_side_index(i, ghost_box, axis);
-
-            std::vector<int> mat_cols(U_stencil_sz, -1);
-            std::vector<double> mat_vals(U_stencil_sz, 0.0);
-
-            mat_cols[0] = mat_row;
-            mat_vals[0] = C;
-
-            for (unsigned int d = 0; d < NDIM; ++d)
-            {
-                hier::Index<NDIM> shift = 0;
-                shift(d) = 1;
-                const hier::Index<NDIM> u_left = i - shift;
-                const hier::Index<NDIM> u_rght = i + shift;
-                mat_cols[2 * d + 1] = compute_side_index(u_left, ghost_box, axis);
-                mat_cols[2 * d + 2] = compute_side_index(u_rght, ghost_box, axis);
-
-                mat_vals[0] -= 2.0 * D / (dx[d] * dx[d]);
-                mat_vals[2 * d + 1] = D / (dx[d] * dx[d]);
-                mat_vals[2 * d + 2] = D / (dx[d] * dx[d]);
-            }
-
-            hier::Index<NDIM> shift = 0;
-            shift(axis) = 1;
-            const hier::Index<NDIM> p_left = i - shift;
-            const hier::Index<NDIM> p_rght = i;
-            mat_cols[2 * NDIM + 1] = compute_cell_index(p_left, ghost_box);
-            mat_cols[2 * NDIM + 2] = compute_cell_index(p_rght, ghost_box);
-
-            mat_vals[2 * NDIM + 1] = -1.0 / dx[axis];
-            mat_vals[2 * NDIM + 2] = 1.0 / dx[axis];
-
-            static const int m = 1;
-            static const int n = U_stencil_sz;
-            ierr = MatSetValues(A, m, &mat_row, n, &mat_cols[0], &mat_vals[0], INSERT_VALUES);
-            IBTK_CHKERRQ(ierr);
+            TBOX_ERROR("StaggeredStokesBoxRelaxationFACOperator::build_box_inverse():\n"
+                       << "  local box operator is singular" << std::endl);
         }
-    }
-
-    for (Box<NDIM>::Iterator b(box); b; b++)
-    {
-        hier::Index<NDIM> i = b();
-        const int mat_row = compute_cell_index(i, ghost_box);
-
-        std::vector<int> mat_cols(P_stencil_sz, -1);
-        std::vector<double> mat_vals(P_stencil_sz, 0.0);
-
-        mat_cols[0] = mat_row;
-        mat_vals[0] = 0.0;
-
-        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        if (piv != col)
         {
-            hier::Index<NDIM> shift = 0;
-            shift(axis) = 1;
-            const hier::Index<NDIM> u_left = i;
-            const hier::Index<NDIM> u_rght = i + shift;
-            mat_cols[2 * axis + 1] = compute_side_index(u_left, ghost_box, axis);
-            mat_cols[2 * axis + 2] = compute_side_index(u_rght, ghost_box, axis);
-
-            mat_vals[2 * axis + 1] = 1.0 / dx[axis];
-            mat_vals[2 * axis + 2] = -1.0 / dx[axis];
+            std::swap_ranges(&A[piv * BOX_SIZE], &A[piv * BOX_SIZE] + BOX_SIZE, &A[col * BOX_SIZE]);
+            std::swap_ranges(&A_inv[piv * BOX_SIZE], &A_inv[piv * BOX_SIZE] + BOX_SIZE, &A_inv[col * BOX_SIZE]);
         }
-
-        static const int m = 1;
-        static const int n = P_stencil_sz;
-        ierr = MatSetValues(A, m, &mat_row, n, &mat_cols[0], &mat_vals[0], INSERT_VALUES);
-        IBTK_CHKERRQ(ierr);
-    }
-
-    // Set the entries in the ghost cell region so that ghost cell values are
-    // not modified by the smoother.
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        for (BoxList<NDIM>::Iterator bl(side_ghost_boxes[axis]); bl; bl++)
+        const double scale = 1.0 / A[col * BOX_SIZE + col];
+        for (int k = 0; k < BOX_SIZE; ++k)
         {
-            for (Box<NDIM>::Iterator b(bl()); b; b++)
+            A[col * BOX_SIZE + k] *= scale;
+            A_inv[col * BOX_SIZE + k] *= scale;
+        }
+        for (int row = 0; row < BOX_SIZE; ++row)
+        {
+            const double fac = A[row * BOX_SIZE + col];
+            if (row == col || fac == 0.0) continue;
+            for (int k = 0; k < BOX_SIZE; ++k)
             {
-                const int i = compute_side_index(b(), ghost_box, axis);
-                ierr = MatSetValue(A, i, i, 1.0, INSERT_VALUES);
-                IBTK_CHKERRQ(ierr);
+                A[row * BOX_SIZE + k] -= fac * A[col * BOX_SIZE + k];
+                A_inv[row * BOX_SIZE + k] -= fac * A_inv[col * BOX_SIZE + k];
             }
         }
     }
+    return;
+} // build_box_inverse
 
-    for (BoxList<NDIM>::Iterator bl(cell_ghost_boxes); bl; bl++)
+/*!
+ * Collect the cells of the specified color, i.e., the cells whose offsets from
+ * the lower corner of the box are congruent modulo three to the digits of the
+ * color index.
+ */
+void
+get_color_cells(std::vector<hier::Index<NDIM> >& cells, const Box<NDIM>& box, const int color)
+{
+    hier::Index<NDIM> offset, num_cells;
+    int c = color, num_color_cells = 1;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        offset(d) = c % 3;
+        c /= 3;
+        num_cells(d) = std::max(0, (box.numberCells(d) - offset(d) + 2) / 3);
+        num_color_cells *= num_cells(d);
+    }
+    cells.resize(num_color_cells);
+    for (int k = 0; k < num_color_cells; ++k)
     {
-        for (Box<NDIM>::Iterator b(bl()); b; b++)
+        int r = k;
+        for (unsigned int d = 0; d < NDIM; ++d)
         {
-            const int i = compute_cell_index(b(), ghost_box);
-            ierr = MatSetValue(A, i, i, 1.0, INSERT_VALUES);
-            IBTK_CHKERRQ(ierr);
+            cells[k](d) = box.lower()(d) + offset(d) + 3 * (r % num_cells(d));
+            r /= num_cells(d);
         }
     }
-
-    // Assemble the matrices.
-    ierr = MatAssemblyBegin(A, MAT_FINAL_ASSEMBLY);
-    IBTK_CHKERRQ(ierr);
-    ierr = MatAssemblyEnd(A, MAT_FINAL_ASSEMBLY);
-    IBTK_CHKERRQ(ierr);
     return;
-} // buildBoxOperator
-
-void
-modifyRhsForBcs(Vec& v,
-                const SideData<NDIM, double>& U_data,
-                const CellData<NDIM, double>& P_data,
-                const PoissonSpecifications& U_problem_coefs,
-                const Box<NDIM>& box,
-                const Box<NDIM>& ghost_box,
+} // get_color_cells
+
+/*!
+ * Store the right-hand side and the current error values for box k.
+ *
+ * The right-hand side is the residual modified to account for the error
+ * values outside of the box.  Box data are stored component-wise, so that
+ * unknown m of box k is stored at index m * n_boxes + k.
+ */
+inline void
+gather_box_data(double* const rhs,
+                double* const e,
+                const int n_boxes,
+                const int k,
+                const hier::Index<NDIM>& i,
+                const SideData<NDIM, double>& U_error_data,
+                const CellData<NDIM, double>& P_error_data,
+                const SideData<NDIM, double>& U_residual_data,
+                const CellData<NDIM, double>& P_residual_data,
+                const double D,
                 const double* const dx)
 {
-    int ierr;
-
-    const double D = U_problem_coefs.getDConstant();
     for (unsigned int axis = 0; axis < NDIM; ++axis)
     {
-        const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(box, axis);
-        for (Box<NDIM>::Iterator b(side_box); b; b++)
+        for (int side = 0; side <= 1; ++side)
         {
-            hier::Index<NDIM> i = b();
-            const int idx = compute_side_index(i, ghost_box, axis);
-
+            hier::Index<NDIM> f = i;
+            f(axis) += side;
+            const SideIndex<NDIM> s_f(f, axis, SideIndex<NDIM>::Lower);
+            double r = U_residual_data(s_f);
             for (unsigned int d = 0; d < NDIM; ++d)
             {
                 hier::Index<NDIM> shift = 0;
                 shift(d) = 1;
-                const hier::Index<NDIM> u_left = i - shift;
-                const hier::Index<NDIM> u_rght = i + shift;
-                if (!side_box.contains(u_left))
+                const double fac = D / (dx[d] * dx[d]);
+                if (d != axis || side == 0)
                 {
-                    ierr = VecSetValue(v,
-                                       idx,
-                                       +D * U_data(SideIndex<NDIM>(u_left, axis, SideIndex<NDIM>::Lower)) /
-                                           (dx[d] * dx[d]),
-                                       ADD_VALUES);
-                    IBTK_CHKERRQ(ierr);
+                    r -= fac * U_error_data(SideIndex<NDIM>(f - shift, axis, SideIndex<NDIM>::Lower));
                 }
-                if (!side_box.contains(u_rght))
+                if (d != axis || side == 1)
                 {
-                    ierr = VecSetValue(v,
-                                       idx,
-                                       +D * U_data(SideIndex<NDIM>(u_rght, axis, SideIndex<NDIM>::Lower)) /
-                                           (dx[d] * dx[d]),
-                                       ADD_VALUES);
-                    IBTK_CHKERRQ(ierr);
+                    r -= fac * U_error_data(SideIndex<NDIM>(f + shift, axis, SideIndex<NDIM>::Lower));
                 }
             }
-
             hier::Index<NDIM> shift = 0;
             shift(axis) = 1;
-            const hier::Index<NDIM> p_left = i - shift;
-            const hier::Index<NDIM> p_rght = i;
-            if (!box.contains(p_left))
+            if (side == 0)
             {
-                ierr = VecSetValue(v, idx, +P_data(p_left) / dx[axis], ADD_VALUES);
-                IBTK_CHKERRQ(ierr);
+                r += P_error_data(i - shift) / dx[axis];
             }
-            if (!box.contains(p_rght))
+            else
             {
-                ierr = VecSetValue(v, idx, -P_data(p_rght) / dx[axis], ADD_VALUES);
-                IBTK_CHKERRQ(ierr);
+                r -= P_error_data(i + shift) / dx[axis];
             }
+            const int m = face_dof(axis, side);
+            rhs[m * n_boxes + k] = r;
+            e[m * n_boxes + k] = U_error_data(s_f);
         }
     }
-
-    ierr = VecAssemblyBegin(v);
-    IBTK_CHKERRQ(ierr);
-    ierr = VecAssemblyEnd(v);
-    IBTK_CHKERRQ(ierr);
+    rhs[P_DOF * n_boxes + k] = P_residual_data(i);
+    e[P_DOF * n_boxes + k] = P_error_data(i);
     return;
-} // modifyRhsForBcs
+} // gather_box_data
 
+/*!
+ * Apply the box inverse to a batch of boxes stored component-wise.  The inner
+ * loop runs over boxes with unit stride.
+ */
 inline void
-copyToVec(Vec& v,
-          const SideData<NDIM, double>& U_data,
-          const CellData<NDIM, double>& P_data,
-          const Box<NDIM>& box,
-          const Box<NDIM>& ghost_box)
+apply_box_inverse(double* const sol, const double* const rhs, const double* const A_inv, const int n_boxes)
 {
-    int ierr;
-
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    for (int row = 0; row < BOX_SIZE; ++row)
     {
-        const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(box, axis);
-        for (Box<NDIM>::Iterator b(side_box); b; b++)
+        double* const sol_row = sol + row * n_boxes;
+        std::fill(sol_row, sol_row + n_boxes, 0.0);
+        for (int col = 0; col < BOX_SIZE; ++col)
         {
-            const hier::Index<NDIM>& i = b();
-            const SideIndex<NDIM> s_i(i, axis, 0);
-            const int idx = compute_side_index(i, ghost_box, axis);
-            ierr = VecSetValue(v, idx, U_data(s_i), INSERT_VALUES);
-            IBTK_CHKERRQ(ierr);
+            const double a = A_inv[row * BOX_SIZE + col];
+            const double* const rhs_col = rhs + col * n_boxes;
+            for (int k = 0; k < n_boxes; ++k)
+            {
+                sol_row[k] += a * rhs_col[k];
+            }
         }
     }
-
-    for (Box<NDIM>::Iterator b(box); b; b++)
-    {
-        const hier::Index<NDIM>& i = b();
-        const int idx = compute_cell_index(i, ghost_box);
-        ierr = VecSetValue(v, idx, P_data(i), INSERT_VALUES);
-        IBTK_CHKERRQ(ierr);
-    }
-
-    ierr = VecAssemblyBegin(v);
-    IBTK_CHKERRQ(ierr);
-    ierr = VecAssemblyEnd(v);
-    IBTK_CHKERRQ(ierr);
     return;
-} // copyToVec
-
+} // apply_box_inverse
+
+/*!
+ * Update the error with the damped solution of box k.
+ *
+ * When average_shared_faces is true, the faces shared by two cells of the
+ * patch receive the average of the corrections of both boxes.
+ */
 inline void
-copyFromVec(Vec& v,
-            SideData<NDIM, double>& U_data,
-            CellData<NDIM, double>& P_data,
-            const Box<NDIM>& box,
-            const Box<NDIM>& ghost_box)
+scatter_box_data(SideData<NDIM, double>& U_error_data,
+                 CellData<NDIM, double>& P_error_data,
+                 const double* const sol,
+                 const double* const e,
+                 const int n_boxes,
+                 const int k,
+                 const hier::Index<NDIM>& i,
+                 const Box<NDIM>& patch_box,
+                 const bool average_shared_faces)
 {
-    int ierr;
-
-    const double omega = 0.65;
-
-    double U;
     for (unsigned int axis = 0; axis < NDIM; ++axis)
     {
-        const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(box, axis);
-        for (Box<NDIM>::Iterator b(side_box); b; b++)
+        for (int side = 0; side <= 1; ++side)
         {
-            const hier::Index<NDIM>& i = b();
-            const SideIndex<NDIM> s_i(i, axis, SideIndex<NDIM>::Lower);
-            const int idx = compute_side_index(i, ghost_box, axis);
-            ierr = VecGetValues(v, 1, &idx, &U);
-            IBTK_CHKERRQ(ierr);
-            U_data(s_i) = (1.0 - omega) * U_data(s_i) + omega * U;
+            hier::Index<NDIM> f = i;
+            f(axis) += side;
+            double omega = OMEGA;
+            if (average_shared_faces)
+            {
+                hier::Index<NDIM> nbr = i;
+                nbr(axis) += (side == 0 ? -1 : 1);
+                if (patch_box.contains(nbr)) omega *= 0.5;
+            }
+            const int m = face_dof(axis, side);
+            U_error_data(SideIndex<NDIM>(f, axis, SideIndex<NDIM>::Lower)) +=
+                omega * (sol[m * n_boxes + k] - e[m * n_boxes + k]);
         }
     }
-
-    double P;
-    for (Box<NDIM>::Iterator b(box); b; b++)
-    {
-        const hier::Index<NDIM>& i = b();
-        const int idx = compute_cell_index(i, ghost_box);
-        ierr = VecGetValues(v, 1, &idx, &P);
-        IBTK_CHKERRQ(ierr);
-        P_data(i) = (1.0 - omega) * P_data(i) + omega * P;
-    }
+    P_error_data(i) += OMEGA * (sol[P_DOF * n_boxes + k] - e[P_DOF * n_boxes + k]);
     return;
-} // copyFromVec
+} // scatter_box_data
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -436,7 +319,9 @@ StaggeredStokesBoxRelaxationFACOperator::StaggeredStokesBoxRelaxationFACOperator
     const std::string& default_options_prefix)
     : StaggeredStokesFACPreconditionerStrategy(object_name, GHOSTS, input_db, default_options_prefix)
 {
-    // intentionally blank
+    // Use multiplicative (colored Gauss-Seidel) sweeps unless additive sweeps
+    // are explicitly requested.
+    if (!input_db || !input_db->keyExists("smoother_type")) d_smoother_type = "MULTIPLICATIVE";
     return;
 } // StaggeredStokesBoxRelaxationFACOperator
 
@@ -446,6 +331,27 @@ StaggeredStokesBoxRelaxationFACOperator::~StaggeredStokesBoxRelaxationFACOperato
     return;
 } // ~StaggeredStokesBoxRelaxationFACOperator
 
+bool
+StaggeredStokesBoxRelaxationFACOperator::updateVelocityPoissonSpecifications(
+    const PoissonSpecifications& U_problem_coefs)
+{
+    const bool updated = StaggeredStokesFACPreconditionerStrategy::updateVelocityPoissonSpecifications(U_problem_coefs);
+    if (!d_is_initialized) return true;
+    Pointer<CartesianGridGeometry<NDIM> > geometry = d_hierarchy->getGridGeometry();
+    const double* const dx_coarsest = geometry->getDx();
+    std::array<double, NDIM> dx;
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        const IntVector<NDIM>& ratio = d_hierarchy->getPatchLevel(ln)->getRatio();
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            dx[d] = dx_coarsest[d] / static_cast<double>(ratio(d));
+        }
+        build_box_inverse(d_box_inv[ln], d_U_problem_coefs, dx.data());
+    }
+    return updated;
+} // updateVelocityPoissonSpecifications
+
 void
 StaggeredStokesBoxRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>& error,
                                                      const SAMRAIVectorReal<NDIM, double>& residual,
@@ -456,12 +362,15 @@ StaggeredStokesBoxRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, doub
 {
     if (num_sweeps == 0) return;
 
-    int ierr;
     Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_num);
     const int U_error_idx = error.getComponentDescriptorIndex(0);
     const int P_error_idx = error.getComponentDescriptorIndex(1);
     const int U_scratch_idx = d_side_scratch_idx;
     const int P_scratch_idx = d_cell_scratch_idx;
+    const bool additive_sweeps = d_smoother_type == "ADDITIVE";
+    const double D = d_U_problem_coefs.getDConstant();
+    std::vector<hier::Index<NDIM> > cells;
+    std::vector<double> box_rhs, box_e, box_sol;
 
     // Cache coarse-fine interface ghost cell values in the "scratch" data.
     if (level_num > d_coarsest_ln && num_sweeps > 1)
@@ -568,12 +477,13 @@ StaggeredStokesBoxRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, doub
             xeqScheduleGhostFillNoCoarse(error_idxs, level_num);
         }
 
-        // Smooth the error on the patches.
-        Vec& e = d_box_e[level_num];
-        Vec& r = d_box_r[level_num];
-        KSP& ksp = d_box_ksp[level_num];
-        int patch_counter = 0;
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+        // Smooth the error on the patches.  Additive sweeps compute all box
+        // corrections from the same error values, so that the result does
+        // not depend on the order in which the boxes are visited.
+        // Multiplicative sweeps process one color at a time; the boxes of a
+        // single color are decoupled and are solved as a single batch.
+        const std::vector<double>& A_inv = d_box_inv[level_num];
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             Pointer<SideData<NDIM, double> > U_error_data = error.getComponentPatchData(0, *patch);
@@ -596,16 +506,50 @@ StaggeredStokesBoxRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, doub
             const Box<NDIM>& patch_box = patch->getBox();
             const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
             const double* const dx = pgeom->getDx();
-            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+            const int num_colors = additive_sweeps ? 1 : NUM_COLORS;
+            for (int color = 0; color < num_colors; ++color)
             {
-                const hier::Index<NDIM>& i = b();
-                const Box<NDIM> box(i, i);
-                copyToVec(e, *U_error_data, *P_error_data, box, box);
-                copyToVec(r, *U_residual_data, *P_residual_data, box, box);
-                modifyRhsForBcs(r, *U_error_data, *P_error_data, d_U_problem_coefs, box, box, dx);
-                ierr = KSPSolve(ksp, r, e);
-                IBTK_CHKERRQ(ierr);
-                copyFromVec(e, *U_error_data, *P_error_data, box, box);
+                if (additive_sweeps)
+                {
+                    cells.clear();
+                    for (Box<NDIM>::Iterator b(patch_box); b; b++) cells.push_back(b());
+                }
+                else
+                {
+                    get_color_cells(cells, patch_box, color);
+                }
+                const int n_boxes = static_cast<int>(cells.size());
+                if (n_boxes == 0) continue;
+                box_rhs.resize(BOX_SIZE * n_boxes);
+                box_e.resize(BOX_SIZE * n_boxes);
+                box_sol.resize(BOX_SIZE * n_boxes);
+                for (int k = 0; k < n_boxes; ++k)
+                {
+                    gather_box_data(box_rhs.data(),
+                                    box_e.data(),
+                                    n_boxes,
+                                    k,
+                                    cells[k],
+                                    *U_error_data,
+                                    *P_error_data,
+                                    *U_residual_data,
+                                    *P_residual_data,
+                                    D,
+                                    dx);
+                }
+                apply_box_inverse(box_sol.data(), box_rhs.data(), A_inv.data(), n_boxes);
+                for (int k = 0; k < n_boxes; ++k)
+                {
+                    scatter_box_data(*U_error_data,
+                                     *P_error_data,
+                                     box_sol.data(),
+                                     box_e.data(),
+                                     n_boxes,
+                                     k,
+                                     cells[k],
+                                     patch_box,
+                                     additive_sweeps);
+                }
             }
         }
     }
@@ -625,12 +569,15 @@ StaggeredStokesBoxRelaxationFACOperator::initializeOperatorStateSpecialized(cons
                                                                             const int coarsest_reset_ln,
                                                                             const int finest_reset_ln)
 {
+    if (d_smoother_type != "ADDITIVE" && d_smoother_type != "MULTIPLICATIVE")
+    {
+        TBOX_ERROR(d_object_name << "::initializeOperatorStateSpecialized():\n"
+                                 << "  unsupported smoother type: " << d_smoother_type << "\n"
+                                 << "  valid choices are: ADDITIVE, MULTIPLICATIVE" << std::endl);
+    }
+
     // Initialize the box relaxation data on each level of the patch hierarchy.
-    d_box_op.resize(d_finest_ln + 1);
-    d_box_e.resize(d_finest_ln + 1);
-    d_box_r.resize(d_finest_ln + 1);
-    d_box_ksp.resize(d_finest_ln + 1);
-    const Box<NDIM> box(hier::Index<NDIM>(0), hier::Index<NDIM>(0));
+    d_box_inv.resize(d_finest_ln + 1);
     Pointer<CartesianGridGeometry<NDIM> > geometry = d_hierarchy->getGridGeometry();
     const double* const dx_coarsest = geometry->getDx();
     std::array<double, NDIM> dx;
@@ -641,27 +588,7 @@ StaggeredStokesBoxRelaxationFACOperator::initializeOperatorStateSpecialized(cons
         {
             dx[d] = dx_coarsest[d] / static_cast<double>(ratio(d));
         }
-        buildBoxOperator(d_box_op[ln], d_U_problem_coefs, box, box, dx);
-        int ierr;
-        ierr = MatCreateVecs(d_box_op[ln], &d_box_e[ln], &d_box_r[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPCreate(PETSC_COMM_SELF, &d_box_ksp[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPSetOperators(d_box_ksp[ln], d_box_op[ln], d_box_op[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPSetReusePreconditioner(d_box_ksp[ln], PETSC_TRUE);
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPSetType(d_box_ksp[ln], KSPPREONLY);
-        IBTK_CHKERRQ(ierr);
-        PC box_pc;
-        ierr = KSPGetPC(d_box_ksp[ln], &box_pc);
-        IBTK_CHKERRQ(ierr);
-        ierr = PCSetType(box_pc, PCLU);
-        IBTK_CHKERRQ(ierr);
-        ierr = PCFactorReorderForNonzeroDiagonal(box_pc, std::numeric_limits<double>::epsilon());
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPSetUp(d_box_ksp[ln]);
-        IBTK_CHKERRQ(ierr);
+        build_box_inverse(d_box_inv[ln], d_U_problem_coefs, dx.data());
     }
 
     // Get overlap information for setting patch boundary conditions.
@@ -715,15 +642,7 @@ StaggeredStokesBoxRelaxationFACOperator::deallocateOperatorStateSpecialized(cons
     if (!d_is_initialized) return;
     for (int ln = coarsest_reset_ln; ln <= std::min(d_finest_ln, finest_reset_ln); ++ln)
     {
-        int ierr;
-        ierr = MatDestroy(&d_box_op[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = VecDestroy(&d_box_e[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = VecDestroy(&d_box_r[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPDestroy(&d_box_ksp[ln]);
-        IBTK_CHKERRQ(ierr);
+        d_box_inv[ln].clear();
         d_patch_side_bc_box_overlap[ln].resize(0);
         d_patch_cell_bc_box_overlap[ln].resize(0);
     }
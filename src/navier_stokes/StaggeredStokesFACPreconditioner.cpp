@@ -58,6 +58,18 @@ StaggeredStokesFACPreconditioner::setVelocityPoissonSpecifications(const Poisson
     return;
 } // setVelocityPoissonSpecifications
 
+bool
+StaggeredStokesFACPreconditioner::updateVelocityPoissonSpecifications(const PoissonSpecifications& U_problem_coefs)
+{
+    StaggeredStokesSolver::setVelocityPoissonSpecifications(U_problem_coefs);
+    Pointer<StaggeredStokesFACPreconditionerStrategy> p_fac_strategy = d_fac_strategy;
+    if (p_fac_strategy)
+    {
+        return p_fac_strategy->updateVelocityPoissonSpecifications(U_problem_coefs) || !d_is_initialized;
+    }
+    return !d_is_initialized;
+} // updateVelocityPoissonSpecifications
+
 void
 StaggeredStokesFACPreconditioner::setComponentsHaveNullspace(const bool has_velocity_nullspace,
                                                              const bool has_pressure_nullspace)
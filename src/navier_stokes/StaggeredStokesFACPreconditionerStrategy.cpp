@@ -215,6 +215,16 @@ StaggeredStokesFACPreconditionerStrategy::setVelocityPoissonSpecifications(const
     return;
 } // setVelocityPoissonSpecifications
 
+bool
+StaggeredStokesFACPreconditionerStrategy::updateVelocityPoissonSpecifications(
+    const PoissonSpecifications& U_problem_coefs)
+{
+    setVelocityPoissonSpecifications(U_problem_coefs);
+    if (!d_is_initialized) return true;
+    if (d_coarse_solver) return d_coarse_solver->updateVelocityPoissonSpecifications(d_U_problem_coefs);
+    return true;
+} // updateVelocityPoissonSpecifications
+
 void
 StaggeredStokesFACPreconditionerStrategy::setComponentsHaveNullspace(const bool has_velocity_nullspace,
                                                                      const bool has_pressure_nullspace)
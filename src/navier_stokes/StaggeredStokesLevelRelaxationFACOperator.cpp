@@ -32,6 +32,7 @@
 #include "Patch.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
+#include "PoissonSpecifications.h"
 #include "ProcessorMapping.h"
 #include "SAMRAIVectorReal.h"
 #include "SideData.h"
@@ -105,6 +106,19 @@ StaggeredStokesLevelRelaxationFACOperator::~StaggeredStokesLevelRelaxationFACOpe
     return;
 } // ~StaggeredStokesLevelRelaxationFACOperator
 
+bool
+StaggeredStokesLevelRelaxationFACOperator::updateVelocityPoissonSpecifications(
+    const PoissonSpecifications& U_problem_coefs)
+{
+    bool updated = StaggeredStokesFACPreconditionerStrategy::updateVelocityPoissonSpecifications(U_problem_coefs);
+    if (!d_is_initialized) return true;
+    for (const auto& level_solver : d_level_solvers)
+    {
+        if (level_solver) updated = level_solver->updateVelocityPoissonSpecifications(d_U_problem_coefs) && updated;
+    }
+    return updated;
+} // updateVelocityPoissonSpecifications
+
 void
 StaggeredStokesLevelRelaxationFACOperator::setSmootherType(const std::string& level_solver_type)
 {
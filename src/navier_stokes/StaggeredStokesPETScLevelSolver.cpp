@@ -36,6 +36,7 @@
 #include "PatchGeometry.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
+#include "PoissonSpecifications.h"
 #include "RefineSchedule.h"
 #include "SAMRAIVectorReal.h"
 #include "SideData.h"
@@ -127,6 +128,31 @@ StaggeredStokesPETScLevelSolver::~StaggeredStokesPETScLevelSolver()
     return;
 } // ~StaggeredStokesPETScLevelSolver
 
+bool
+StaggeredStokesPETScLevelSolver::updateVelocityPoissonSpecifications(const PoissonSpecifications& U_problem_coefs)
+{
+    setVelocityPoissonSpecifications(U_problem_coefs);
+    if (!d_is_initialized) return true;
+
+    // The nonzero structure of the operator does not depend on the problem
+    // coefficients, so the new values can be copied into the existing matrix.
+    Mat petsc_mat = nullptr;
+    StaggeredStokesPETScMatUtilities::constructPatchLevelMACStokesOp(petsc_mat,
+                                                                     d_U_problem_coefs,
+                                                                     d_U_bc_coefs,
+                                                                     d_new_time,
+                                                                     d_num_dofs_per_proc,
+                                                                     d_u_dof_index_idx,
+                                                                     d_p_dof_index_idx,
+                                                                     d_level);
+    int ierr = MatCopy(petsc_mat, d_petsc_mat, SAME_NONZERO_PATTERN);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatDestroy(&petsc_mat);
+    IBTK_CHKERRQ(ierr);
+    resetKSPOperators();
+    return true;
+} // updateVelocityPoissonSpecifications
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 void
@@ -134,15 +134,8 @@ VCStaggeredStokesOperator::apply(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVector
     // Compute the action of the operator:
     //
     // A*[U;P] := [A_U;A_P] = [(C*I+D*L)*U + Grad P; -Div U]
-    d_hier_math_ops->grad(A_U_idx,
-                          A_U_sc_var,
-                          /*cf_bdry_synch*/ false,
-                          1.0,
-                          P_idx,
-                          P_cc_var,
-                          d_no_fill,
-                          d_new_time);
-    // A_U += (C*I*L(D))*U
+    //
+    // A_U := (C*I*L(D))*U
     double alpha = 1.0;
     double beta = 1.0;
     if (d_U_problem_coefs.cIsZero() || d_U_problem_coefs.cIsConstant())
@@ -165,18 +158,28 @@ VCStaggeredStokesOperator::apply(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVector
                                 d_new_time,
                                 d_D_interp_type,
                                 d_U_problem_coefs.cIsVariable() ? d_U_problem_coefs.getCPatchDataId() : -1,
-                                Pointer<SideVariable<NDIM, double> >(nullptr),
-                                1.0,
-                                A_U_idx,
-                                A_U_sc_var);
-    d_hier_math_ops->div(A_P_idx,
-                         A_P_cc_var,
-                         -1.0,
-                         U_scratch_idx,
-                         U_sc_var,
-                         d_no_fill,
-                         d_new_time,
-                         /*cf_bdry_synch*/ true);
+                                Pointer<SideVariable<NDIM, double> >(nullptr));
+
+    // A_U += Grad P and A_P := -Div U, computed together in a single sweep.
+    PoissonSpecifications grad_div_spec(d_object_name + "::grad_div_spec");
+    grad_div_spec.setCZero();
+    grad_div_spec.setDConstant(0.0);
+    d_hier_math_ops->stokes(A_U_idx,
+                            A_U_sc_var,
+                            /*dst_u_cf_bdry_synch*/ true,
+                            A_P_idx,
+                            A_P_cc_var,
+                            grad_div_spec,
+                            U_scratch_idx,
+                            U_sc_var,
+                            P_idx,
+                            P_cc_var,
+                            d_no_fill,
+                            d_new_time,
+                            /*src_u_cf_bdry_synch*/ true,
+                            1.0,
+                            A_U_idx,
+                            A_U_sc_var);
     d_bc_helper->copyDataAtDirichletBoundaries(A_U_idx, U_scratch_idx);
 
     IBAMR_TIMER_STOP(t_apply);
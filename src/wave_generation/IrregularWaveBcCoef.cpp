@@ -34,6 +34,7 @@
 #include <fstream>
 #include <limits>
 #include <utility>
+#include <vector>
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
@@ -146,6 +147,8 @@ IrregularWaveBcCoef::IrregularWaveBcCoef(std::string object_name,
         wave_stream.close();
     }
 
+    d_wave_components.setComponentWaves(d_depth, d_amplitude, d_wave_number, d_omega, d_phase);
+
     return;
 } // IrregularWaveBcCoef
 
@@ -269,62 +272,18 @@ IrregularWaveBcCoef::getFromInput(Pointer<Database> input_db)
 double
 IrregularWaveBcCoef::getSurfaceElevation(double x, double time) const
 {
-    double eta = 0;
-    for (int i = 0; i < d_num_waves; i++)
-    {
-        const double theta = d_wave_number[i] * x - d_omega[i] * time + d_phase[i];
-        eta += d_amplitude[i] * cos(theta);
-    }
-
-    return eta;
+    return d_wave_components.getSurfaceElevation(x, time);
 } // getSurfaceElevation
 
 double
 IrregularWaveBcCoef::getVelocity(double x, double z_plus_d, double time) const
 {
-    if (d_comp_idx == 0)
-    {
-        double velocity_component = 0.0;
-        for (int i = 0; i < d_num_waves; i++)
-        {
-            const double theta = d_wave_number[i] * x - d_omega[i] * time + d_phase[i];
-            velocity_component += d_amplitude[i] * d_omega[i] * cosh(d_wave_number[i] * z_plus_d) * cos(theta) /
-                                  sinh(d_wave_number[i] * d_depth);
-        }
-        return velocity_component;
-    }
-    if (d_comp_idx == 1)
-    {
-#if (NDIM == 2)
-        double velocity_component = 0.0;
-        for (int i = 0; i < d_num_waves; i++)
-        {
-            const double theta = d_wave_number[i] * x - d_omega[i] * time + d_phase[i];
-            velocity_component += d_amplitude[i] * d_omega[i] * sinh(d_wave_number[i] * z_plus_d) * sin(theta) /
-                                  sinh(d_wave_number[i] * d_depth);
-        }
-        return velocity_component;
-
-#elif (NDIM == 3)
-        return 0.0;
-#endif
-    }
 #if (NDIM == 3)
-    if (d_comp_idx == 2)
-    {
-        double velocity_component = 0.0;
-        for (int i = 0; i < d_num_waves; i++)
-        {
-            const double theta = d_wave_number[i] * x - d_omega[i] * time + d_phase[i];
-            velocity_component += d_amplitude[i] * d_omega[i] * sinh(d_wave_number[i] * z_plus_d) * sin(theta) /
-                                  sinh(d_wave_number[i] * d_depth);
-        }
-        return velocity_component;
-    }
+    if (d_comp_idx == 1) return 0.0;
 #endif
+    if (d_comp_idx != 0 && d_comp_idx != NDIM - 1) return std::numeric_limits<double>::signaling_NaN();
 
-    return std::numeric_limits<double>::signaling_NaN();
-    ;
+    return d_wave_components.getVelocity(x, z_plus_d, time, d_comp_idx == 0 ? 0 : 1);
 } // getVelocity
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
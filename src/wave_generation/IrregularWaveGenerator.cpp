@@ -23,6 +23,8 @@
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
+#include <vector>
 
 namespace IBAMR
 {
@@ -30,7 +32,7 @@ namespace IBAMR
 namespace
 {
 static const unsigned SEED = 1234567;
-}
+} // namespace
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 IrregularWaveGenerator::IrregularWaveGenerator(const std::string& object_name, Pointer<Database> input_db)
@@ -92,68 +94,26 @@ IrregularWaveGenerator::IrregularWaveGenerator(const std::string& object_name, P
         d_amplitude[i] = std::sqrt(2.0 * spectral_density * delta_omega);
     }
 
+    d_wave_components.setComponentWaves(d_depth, d_amplitude, d_wave_number, d_omega, d_phase);
+
     return;
 } // IrregularWaveGenerator
 
 double
 IrregularWaveGenerator::getSurfaceElevation(const double x, const double time) const
 {
-    double eta = 0;
-    for (int i = 0; i < d_num_waves; i++)
-    {
-        const double theta = d_wave_number[i] * x - d_omega[i] * time + d_phase[i];
-        eta += d_amplitude[i] * cos(theta);
-    }
-
-    return eta;
+    return d_wave_components.getSurfaceElevation(x, time);
 } // getSurfaceElevation
 
 double
 IrregularWaveGenerator::getVelocity(const double x, const double z_plus_d, const double time, const int comp_idx) const
 {
-    if (comp_idx == 0)
-    {
-        double velocity_component = 0.0;
-        for (int i = 0; i < d_num_waves; i++)
-        {
-            const double theta = d_wave_number[i] * x - d_omega[i] * time + d_phase[i];
-            velocity_component += d_amplitude[i] * d_omega[i] * cosh(d_wave_number[i] * z_plus_d) * cos(theta) /
-                                  sinh(d_wave_number[i] * d_depth);
-        }
-        return velocity_component;
-    }
-    if (comp_idx == 1)
-    {
-#if (NDIM == 2)
-        double velocity_component = 0.0;
-        for (int i = 0; i < d_num_waves; i++)
-        {
-            const double theta = d_wave_number[i] * x - d_omega[i] * time + d_phase[i];
-            velocity_component += d_amplitude[i] * d_omega[i] * sinh(d_wave_number[i] * z_plus_d) * sin(theta) /
-                                  sinh(d_wave_number[i] * d_depth);
-        }
-        return velocity_component;
-
-#elif (NDIM == 3)
-        return 0.0;
-#endif
-    }
 #if (NDIM == 3)
-    if (comp_idx == 2)
-    {
-        double velocity_component = 0.0;
-        for (int i = 0; i < d_num_waves; i++)
-        {
-            const double theta = d_wave_number[i] * x - d_omega[i] * time + d_phase[i];
-            velocity_component += d_amplitude[i] * d_omega[i] * sinh(d_wave_number[i] * z_plus_d) * sin(theta) /
-                                  sinh(d_wave_number[i] * d_depth);
-        }
-        return velocity_component;
-    }
+    if (comp_idx == 1) return 0.0;
 #endif
+    if (comp_idx != 0 && comp_idx != NDIM - 1) return std::numeric_limits<double>::signaling_NaN();
 
-    return std::numeric_limits<double>::signaling_NaN();
-
+    return d_wave_components.getVelocity(x, z_plus_d, time, comp_idx == 0 ? 0 : 1);
 } // getVelocity
 
 void
@@ -173,6 +133,7 @@ IrregularWaveGenerator::printWaveData(ofstream& ostream) const
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+
 void
 IrregularWaveGenerator::getFromInput(Pointer<Database> input_db)
 {
@@ -0,0 +1,181 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2019 - 2019 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibamr/WaveUtilities.h"
+
+#include "tbox/Utilities.h"
+
+#include <cmath>
+#include <list>
+#include <map>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBAMR
+{
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+void
+IrregularWaveComponents::setComponentWaves(const double depth,
+                                           const std::vector<double>& amplitude,
+                                           const std::vector<double>& wave_number,
+                                           const std::vector<double>& omega,
+                                           const std::vector<double>& phase)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(wave_number.size() == amplitude.size());
+    TBOX_ASSERT(omega.size() == amplitude.size());
+    TBOX_ASSERT(phase.size() == amplitude.size());
+#endif
+    d_depth = depth;
+    d_amplitude = amplitude;
+    d_wave_number = wave_number;
+    d_omega = omega;
+    d_phase = phase;
+    d_phase_factors.clear();
+    d_depth_profiles.clear();
+    return;
+} // setComponentWaves
+
+void
+IrregularWaveComponents::setCacheSizes(const std::size_t max_cached_times, const std::size_t max_cached_positions)
+{
+    d_max_cached_times = max_cached_times;
+    d_max_cached_positions = max_cached_positions;
+    d_phase_factors.clear();
+    d_depth_profiles.clear();
+    return;
+} // setCacheSizes
+
+double
+IrregularWaveComponents::getSurfaceElevation(const double x, const double time) const
+{
+    return getPhaseFactors(x, time).eta;
+} // getSurfaceElevation
+
+double
+IrregularWaveComponents::getVelocity(const double x, const double z_plus_d, const double time, const int comp_idx) const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(comp_idx == 0 || comp_idx == 1);
+#endif
+    // The velocity is the inner product of the depth profiles and the phase
+    // factors of the component waves.  The depth profiles are looked up second
+    // so that updating their cache cannot invalidate the phase factors.
+    const PhaseFactors& phase_factors = getPhaseFactors(x, time);
+    const DepthProfiles& depth_profiles = getDepthProfiles(z_plus_d);
+    if (comp_idx == 0)
+    {
+        return std::inner_product(depth_profiles.cosh_profile.begin(),
+                                  depth_profiles.cosh_profile.end(),
+                                  phase_factors.cos_theta.begin(),
+                                  0.0);
+    }
+    return std::inner_product(
+        depth_profiles.sinh_profile.begin(), depth_profiles.sinh_profile.end(), phase_factors.sin_theta.begin(), 0.0);
+} // getVelocity
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+const IrregularWaveComponents::PhaseFactors&
+IrregularWaveComponents::getPhaseFactors(const double x, const double time) const
+{
+    if (d_max_cached_times == 0 || d_max_cached_positions == 0)
+    {
+        computePhaseFactors(d_uncached_phase_factors, x, time);
+        return d_uncached_phase_factors;
+    }
+
+    // Move the factors for this time to the front of the list, or discard the
+    // factors for the least recently used time to make room for them.
+    auto time_it = d_phase_factors.begin();
+    while (time_it != d_phase_factors.end() && time_it->first != time) ++time_it;
+    if (time_it != d_phase_factors.end())
+    {
+        d_phase_factors.splice(d_phase_factors.begin(), d_phase_factors, time_it);
+    }
+    else
+    {
+        if (d_phase_factors.size() >= d_max_cached_times) d_phase_factors.pop_back();
+        d_phase_factors.emplace_front(time, std::map<double, PhaseFactors>());
+    }
+    std::map<double, PhaseFactors>& factors_at_time = d_phase_factors.front().second;
+    auto it = factors_at_time.find(x);
+    if (it != factors_at_time.end()) return it->second;
+
+    if (factors_at_time.size() >= d_max_cached_positions) factors_at_time.clear();
+    PhaseFactors& factors = factors_at_time[x];
+    computePhaseFactors(factors, x, time);
+    return factors;
+} // getPhaseFactors
+
+const IrregularWaveComponents::DepthProfiles&
+IrregularWaveComponents::getDepthProfiles(const double z_plus_d) const
+{
+    if (d_max_cached_times == 0 || d_max_cached_positions == 0)
+    {
+        computeDepthProfiles(d_uncached_depth_profiles, z_plus_d);
+        return d_uncached_depth_profiles;
+    }
+
+    auto it = d_depth_profiles.find(z_plus_d);
+    if (it != d_depth_profiles.end()) return it->second;
+
+    if (d_depth_profiles.size() >= d_max_cached_positions) d_depth_profiles.clear();
+    DepthProfiles& profiles = d_depth_profiles[z_plus_d];
+    computeDepthProfiles(profiles, z_plus_d);
+    return profiles;
+} // getDepthProfiles
+
+void
+IrregularWaveComponents::computePhaseFactors(PhaseFactors& factors, const double x, const double time) const
+{
+    const std::size_t num_waves = d_amplitude.size();
+    factors.cos_theta.resize(num_waves);
+    factors.sin_theta.resize(num_waves);
+    factors.eta = 0.0;
+    for (std::size_t i = 0; i < num_waves; ++i)
+    {
+        const double theta = d_wave_number[i] * x - d_omega[i] * time + d_phase[i];
+        factors.cos_theta[i] = std::cos(theta);
+        factors.sin_theta[i] = std::sin(theta);
+        factors.eta += d_amplitude[i] * factors.cos_theta[i];
+    }
+    return;
+} // computePhaseFactors
+
+void
+IrregularWaveComponents::computeDepthProfiles(DepthProfiles& profiles, const double z_plus_d) const
+{
+    const std::size_t num_waves = d_amplitude.size();
+    profiles.cosh_profile.resize(num_waves);
+    profiles.sinh_profile.resize(num_waves);
+    for (std::size_t i = 0; i < num_waves; ++i)
+    {
+        const double fac = d_amplitude[i] * d_omega[i] / std::sinh(d_wave_number[i] * d_depth);
+        profiles.cosh_profile[i] = fac * std::cosh(d_wave_number[i] * z_plus_d);
+        profiles.sinh_profile[i] = fac * std::sinh(d_wave_number[i] * z_plus_d);
+    }
+    return;
+} // computeDepthProfiles
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBAMR
+
+//////////////////////////////////////////////////////////////////////////////
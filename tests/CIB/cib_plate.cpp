@@ -47,6 +47,12 @@
 
 #include <boost/multi_array.hpp>
 
+#include <cmath>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
 //////////////////////////////////////////////////////////////////////////////
 
 // Center of mass velocity
@@ -69,6 +75,147 @@ NetExternalForceTorque(double /*data_time*/, Eigen::Vector3d& F_ext, Eigen::Vect
     return;
 } // NetExternalForceTorque
 
+// Count the solves that the CIB saddle-point solver reported in the log file
+// as having converged (first) or diverged (second).
+std::pair<int, int>
+count_saddle_point_solves(const std::string& log_file_name)
+{
+    std::pair<int, int> num_solves(0, 0);
+    std::ifstream log(log_file_name);
+    std::string line;
+    while (std::getline(log, line))
+    {
+        if (line.find("CIBStaggeredStokesSolver: converged:") == 0) ++num_solves.first;
+        if (line.find("CIBStaggeredStokesSolver: diverged:") == 0) ++num_solves.second;
+    }
+    return num_solves;
+} // count_saddle_point_solves
+
+// Check that the direct mobility solver applies the inverse of the
+// block-diagonal approximation of the mobility matrix of the plate. The
+// reference is a dense solve with the full mobility matrix in which the
+// entries that couple nodes in different blocks are set to zero. Since the
+// mobility matrix can be poorly conditioned, the two solutions are compared
+// through the residuals that they produce (relative to the norms of the matrix
+// and of the solution) rather than entrywise. Returns the number of blocks and
+// the relative difference (on rank 0).
+std::pair<int, double>
+check_block_mobility_inverse(Pointer<CIBMethod> ib_method_ops,
+                             DirectMobilitySolver* direct_solver,
+                             Pointer<PatchHierarchy<NDIM> > patch_hierarchy,
+                             const StokesSpecifications& stokes_spec,
+                             Pointer<Database> direct_solver_db,
+                             const MobilityMatrixType mat_type)
+{
+    const std::vector<unsigned> struct_ids(1, 0);
+    const int num_nodes = ib_method_ops->getNumberOfNodes(0);
+    const int size = num_nodes * NDIM;
+    const int rank = SAMRAI_MPI::getRank();
+    const int managing_proc = 0;
+
+    // Use the same parameters as DirectMobilitySolver.
+    const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+    const IntVector<NDIM>& ratio = patch_hierarchy->getPatchLevel(finest_ln)->getRatio();
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = patch_hierarchy->getGridGeometry();
+    double dx[NDIM], domain_extents[NDIM];
+    for (int d = 0; d < NDIM; ++d)
+    {
+        dx[d] = grid_geom->getDx()[d] / ratio(d);
+        domain_extents[d] = grid_geom->getXUpper()[d] - grid_geom->getXLower()[d];
+    }
+    const double f_periodic_corr = direct_solver_db->getDoubleWithDefault("f_periodic_correction", 0.0);
+    const auto max_block_nodes = static_cast<unsigned int>(direct_solver_db->getInteger("max_block_nodes"));
+    const std::pair<double, double> scale(1.0, 0.0);
+
+    // Assemble the dense mobility matrix and find the block of every node.
+    std::vector<double> mat_data;
+    Mat mat = nullptr;
+    if (rank == managing_proc)
+    {
+        mat_data.resize(size * size);
+        MatCreateSeqDense(PETSC_COMM_SELF, size, size, mat_data.data(), &mat);
+    }
+    ib_method_ops->constructMobilityMatrix("plate",
+                                           mat_type,
+                                           mat,
+                                           struct_ids,
+                                           dx,
+                                           domain_extents,
+                                           /*initial_time*/ true,
+                                           stokes_spec.getRho(),
+                                           stokes_spec.getMu(),
+                                           scale,
+                                           f_periodic_corr,
+                                           managing_proc);
+    std::vector<std::vector<int> > block_nodes;
+    std::vector<std::vector<double> > block_mats;
+    ib_method_ops->constructMobilityMatrixBlocks("plate",
+                                                 mat_type,
+                                                 block_nodes,
+                                                 block_mats,
+                                                 max_block_nodes,
+                                                 struct_ids,
+                                                 dx,
+                                                 domain_extents,
+                                                 /*initial_time*/ true,
+                                                 stokes_spec.getRho(),
+                                                 stokes_spec.getMu(),
+                                                 scale,
+                                                 f_periodic_corr,
+                                                 managing_proc);
+    std::vector<int> node_block(num_nodes, -1);
+    for (unsigned int k = 0; k < block_nodes.size(); ++k)
+    {
+        for (const int node : block_nodes[k]) node_block[node] = rank + SAMRAI_MPI::getNodes() * k;
+    }
+    SAMRAI_MPI::maxReduction(node_block.data(), num_nodes);
+    const int num_blocks = SAMRAI_MPI::sumReduction(static_cast<int>(block_nodes.size()));
+
+    // Solve with the direct solver. The mobility matrices are not recomputed,
+    // so initializing the solver again (if it has been deallocated since the
+    // last time step) reuses the factorized blocks.
+    LDataManager* l_data_manager = ib_method_ops->getLDataManager();
+    Pointer<LData> b_data = l_data_manager->createLData("block_mobility_b", finest_ln, NDIM);
+    Pointer<LData> x_data = l_data_manager->createLData("block_mobility_x", finest_ln, NDIM);
+    std::vector<double> b, x;
+    if (rank == managing_proc)
+    {
+        b.resize(size);
+        x.resize(size);
+        for (int i = 0; i < size; ++i) b[i] = std::sin(1.3 * i + 0.2);
+    }
+    ib_method_ops->copyArrayToVec(b_data->getVec(), b.data(), struct_ids, NDIM, managing_proc);
+    direct_solver->initializeSolverState(x_data->getVec(), b_data->getVec());
+    direct_solver->solveSystem(x_data->getVec(), b_data->getVec());
+    ib_method_ops->copyVecToArray(x_data->getVec(), x.data(), struct_ids, NDIM, managing_proc);
+
+    double rel_diff = 0.0;
+    if (rank == managing_proc)
+    {
+        // Drop the interactions between nodes in different blocks.
+        for (int i = 0; i < size; ++i)
+        {
+            for (int j = 0; j < size; ++j)
+            {
+                if (node_block[i / NDIM] != node_block[j / NDIM]) mat_data[i * size + j] = 0.0;
+            }
+        }
+        MatDestroy(&mat);
+
+        // The direct solver works in the reference frame of the body.
+        std::vector<double> y(b);
+        ib_method_ops->rotateArray(y.data(), struct_ids, /*use_transpose*/ true, managing_proc, NDIM);
+        ib_method_ops->rotateArray(x.data(), struct_ids, /*use_transpose*/ true, managing_proc, NDIM);
+        Eigen::Map<Eigen::MatrixXd> M(mat_data.data(), size, size);
+        const Eigen::VectorXd rhs = Eigen::Map<Eigen::VectorXd>(y.data(), size);
+        const Eigen::VectorXd y_dense = M.partialPivLu().solve(rhs);
+        const Eigen::VectorXd x_block = Eigen::Map<Eigen::VectorXd>(x.data(), size);
+        const double M_norm = M.cwiseAbs().rowwise().sum().maxCoeff();
+        rel_diff = (M * (x_block - y_dense)).lpNorm<Eigen::Infinity>() / (M_norm * y_dense.lpNorm<Eigen::Infinity>());
+    }
+    return std::make_pair(num_blocks, rel_diff);
+} // check_block_mobility_inverse
+
 void
 ConstrainedNodalVel(Vec /*U_k*/, const RigidDOFVector& /*U*/, const Eigen::Vector3d& /*X_com*/, void* /*ctx*/)
 {
@@ -134,6 +281,17 @@ main(int argc, char* argv[])
             PetscOptionsInsertFile(PETSC_COMM_WORLD, NULL, petsc_options_file.c_str(), PETSC_TRUE);
         }
 
+        // Optionally check that the outer saddle-point solver converges at
+        // every time step (as reported in the log file) instead of writing
+        // the net force and torque on the plate.
+        const bool check_solver_convergence = input_db->getBoolWithDefault("CHECK_SOLVER_CONVERGENCE", false);
+
+        // Optionally check the block-diagonal approximation of the mobility
+        // matrix used by the direct mobility solver after the first time step.
+        const bool check_block_mobility = input_db->getBoolWithDefault("CHECK_BLOCK_MOBILITY_INVERSE", false);
+        const std::string log_file_name = app_initializer->getComponentDatabase("Main")->getString("log_file_name");
+        int num_converged_solves = 0;
+
         // Get various standard options set in the input file.
         const bool dump_viz_data = app_initializer->dumpVizData();
         const int viz_dump_interval = app_initializer->getVizDumpInterval();
@@ -264,6 +422,8 @@ main(int argc, char* argv[])
 
         // Register mobility matrices (if needed)
         std::string mobility_solver_type = input_db->getString("MOBILITY_SOLVER_TYPE");
+        const MobilityMatrixType mobility_mat_type = EMPIRICAL;
+        DirectMobilitySolver* direct_solvers = NULL;
         if (mobility_solver_type == "DIRECT")
         {
             std::string mat_name = "plate";
@@ -277,11 +437,10 @@ main(int argc, char* argv[])
             struct_ids.push_back(prototype_structs);
 
             // Register the dense matrix with direct solver
-            DirectMobilitySolver* direct_solvers = NULL;
             CIBSolver->getSaddlePointSolver()->getCIBMobilitySolver()->getMobilitySolvers(NULL, &direct_solvers, NULL);
 
             direct_solvers->registerMobilityMat(
-                mat_name, prototype_structs, EMPIRICAL, std::make_pair(LAPACK_LU, LAPACK_LU), 0);
+                mat_name, prototype_structs, mobility_mat_type, std::make_pair(LAPACK_LU, LAPACK_LU), 0);
             direct_solvers->registerStructIDsWithMobilityMat(mat_name, struct_ids);
         }
         navier_stokes_integrator->setStokesSolverNeedsInit();
@@ -353,12 +512,42 @@ main(int argc, char* argv[])
             pout << "\n\nNet rigid force and torque on plate is : \n"
                  << ib_method_ops->getNetRigidGeneralizedForce(0) << "\n\n";
 
-            if (!SAMRAI_MPI::getRank())
+            if (check_solver_convergence)
+            {
+                plog << std::flush;
+                if (!SAMRAI_MPI::getRank())
+                {
+                    const std::pair<int, int> num_solves = count_saddle_point_solves(log_file_name);
+                    const bool converged = num_solves.first > num_converged_solves && num_solves.second == 0;
+                    output_file << "step " << iteration_num << ": CIB saddle-point solver "
+                                << (converged ? "converged" : "did not converge") << "\n";
+                    num_converged_solves = num_solves.first;
+                }
+            }
+            else if (!SAMRAI_MPI::getRank())
             {
                 output_file << std::setprecision(13) << "\n\nNet rigid force and torque on plate is : \n"
                             << ib_method_ops->getNetRigidGeneralizedForce(0) << "\n\n";
             }
 
+            if (check_block_mobility && iteration_num == 0)
+            {
+                const std::pair<int, double> block_check = check_block_mobility_inverse(
+                    ib_method_ops,
+                    direct_solvers,
+                    patch_hierarchy,
+                    *navier_stokes_integrator->getStokesSpecifications(),
+                    input_db->getDatabase("CIBStaggeredStokesSolver")->getDatabase("DirectMobilitySolver"),
+                    mobility_mat_type);
+                if (!SAMRAI_MPI::getRank())
+                {
+                    output_file << "number of mobility matrix blocks: " << block_check.first << "\n";
+                    output_file << "block mobility solve "
+                                << (block_check.second <= 1.0e-10 ? "agrees" : "does not agree")
+                                << " with the dense solve of the block-diagonal matrix\n";
+                }
+            }
+
             pout << "\n";
             pout << "At end       of timestep # " << iteration_num << "\n";
             pout << "Simulation time is " << loop_time << "\n";
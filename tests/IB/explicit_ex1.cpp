@@ -72,6 +72,12 @@ main(int argc, char* argv[])
         std::ifstream structure_spring_stream(SOURCE_DIR "/curve2d_64.spring");
         std::ofstream structure_spring_cwd("curve2d_64.spring");
         structure_spring_cwd << structure_spring_stream.rdbuf();
+        std::ifstream structure_vertex_bin_stream(SOURCE_DIR "/curve2d_64.vertex.bin", std::ios::binary);
+        std::ofstream structure_vertex_bin_cwd("curve2d_64.vertex.bin", std::ios::binary);
+        structure_vertex_bin_cwd << structure_vertex_bin_stream.rdbuf();
+        std::ifstream structure_spring_bin_stream(SOURCE_DIR "/curve2d_64.spring.bin", std::ios::binary);
+        std::ofstream structure_spring_bin_cwd("curve2d_64.spring.bin", std::ios::binary);
+        structure_spring_bin_cwd << structure_spring_bin_stream.rdbuf();
     }
 
     // Initialize PETSc, MPI, and SAMRAI.
@@ -0,0 +1,283 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CoarsenAlgorithm.h>
+#include <LoadBalancer.h>
+#include <RefineAlgorithm.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBMethod.h>
+#include <ibamr/IBRedundantInitializer.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <vector>
+
+// This test verifies that LDataManager::interp() gives the same values when it
+// only synchronizes the Eulerian data onto the levels that it needs as when
+// every level of the hierarchy is synchronized first. Lagrangian nodes are
+// assigned to the two finer levels of a three level hierarchy, and the
+// velocity field is set independently on each level, so that the values on
+// the coarsest level (which are used to fill the ghost cells of the middle
+// level at coarse-fine interfaces) change when the data are synchronized.
+
+namespace
+{
+int num_side_nodes;
+std::vector<IBTK::Point> lattice_centers;
+std::vector<double> lattice_spacings;
+
+void
+generate_structure(const unsigned int& /*strct_num*/,
+                   const int& ln,
+                   int& num_vertices,
+                   std::vector<IBTK::Point>& vertex_posn)
+{
+    // A lattice of nodes is placed on each level finer than level 0.
+    if (ln == 0)
+    {
+        num_vertices = 0;
+        vertex_posn.resize(num_vertices);
+        return;
+    }
+    num_vertices = num_side_nodes * num_side_nodes;
+    vertex_posn.resize(num_vertices);
+    for (int j = 0; j < num_side_nodes; ++j)
+    {
+        for (int i = 0; i < num_side_nodes; ++i)
+        {
+            IBTK::Point& X = vertex_posn[i + num_side_nodes * j];
+            X(0) = lattice_centers[ln](0) + (i - 0.5 * (num_side_nodes - 1)) * lattice_spacings[ln];
+            X(1) = lattice_centers[ln](1) + (j - 0.5 * (num_side_nodes - 1)) * lattice_spacings[ln];
+        }
+    }
+    return;
+} // generate_structure
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        // prevent a warning about timer initializations
+        TimerManager::createManager(nullptr);
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBMethod> ib_method_ops = new IBMethod("IBMethod", app_initializer->getComponentDatabase("IBMethod"));
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IB solver.
+        const int max_levels = input_db->getInteger("MAX_LEVELS");
+        const int ref_ratio = input_db->getInteger("REF_RATIO");
+        num_side_nodes = input_db->getInteger("NUM_SIDE_NODES");
+        lattice_centers.resize(max_levels);
+        lattice_spacings.resize(max_levels);
+        double dx = 1.0 / static_cast<double>(input_db->getInteger("N"));
+        for (int ln = 1; ln < max_levels; ++ln)
+        {
+            dx /= static_cast<double>(ref_ratio);
+            const std::string ln_str = std::to_string(ln);
+            lattice_centers[ln](0) = input_db->getDouble("LATTICE_CENTER_X_" + ln_str);
+            lattice_centers[ln](1) = input_db->getDouble("LATTICE_CENTER_Y_" + ln_str);
+            lattice_spacings[ln] = input_db->getDouble("LATTICE_SPACING") * dx;
+        }
+        Pointer<IBRedundantInitializer> ib_initializer = new IBRedundantInitializer(
+            "IBRedundantInitializer", app_initializer->getComponentDatabase("IBRedundantInitializer"));
+        for (int ln = 1; ln < max_levels; ++ln)
+        {
+            ib_initializer->setStructureNamesOnLevel(ln, std::vector<std::string>(1, "lattice_" + std::to_string(ln)));
+        }
+        ib_initializer->registerInitStructureFunction(generate_structure);
+        ib_method_ops->registerLInitStrategy(ib_initializer);
+
+        Pointer<CartGridFunction> u_init = new muParserCartGridFunction(
+            "u_init", app_initializer->getComponentDatabase("VelocityInitialConditions"), grid_geometry);
+        navier_stokes_integrator->registerVelocityInitialConditions(u_init);
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+        ib_method_ops->freeLInitStrategy();
+        ib_initializer.setNull();
+
+        // Create two copies of an Eulerian velocity field with the ghost cell
+        // width required for interpolation.
+        LDataManager* l_data_manager = ib_method_ops->getLDataManager();
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("interp_01");
+        Pointer<SideVariable<NDIM, double> > u_var = new SideVariable<NDIM, double>("u");
+        const int u_ref_idx = var_db->registerVariableAndContext(u_var, ctx, l_data_manager->getGhostCellWidth());
+        const int u_idx = var_db->registerClonedPatchDataIndex(u_var, u_ref_idx);
+        const int coarsest_ln = 0;
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(u_ref_idx, 0.0);
+            level->allocatePatchData(u_idx, 0.0);
+        }
+
+        // The velocity is set on all levels, so the values on coarse faces
+        // that are covered by finer levels are not averages of the overlying
+        // fine values until they are synchronized.
+        muParserCartGridFunction u_fcn("u", app_initializer->getComponentDatabase("u"), grid_geometry);
+        u_fcn.setDataOnPatchHierarchy(u_ref_idx, u_var, patch_hierarchy, 0.0);
+        u_fcn.setDataOnPatchHierarchy(u_idx, u_var, patch_hierarchy, 0.0);
+
+        // Build the synchronization and ghost filling schedules. Ghost cells
+        // at coarse-fine interfaces are filled by interpolating the values on
+        // the next coarser level.
+        Pointer<CoarsenOperator<NDIM> > coarsen_op =
+            grid_geometry->lookupCoarsenOperator(u_var, "CONSERVATIVE_COARSEN");
+        Pointer<RefineOperator<NDIM> > refine_op =
+            grid_geometry->lookupRefineOperator(u_var, "CONSERVATIVE_LINEAR_REFINE");
+        std::vector<std::vector<Pointer<CoarsenSchedule<NDIM> > > > synch_scheds(2);
+        std::vector<std::vector<Pointer<RefineSchedule<NDIM> > > > ghost_fill_scheds(2);
+        const std::vector<int> idxs = { u_ref_idx, u_idx };
+        for (unsigned int k = 0; k < idxs.size(); ++k)
+        {
+            CoarsenAlgorithm<NDIM> coarsen_alg;
+            coarsen_alg.registerCoarsen(idxs[k], idxs[k], coarsen_op);
+            RefineAlgorithm<NDIM> refine_alg;
+            refine_alg.registerRefine(idxs[k], idxs[k], idxs[k], refine_op);
+            synch_scheds[k].resize(finest_ln + 1);
+            ghost_fill_scheds[k].resize(finest_ln + 1);
+            for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+            {
+                Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+                if (ln > coarsest_ln)
+                {
+                    Pointer<PatchLevel<NDIM> > coarser_level = patch_hierarchy->getPatchLevel(ln - 1);
+                    synch_scheds[k][ln] = coarsen_alg.createSchedule(coarser_level, level);
+                }
+                ghost_fill_scheds[k][ln] = refine_alg.createSchedule(level, ln - 1, patch_hierarchy);
+            }
+        }
+
+        std::vector<Pointer<LData> > X_data(finest_ln + 1), U_ref_data(finest_ln + 1), U_data(finest_ln + 1);
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            if (!l_data_manager->levelContainsLagrangianData(ln)) continue;
+            X_data[ln] = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, ln);
+            U_ref_data[ln] = l_data_manager->createLData("U_ref", ln, NDIM);
+            U_data[ln] = l_data_manager->createLData("U", ln, NDIM);
+        }
+
+        // Interpolate the velocity after synchronizing every level of the
+        // hierarchy, as LDataManager::interp() used to do...
+        for (int ln = finest_ln; ln > coarsest_ln; --ln) synch_scheds[0][ln]->coarsenData();
+        l_data_manager->interp(u_ref_idx,
+                               U_ref_data,
+                               X_data,
+                               std::vector<Pointer<CoarsenSchedule<NDIM> > >(),
+                               ghost_fill_scheds[0],
+                               0.0);
+
+        // ...and let LDataManager::interp() synchronize the levels that it
+        // needs.
+        l_data_manager->interp(u_idx, U_data, X_data, synch_scheds[1], ghost_fill_scheds[1], 0.0);
+
+        std::ofstream out;
+        if (SAMRAI_MPI::getRank() == 0) out.open("output");
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            if (!l_data_manager->levelContainsLagrangianData(ln)) continue;
+            const boost::multi_array_ref<double, 2>& U_ref = *U_ref_data[ln]->getLocalFormVecArray();
+            const boost::multi_array_ref<double, 2>& U = *U_data[ln]->getLocalFormVecArray();
+            const auto num_local_nodes = static_cast<int>(U_data[ln]->getLocalNodeCount());
+            double max_diff = 0.0;
+            double max_value = 0.0;
+            for (int i = 0; i < num_local_nodes; ++i)
+            {
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    max_diff = std::max(max_diff, std::abs(U[i][d] - U_ref[i][d]));
+                    max_value = std::max(max_value, std::abs(U_ref[i][d]));
+                }
+            }
+            U_ref_data[ln]->restoreArrays();
+            U_data[ln]->restoreArrays();
+            max_diff = SAMRAI_MPI::maxReduction(max_diff);
+            max_value = SAMRAI_MPI::maxReduction(max_value);
+            if (SAMRAI_MPI::getRank() == 0)
+            {
+                out << "level " << ln << ": " << l_data_manager->getNumberOfNodes(ln) << " nodes, "
+                    << (max_value > 0.0 ? "nonzero" : "zero") << " velocity, "
+                    << (max_diff == 0.0 ? "values agree with those obtained by synchronizing every level" :
+                                          "values differ from those obtained by synchronizing every level")
+                    << "\n";
+            }
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
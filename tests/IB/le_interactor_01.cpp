@@ -0,0 +1,389 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <CellData.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+#include <tbox/MemoryDatabase.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBMethod.h>
+#include <ibamr/IBRedundantInitializer.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+#include <ibtk/LEInteractor.h>
+#include <ibtk/LNodeSetData.h>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <vector>
+
+// This test verifies that the optional LEInteractor code paths (threads, the
+// C++ kernel implementations, and interaction plans) spread and interpolate
+// the same values as the default serial Fortran implementation. The
+// Lagrangian nodes form a perturbed lattice that covers the whole periodic
+// domain, so that every patch contains nodes and many kernel footprints cross
+// patch boundaries. When interaction plans are enabled, we also check that
+// the plans are reused while the nodes stay put and rebuilt after they move.
+
+namespace
+{
+int num_side_nodes;
+
+void
+generate_structure(const unsigned int& /*strct_num*/,
+                   const int& /*ln*/,
+                   int& num_vertices,
+                   std::vector<IBTK::Point>& vertex_posn)
+{
+    num_vertices = 1;
+    for (unsigned int d = 0; d < NDIM; ++d) num_vertices *= num_side_nodes;
+    vertex_posn.resize(num_vertices);
+    for (int k = 0; k < num_vertices; ++k)
+    {
+        int idx = k;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const int i = idx % num_side_nodes;
+            idx /= num_side_nodes;
+            const double perturbation = 0.4 * std::sin(1.7 * k + 2.3 * d);
+            vertex_posn[k](d) = (i + 0.5 + perturbation) / static_cast<double>(num_side_nodes);
+        }
+    }
+    return;
+} // generate_structure
+
+// Interpolate u onto the nodes and spread F from the nodes on every patch of
+// the given level, in the same way as LDataManager::interp() and
+// LDataManager::spread().
+void
+apply_operators(Pointer<LData> U_data,
+                const int f_idx,
+                const int u_idx,
+                Pointer<LData> F_data,
+                Pointer<LData> X_data,
+                Pointer<PatchLevel<NDIM> > level,
+                Pointer<CartesianGridGeometry<NDIM> > grid_geom,
+                LDataManager* l_data_manager,
+                const std::string& kernel_fcn)
+{
+    const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift(level->getRatio());
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<LNodeSetData> idx_data = patch->getPatchData(l_data_manager->getLNodePatchDescriptorIndex());
+        Pointer<CellData<NDIM, double> > u_data = patch->getPatchData(u_idx);
+        Pointer<CellData<NDIM, double> > f_data = patch->getPatchData(f_idx);
+        f_data->fillAll(0.0);
+        LEInteractor::interpolate(
+            U_data, X_data, idx_data, u_data, patch, idx_data->getBox(), periodic_shift, kernel_fcn);
+        LEInteractor::spread(
+            f_data, F_data, X_data, idx_data, patch, idx_data->getGhostBox(), periodic_shift, kernel_fcn);
+    }
+    return;
+} // apply_operators
+
+// Compute the maximum difference between two sets of nodal values and the
+// maximum magnitude of the first set.
+void
+compare_nodal_values(Pointer<LData> V_ref_data, Pointer<LData> V_data, double& max_diff, double& max_value)
+{
+    const boost::multi_array_ref<double, 2>& V_ref = *V_ref_data->getLocalFormVecArray();
+    const boost::multi_array_ref<double, 2>& V = *V_data->getLocalFormVecArray();
+    const auto num_local_nodes = static_cast<int>(V_data->getLocalNodeCount());
+    max_diff = 0.0;
+    max_value = 0.0;
+    for (int i = 0; i < num_local_nodes; ++i)
+    {
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            max_diff = std::max(max_diff, std::abs(V[i][d] - V_ref[i][d]));
+            max_value = std::max(max_value, std::abs(V_ref[i][d]));
+        }
+    }
+    V_ref_data->restoreArrays();
+    V_data->restoreArrays();
+    max_diff = SAMRAI_MPI::maxReduction(max_diff);
+    max_value = SAMRAI_MPI::maxReduction(max_value);
+    return;
+} // compare_nodal_values
+
+// Compute the maximum difference between two cell-centered fields, including
+// their ghost cells, and the maximum magnitude of the first field.
+void
+compare_cell_values(const int v_ref_idx,
+                    const int v_idx,
+                    Pointer<PatchLevel<NDIM> > level,
+                    double& max_diff,
+                    double& max_value)
+{
+    max_diff = 0.0;
+    max_value = 0.0;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<CellData<NDIM, double> > v_ref_data = patch->getPatchData(v_ref_idx);
+        Pointer<CellData<NDIM, double> > v_data = patch->getPatchData(v_idx);
+        for (Box<NDIM>::Iterator b(v_data->getGhostBox()); b; b++)
+        {
+            const CellIndex<NDIM> i(b());
+            for (int d = 0; d < v_data->getDepth(); ++d)
+            {
+                max_diff = std::max(max_diff, std::abs((*v_data)(i, d) - (*v_ref_data)(i, d)));
+                max_value = std::max(max_value, std::abs((*v_ref_data)(i, d)));
+            }
+        }
+    }
+    max_diff = SAMRAI_MPI::maxReduction(max_diff);
+    max_value = SAMRAI_MPI::maxReduction(max_value);
+    return;
+} // compare_cell_values
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        // prevent a warning about timer initializations
+        TimerManager::createManager(nullptr);
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBMethod> ib_method_ops = new IBMethod("IBMethod", app_initializer->getComponentDatabase("IBMethod"));
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IB solver.
+        num_side_nodes = input_db->getInteger("NUM_SIDE_NODES");
+        Pointer<IBRedundantInitializer> ib_initializer = new IBRedundantInitializer(
+            "IBRedundantInitializer", app_initializer->getComponentDatabase("IBRedundantInitializer"));
+        ib_initializer->setStructureNamesOnLevel(0, std::vector<std::string>(1, "lattice"));
+        ib_initializer->registerInitStructureFunction(generate_structure);
+        ib_method_ops->registerLInitStrategy(ib_initializer);
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+        ib_method_ops->freeLInitStrategy();
+        ib_initializer.setNull();
+
+        // Create the Eulerian fields with the ghost cell width required by the
+        // kernel function. The interpolated field is set in the ghost cells
+        // directly since it is periodic.
+        LDataManager* l_data_manager = ib_method_ops->getLDataManager();
+        const std::string kernel_fcn = l_data_manager->getDefaultInterpKernelFunction();
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("le_interactor_01");
+        Pointer<CellVariable<NDIM, double> > u_var = new CellVariable<NDIM, double>("u", NDIM);
+        Pointer<CellVariable<NDIM, double> > f_var = new CellVariable<NDIM, double>("f", NDIM);
+        const int u_idx = var_db->registerVariableAndContext(u_var, ctx, l_data_manager->getGhostCellWidth());
+        const int f_ref_idx = var_db->registerVariableAndContext(f_var, ctx, l_data_manager->getGhostCellWidth());
+        const int f_idx = var_db->registerClonedPatchDataIndex(f_var, f_ref_idx);
+        const int ln = 0;
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+        level->allocatePatchData(u_idx, 0.0);
+        level->allocatePatchData(f_ref_idx, 0.0);
+        level->allocatePatchData(f_idx, 0.0);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const patch_x_lower = pgeom->getXLower();
+            const double* const patch_dx = pgeom->getDx();
+            Pointer<CellData<NDIM, double> > u_data = patch->getPatchData(u_idx);
+            for (Box<NDIM>::Iterator b(u_data->getGhostBox()); b; b++)
+            {
+                const CellIndex<NDIM> i(b());
+                IBTK::Vector X;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    X[d] = patch_x_lower[d] + patch_dx[d] * (static_cast<double>(i(d) - patch_box.lower(d)) + 0.5);
+                }
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    (*u_data)(i, d) = std::sin(2.0 * M_PI * (d + 1) * X[d]) * std::cos(2.0 * M_PI * X[(d + 1) % NDIM]);
+                }
+            }
+        }
+
+        // Set up the Lagrangian data. The spread values are a smooth function
+        // of the node positions.
+        Pointer<LData> X_data = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, ln);
+        Pointer<LData> F_data = l_data_manager->createLData("F", ln, NDIM);
+        Pointer<LData> U_ref_data = l_data_manager->createLData("U_ref", ln, NDIM);
+        Pointer<LData> U_data = l_data_manager->createLData("U", ln, NDIM);
+        {
+            const boost::multi_array_ref<double, 2>& X = *X_data->getLocalFormVecArray();
+            boost::multi_array_ref<double, 2>& F = *F_data->getLocalFormVecArray();
+            const auto num_local_nodes = static_cast<int>(F_data->getLocalNodeCount());
+            for (int i = 0; i < num_local_nodes; ++i)
+            {
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    F[i][d] = std::cos(2.0 * M_PI * X[i][(d + 1) % NDIM]) + 0.5 * d;
+                }
+            }
+            X_data->restoreArrays();
+            F_data->restoreArrays();
+        }
+        X_data->beginGhostUpdate();
+        X_data->endGhostUpdate();
+        F_data->beginGhostUpdate();
+        F_data->endGhostUpdate();
+
+        // Compute the reference values with the default settings...
+        Pointer<Database> reference_db = new MemoryDatabase("LEInteractor");
+        reference_db->putInteger("num_threads", 1);
+        reference_db->putString("kernel_implementation", "FORTRAN");
+        reference_db->putBool("use_interaction_plans", false);
+        LEInteractor::setFromDatabase(reference_db);
+        apply_operators(U_ref_data, f_ref_idx, u_idx, F_data, X_data, level, grid_geometry, l_data_manager, kernel_fcn);
+
+        // ...and with the settings under test.
+        Pointer<Database> test_db = app_initializer->getComponentDatabase("LEInteractor");
+        LEInteractor::setFromDatabase(test_db);
+        apply_operators(U_data, f_idx, u_idx, F_data, X_data, level, grid_geometry, l_data_manager, kernel_fcn);
+
+        const double tol = input_db->getDouble("TOLERANCE");
+        double U_max_diff, U_max_value, f_max_diff, f_max_value;
+        compare_nodal_values(U_ref_data, U_data, U_max_diff, U_max_value);
+        compare_cell_values(f_ref_idx, f_idx, level, f_max_diff, f_max_value);
+        std::ofstream out;
+        if (SAMRAI_MPI::getRank() == 0)
+        {
+            out.open("output");
+            out << "kernel function: " << kernel_fcn << "\n";
+            out << "number of patches: " << (level->getNumberOfPatches() > 1 ? "more than one" : "one") << "\n";
+            out << "interpolated values "
+                << (U_max_value > 0.0 && U_max_diff <= tol * U_max_value ? "agree" : "do not agree")
+                << " with the reference implementation\n";
+            out << "spread values "
+                << (f_max_value > 0.0 && f_max_diff <= tol * f_max_value ? "agree" : "do not agree")
+                << " with the reference implementation\n";
+        }
+
+        // When interaction plans are enabled, also check that applying the
+        // operators again with the same positions reuses the cached plans and
+        // that moving the nodes invalidates them.
+        if (test_db->getBoolWithDefault("use_interaction_plans", false))
+        {
+            const int num_initial_builds = SAMRAI_MPI::sumReduction(LEInteractor::getNumberOfInteractionPlanBuilds());
+            apply_operators(U_data, f_idx, u_idx, F_data, X_data, level, grid_geometry, l_data_manager, kernel_fcn);
+            const int num_reuse_builds = SAMRAI_MPI::sumReduction(LEInteractor::getNumberOfInteractionPlanBuilds());
+            compare_nodal_values(U_ref_data, U_data, U_max_diff, U_max_value);
+            compare_cell_values(f_ref_idx, f_idx, level, f_max_diff, f_max_value);
+            const bool reused_values_agree = U_max_diff <= tol * U_max_value && f_max_diff <= tol * f_max_value;
+
+            // Move every node by a fraction of a grid cell without
+            // redistributing the nodes, so that the cached plans are found
+            // but are no longer valid.
+            const double dx = 1.0 / static_cast<double>(input_db->getInteger("N"));
+            {
+                boost::multi_array_ref<double, 2>& X = *X_data->getLocalFormVecArray();
+                const auto num_local_nodes = static_cast<int>(X_data->getLocalNodeCount());
+                for (int i = 0; i < num_local_nodes; ++i)
+                {
+                    for (unsigned int d = 0; d < NDIM; ++d) X[i][d] += 0.1 * (d + 1) * dx;
+                }
+                X_data->restoreArrays();
+            }
+            X_data->beginGhostUpdate();
+            X_data->endGhostUpdate();
+            apply_operators(U_data, f_idx, u_idx, F_data, X_data, level, grid_geometry, l_data_manager, kernel_fcn);
+            const int num_moved_builds = SAMRAI_MPI::sumReduction(LEInteractor::getNumberOfInteractionPlanBuilds());
+
+            // Recompute the reference values at the new positions. This
+            // disables (and frees) the interaction plans, so it must come
+            // last.
+            LEInteractor::setFromDatabase(reference_db);
+            apply_operators(
+                U_ref_data, f_ref_idx, u_idx, F_data, X_data, level, grid_geometry, l_data_manager, kernel_fcn);
+            compare_nodal_values(U_ref_data, U_data, U_max_diff, U_max_value);
+            compare_cell_values(f_ref_idx, f_idx, level, f_max_diff, f_max_value);
+            if (SAMRAI_MPI::getRank() == 0)
+            {
+                out << "interaction plans " << (num_initial_builds > 0 ? "are" : "are not")
+                    << " built by the first application of the operators\n";
+                out << "interaction plans " << (num_reuse_builds == num_initial_builds ? "are" : "are not")
+                    << " reused when the nodes do not move\n";
+                out << "values computed with reused plans "
+                    << (reused_values_agree ? "agree" : "do not agree") << " with the reference implementation\n";
+                out << "interaction plans " << (num_moved_builds > num_reuse_builds ? "are" : "are not")
+                    << " rebuilt when the nodes move\n";
+                out << "after moving the nodes: interpolated values "
+                    << (U_max_value > 0.0 && U_max_diff <= tol * U_max_value ? "agree" : "do not agree")
+                    << " with the reference implementation\n";
+                out << "after moving the nodes: spread values "
+                    << (f_max_value > 0.0 && f_max_diff <= tol * f_max_value ? "agree" : "do not agree")
+                    << " with the reference implementation\n";
+            }
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
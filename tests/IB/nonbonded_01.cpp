@@ -0,0 +1,257 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+#include <petscvec.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBMethod.h>
+#include <ibamr/IBRedundantInitializer.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+#include <ibamr/NonbondedForceEvaluator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <vector>
+
+// This test verifies that the neighbor lists cached by
+// NonbondedForceEvaluator give the same forces as neighbor lists that are
+// rebuilt every time the forces are computed. The nodes of a lattice that
+// straddles a periodic boundary are moved by a shear displacement between
+// force evaluations, so that the cached list is reused at some steps and
+// rebuilt (because a node has moved more than half of the skin distance) at
+// others. The hierarchy is also regridded periodically, which redistributes
+// the Lagrangian data and invalidates the cached lists.
+
+namespace
+{
+int finest_ln;
+int num_side_nodes;
+double lattice_spacing;
+IBTK::Point lattice_center;
+
+void
+generate_structure(const unsigned int& /*strct_num*/,
+                   const int& ln,
+                   int& num_vertices,
+                   std::vector<IBTK::Point>& vertex_posn)
+{
+    if (ln != finest_ln)
+    {
+        num_vertices = 0;
+        vertex_posn.resize(num_vertices);
+        return;
+    }
+    num_vertices = num_side_nodes * num_side_nodes;
+    vertex_posn.resize(num_vertices);
+    for (int j = 0; j < num_side_nodes; ++j)
+    {
+        for (int i = 0; i < num_side_nodes; ++i)
+        {
+            IBTK::Point& X = vertex_posn[i + num_side_nodes * j];
+            X(0) = lattice_center(0) + (i - 0.5 * (num_side_nodes - 1)) * lattice_spacing;
+            X(1) = lattice_center(1) + (j - 0.5 * (num_side_nodes - 1)) * lattice_spacing;
+            // The domain is the periodic unit square.
+            for (unsigned int d = 0; d < NDIM; ++d) X(d) -= std::floor(X(d));
+        }
+    }
+    return;
+} // generate_structure
+
+// A force that does not vanish at the interaction radius, so that any pair
+// beyond the interaction radius that is passed to the force function changes
+// the result.
+void
+linear_force(double* D, const SAMRAI::tbox::Array<double> params, double* out_force)
+{
+    for (unsigned int d = 0; d < NDIM; ++d) out_force[d] = -params[0] * D[d];
+    return;
+} // linear_force
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        // prevent a warning about timer initializations
+        TimerManager::createManager(nullptr);
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBMethod> ib_method_ops = new IBMethod("IBMethod", app_initializer->getComponentDatabase("IBMethod"));
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IB solver.
+        const double dx = 1.0 / static_cast<double>(input_db->getInteger("N"));
+        finest_ln = input_db->getInteger("MAX_LEVELS") - 1;
+        num_side_nodes = input_db->getInteger("NUM_SIDE_NODES");
+        lattice_spacing = input_db->getDouble("LATTICE_SPACING") * dx;
+        lattice_center(0) = input_db->getDouble("LATTICE_CENTER_X");
+        lattice_center(1) = input_db->getDouble("LATTICE_CENTER_Y");
+        Pointer<IBRedundantInitializer> ib_initializer = new IBRedundantInitializer(
+            "IBRedundantInitializer", app_initializer->getComponentDatabase("IBRedundantInitializer"));
+        ib_initializer->setStructureNamesOnLevel(finest_ln, std::vector<std::string>(1, "lattice"));
+        ib_initializer->registerInitStructureFunction(generate_structure);
+        ib_method_ops->registerLInitStrategy(ib_initializer);
+
+        Pointer<CartGridFunction> u_init = new muParserCartGridFunction(
+            "u_init", app_initializer->getComponentDatabase("VelocityInitialConditions"), grid_geometry);
+        navier_stokes_integrator->registerVelocityInitialConditions(u_init);
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+        ib_method_ops->freeLInitStrategy();
+        ib_initializer.setNull();
+
+        // The first evaluator reuses its neighbor lists while the nodes remain
+        // within half of the skin distance of their positions at the time the
+        // list was built; the second one (with zero skin) rebuilds its lists
+        // every time the forces are computed.
+        Pointer<NonbondedForceEvaluator> cached_force_fcn = new NonbondedForceEvaluator(
+            app_initializer->getComponentDatabase("CachedNonbondedForceEvaluator"), grid_geometry);
+        Pointer<NonbondedForceEvaluator> uncached_force_fcn = new NonbondedForceEvaluator(
+            app_initializer->getComponentDatabase("UncachedNonbondedForceEvaluator"), grid_geometry);
+        cached_force_fcn->registerForceFcnPtr(linear_force);
+        uncached_force_fcn->registerForceFcnPtr(linear_force);
+
+        LDataManager* l_data_manager = ib_method_ops->getLDataManager();
+        const int num_steps = input_db->getInteger("NUM_STEPS");
+        const int regrid_interval = input_db->getInteger("REGRID_INTERVAL");
+        const double displacement = input_db->getDouble("DISPLACEMENT") * dx;
+        std::ofstream out;
+        if (SAMRAI_MPI::getRank() == 0) out.open("output");
+        for (int step = 0; step < num_steps; ++step)
+        {
+            if (step > 0 && step % regrid_interval == 0)
+            {
+                time_integrator->regridHierarchy();
+                // IBMethod does this for the force functions registered with
+                // it.
+                cached_force_fcn->initializeLevelData(patch_hierarchy, finest_ln, 0.0, false, l_data_manager);
+                uncached_force_fcn->initializeLevelData(patch_hierarchy, finest_ln, 0.0, false, l_data_manager);
+                if (SAMRAI_MPI::getRank() == 0) out << "step " << step << ": regridded the patch hierarchy\n";
+            }
+
+            // Shear the lattice.
+            Pointer<LData> X_data = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, finest_ln);
+            const int num_local_nodes = static_cast<int>(X_data->getLocalNodeCount());
+            if (step > 0)
+            {
+                boost::multi_array_ref<double, 2>& X = *X_data->getLocalFormVecArray();
+                for (int i = 0; i < num_local_nodes; ++i)
+                {
+                    const double x = X[i][0];
+                    const double y = X[i][1];
+                    X[i][0] += displacement * std::sin(2.0 * M_PI * y);
+                    X[i][1] += displacement * std::sin(2.0 * M_PI * x);
+                }
+                X_data->restoreArrays();
+            }
+
+            Pointer<LData> F_cached_data = l_data_manager->createLData("F_cached", finest_ln, NDIM);
+            Pointer<LData> F_uncached_data = l_data_manager->createLData("F_uncached", finest_ln, NDIM);
+            VecSet(F_cached_data->getVec(), 0.0);
+            VecSet(F_uncached_data->getVec(), 0.0);
+            cached_force_fcn->computeLagrangianForce(
+                F_cached_data, X_data, Pointer<LData>(), patch_hierarchy, finest_ln, 0.0, l_data_manager);
+            uncached_force_fcn->computeLagrangianForce(
+                F_uncached_data, X_data, Pointer<LData>(), patch_hierarchy, finest_ln, 0.0, l_data_manager);
+
+            // The pairs may be visited in a different order by the two
+            // evaluators, so the forces only agree up to round-off.
+            const boost::multi_array_ref<double, 2>& F_cached = *F_cached_data->getLocalFormVecArray();
+            const boost::multi_array_ref<double, 2>& F_uncached = *F_uncached_data->getLocalFormVecArray();
+            double max_diff = 0.0;
+            double max_force = 0.0;
+            for (int i = 0; i < num_local_nodes; ++i)
+            {
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    max_diff = std::max(max_diff, std::abs(F_cached[i][d] - F_uncached[i][d]));
+                    max_force = std::max(max_force, std::abs(F_uncached[i][d]));
+                }
+            }
+            F_cached_data->restoreArrays();
+            F_uncached_data->restoreArrays();
+            max_diff = SAMRAI_MPI::maxReduction(max_diff);
+            max_force = SAMRAI_MPI::maxReduction(max_force);
+            if (SAMRAI_MPI::getRank() == 0)
+            {
+                out << "step " << step << ": " << (max_force > 0.0 ? "nonzero" : "zero") << " forces, "
+                    << (max_diff <= 1.0e-12 * max_force ? "cached and uncached forces agree" :
+                                                          "cached and uncached forces differ")
+                    << "\n";
+            }
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
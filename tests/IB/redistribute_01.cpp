@@ -0,0 +1,240 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBMethod.h>
+#include <ibamr/IBRedundantInitializer.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+#include <ibtk/LMesh.h>
+#include <ibtk/LNode.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+#include <cmath>
+#include <fstream>
+#include <vector>
+
+// This test verifies that LDataManager redistributes the Lagrangian data
+// correctly. The nodes of a lattice are placed at cell centers and are moved
+// through a fraction of a cell at most steps, so that no node changes its
+// cell (and the data can be redistributed incrementally), and through the rest
+// of a cell at every third step, so that nodes move between patches and
+// processors (and the full redistribution algorithm is used). After each
+// redistribution, the values of the local and ghost nodes of both the position
+// data and a second LData object that stores the Lagrangian index of each node
+// are compared with the values that they should have. The same output is
+// expected whether or not incremental redistribution is enabled and whether
+// or not the local nodes are sorted.
+
+namespace
+{
+int finest_ln;
+int num_side_nodes;
+double dx;
+IBTK::Point lattice_corner;
+
+// The offset of the lattice from its initial position, in grid cells.
+double
+lattice_offset(const int step)
+{
+    return static_cast<double>(step / 3) + 0.2 * static_cast<double>(step % 3);
+} // lattice_offset
+
+IBTK::Point
+node_position(const int lag_idx, const int step)
+{
+    IBTK::Point X;
+    X(0) = lattice_corner(0) + (lag_idx % num_side_nodes + lattice_offset(step)) * dx;
+    X(1) = lattice_corner(1) + (lag_idx / num_side_nodes + lattice_offset(step)) * dx;
+    return X;
+} // node_position
+
+void
+generate_structure(const unsigned int& /*strct_num*/,
+                   const int& ln,
+                   int& num_vertices,
+                   std::vector<IBTK::Point>& vertex_posn)
+{
+    if (ln != finest_ln)
+    {
+        num_vertices = 0;
+        vertex_posn.resize(num_vertices);
+        return;
+    }
+    num_vertices = num_side_nodes * num_side_nodes;
+    vertex_posn.resize(num_vertices);
+    for (int k = 0; k < num_vertices; ++k) vertex_posn[k] = node_position(k, 0);
+    return;
+} // generate_structure
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        // prevent a warning about timer initializations
+        TimerManager::createManager(nullptr);
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBMethod> ib_method_ops = new IBMethod("IBMethod", app_initializer->getComponentDatabase("IBMethod"));
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IB solver. The lattice nodes are initially placed at
+        // the centers of the cells.
+        dx = 1.0 / static_cast<double>(input_db->getInteger("N"));
+        finest_ln = input_db->getInteger("MAX_LEVELS") - 1;
+        num_side_nodes = input_db->getInteger("NUM_SIDE_NODES");
+        lattice_corner(0) = (input_db->getInteger("LATTICE_CORNER_I") + 0.5) * dx;
+        lattice_corner(1) = (input_db->getInteger("LATTICE_CORNER_J") + 0.5) * dx;
+        Pointer<IBRedundantInitializer> ib_initializer = new IBRedundantInitializer(
+            "IBRedundantInitializer", app_initializer->getComponentDatabase("IBRedundantInitializer"));
+        ib_initializer->setStructureNamesOnLevel(finest_ln, std::vector<std::string>(1, "lattice"));
+        ib_initializer->registerInitStructureFunction(generate_structure);
+        ib_method_ops->registerLInitStrategy(ib_initializer);
+
+        Pointer<CartGridFunction> u_init = new muParserCartGridFunction(
+            "u_init", app_initializer->getComponentDatabase("VelocityInitialConditions"), grid_geometry);
+        navier_stokes_integrator->registerVelocityInitialConditions(u_init);
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+        ib_method_ops->freeLInitStrategy();
+        ib_initializer.setNull();
+
+        // Store the Lagrangian index of each node in an LData object that is
+        // redistributed along with the positions.
+        LDataManager* l_data_manager = ib_method_ops->getLDataManager();
+        Pointer<LData> idx_data = l_data_manager->createLData("lag_idx", finest_ln, 1, true);
+        {
+            boost::multi_array_ref<double, 1>& idx = *idx_data->getLocalFormArray();
+            for (const LNode* const node_idx : l_data_manager->getLMesh(finest_ln)->getLocalNodes())
+            {
+                idx[node_idx->getLocalPETScIndex()] = node_idx->getLagrangianIndex();
+            }
+            idx_data->restoreArrays();
+        }
+
+        const int num_steps = input_db->getInteger("NUM_STEPS");
+        std::ofstream out;
+        if (SAMRAI_MPI::getRank() == 0) out.open("output");
+        for (int step = 1; step <= num_steps; ++step)
+        {
+            // Move the local nodes and redistribute the data.
+            Pointer<LData> X_data = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, finest_ln);
+            {
+                boost::multi_array_ref<double, 2>& X = *X_data->getLocalFormVecArray();
+                for (const LNode* const node_idx : l_data_manager->getLMesh(finest_ln)->getLocalNodes())
+                {
+                    const IBTK::Point X_node = node_position(node_idx->getLagrangianIndex(), step);
+                    for (unsigned int d = 0; d < NDIM; ++d) X[node_idx->getLocalPETScIndex()][d] = X_node(d);
+                }
+                X_data->restoreArrays();
+            }
+            time_integrator->regridHierarchy();
+
+            // Check the values of the local and ghost nodes. The ghost values
+            // are filled by the redistribution.
+            X_data = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, finest_ln);
+            const boost::multi_array_ref<double, 2>& X = *X_data->getGhostedLocalFormVecArray();
+            const boost::multi_array_ref<double, 1>& idx = *idx_data->getGhostedLocalFormArray();
+            const Pointer<LMesh> mesh = l_data_manager->getLMesh(finest_ln);
+            int num_local_nodes = static_cast<int>(mesh->getLocalNodes().size());
+            int num_wrong_values = 0;
+            for (const std::vector<LNode*>& nodes : { mesh->getLocalNodes(), mesh->getGhostNodes() })
+            {
+                for (const LNode* const node_idx : nodes)
+                {
+                    const int lag_idx = node_idx->getLagrangianIndex();
+                    const int local_idx = node_idx->getLocalPETScIndex();
+                    if (idx[local_idx] != lag_idx) ++num_wrong_values;
+                    const IBTK::Point X_node = node_position(lag_idx, step);
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        if (std::abs(X[local_idx][d] - X_node(d)) > 1.0e-12) ++num_wrong_values;
+                    }
+                }
+            }
+            X_data->restoreArrays();
+            idx_data->restoreArrays();
+            num_local_nodes = SAMRAI_MPI::sumReduction(num_local_nodes);
+            num_wrong_values = SAMRAI_MPI::sumReduction(num_wrong_values);
+            if (SAMRAI_MPI::getRank() == 0)
+            {
+                out << "step " << step << ": " << num_local_nodes << " local nodes, "
+                    << (num_wrong_values == 0 ? "local and ghost values are correct" :
+                                                "local and ghost values are wrong")
+                    << "\n";
+            }
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
@@ -0,0 +1,217 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBMethod.h>
+#include <ibamr/IBRedundantInitializer.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IndexUtilities.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+#include <ibtk/LNodeSetData.h>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <vector>
+
+// This test verifies that IBMethod's sort_local_nodes option numbers the
+// local nodes on each patch along the Morton curve through the cells that
+// contain them, and that the indices cached by LIndexSetData follow the same
+// curve, both after the initial distribution of the nodes and after they
+// move and are redistributed.
+
+namespace
+{
+int num_side_nodes;
+
+void
+generate_structure(const unsigned int& /*strct_num*/,
+                   const int& /*ln*/,
+                   int& num_vertices,
+                   std::vector<IBTK::Point>& vertex_posn)
+{
+    num_vertices = num_side_nodes * num_side_nodes;
+    vertex_posn.resize(num_vertices);
+    for (int j = 0; j < num_side_nodes; ++j)
+    {
+        for (int i = 0; i < num_side_nodes; ++i)
+        {
+            const int k = i + num_side_nodes * j;
+            IBTK::Point& X = vertex_posn[k];
+            X(0) = 0.15 + 0.7 * (i + 0.5 + 0.4 * std::sin(1.7 * k)) / static_cast<double>(num_side_nodes);
+            X(1) = 0.15 + 0.7 * (j + 0.5 + 0.4 * std::sin(2.3 * k)) / static_cast<double>(num_side_nodes);
+        }
+    }
+    return;
+} // generate_structure
+
+// Count the patches on which the local nodes are not numbered consecutively
+// along the Morton curve or on which the cached indices do not follow it.
+int
+count_unsorted_patches(Pointer<PatchLevel<NDIM> > level, LDataManager* l_data_manager)
+{
+    int num_unsorted_patches = 0;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<LNodeSetData> idx_data = patch->getPatchData(l_data_manager->getLNodePatchDescriptorIndex());
+        const hier::Index<NDIM>& ghost_lower = idx_data->getGhostBox().lower();
+        std::map<int, std::uint64_t> morton_keys;
+        for (LNodeSetData::SetIterator it(*idx_data); it; it++)
+        {
+            const std::uint64_t key = IndexUtilities::getMortonKey(it.getIndex(), ghost_lower);
+            for (const auto& node_idx : *it) morton_keys[node_idx->getLocalPETScIndex()] = key;
+        }
+
+        bool sorted = true;
+        const std::vector<int>& local_idxs = idx_data->getLocalPETScIndices();
+        for (unsigned int k = 1; k < local_idxs.size(); ++k)
+        {
+            sorted = sorted && morton_keys[local_idxs[k - 1]] <= morton_keys[local_idxs[k]];
+        }
+        const std::vector<int>& interior_local_idxs = idx_data->getInteriorLocalPETScIndices();
+        for (unsigned int k = 1; k < interior_local_idxs.size(); ++k)
+        {
+            sorted = sorted && interior_local_idxs[k] == interior_local_idxs[k - 1] + 1;
+        }
+        if (!sorted) ++num_unsorted_patches;
+    }
+    return SAMRAI_MPI::sumReduction(num_unsorted_patches);
+} // count_unsorted_patches
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        // prevent a warning about timer initializations
+        TimerManager::createManager(nullptr);
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBMethod> ib_method_ops = new IBMethod("IBMethod", app_initializer->getComponentDatabase("IBMethod"));
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IB solver.
+        num_side_nodes = input_db->getInteger("NUM_SIDE_NODES");
+        Pointer<IBRedundantInitializer> ib_initializer = new IBRedundantInitializer(
+            "IBRedundantInitializer", app_initializer->getComponentDatabase("IBRedundantInitializer"));
+        ib_initializer->setStructureNamesOnLevel(0, std::vector<std::string>(1, "lattice"));
+        ib_initializer->registerInitStructureFunction(generate_structure);
+        ib_method_ops->registerLInitStrategy(ib_initializer);
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+        ib_method_ops->freeLInitStrategy();
+        ib_initializer.setNull();
+
+        LDataManager* l_data_manager = ib_method_ops->getLDataManager();
+        const int ln = 0;
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+        std::ofstream out;
+        if (SAMRAI_MPI::getRank() == 0) out.open("output");
+        if (SAMRAI_MPI::getRank() == 0)
+        {
+            out << "number of patches: " << (level->getNumberOfPatches() > 1 ? "more than one" : "one") << "\n";
+        }
+        int num_unsorted_patches = count_unsorted_patches(level, l_data_manager);
+        if (SAMRAI_MPI::getRank() == 0)
+        {
+            out << "after initialization: local nodes "
+                << (num_unsorted_patches == 0 ? "are" : "are not") << " sorted along the Morton curve\n";
+        }
+
+        // Move every node by a fraction of a grid cell, so that many of them
+        // change cells, and redistribute them.
+        const double dx = 1.0 / static_cast<double>(input_db->getInteger("N"));
+        Pointer<LData> X_data = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, ln);
+        {
+            boost::multi_array_ref<double, 2>& X = *X_data->getLocalFormVecArray();
+            const auto num_local_nodes = static_cast<int>(X_data->getLocalNodeCount());
+            for (int i = 0; i < num_local_nodes; ++i)
+            {
+                X[i][0] += 0.6 * dx;
+                X[i][1] -= 0.3 * dx;
+            }
+            X_data->restoreArrays();
+        }
+        time_integrator->regridHierarchy();
+        level = patch_hierarchy->getPatchLevel(ln);
+        num_unsorted_patches = count_unsorted_patches(level, l_data_manager);
+        if (SAMRAI_MPI::getRank() == 0)
+        {
+            out << "after redistribution: local nodes "
+                << (num_unsorted_patches == 0 ? "are" : "are not") << " sorted along the Morton curve\n";
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
@@ -0,0 +1,287 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBMethod.h>
+#include <ibamr/IBRedundantInitializer.h>
+#include <ibamr/IBSpringForceFunctions.h>
+#include <ibamr/IBStandardForceGen.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+#include <ibtk/LMesh.h>
+#include <ibtk/LNode.h>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <map>
+#include <vector>
+
+// This test verifies that IBStandardForceGen computes the same spring forces
+// as a direct, one spring at a time evaluation of the spring force functions
+// when the springs that use the default linear force function (which are
+// evaluated in batches) are interleaved with springs that use a user-defined
+// force function (which are evaluated through function pointers).
+
+namespace
+{
+int num_side_nodes;
+
+// Node positions on a perturbed lattice.
+IBTK::Point
+node_position(const int k)
+{
+    IBTK::Point X;
+    const int i = k % num_side_nodes;
+    const int j = k / num_side_nodes;
+    X(0) = 0.15 + 0.7 * (i + 0.5 + 0.3 * std::sin(1.7 * k)) / static_cast<double>(num_side_nodes);
+    X(1) = 0.15 + 0.7 * (j + 0.5 + 0.3 * std::sin(2.3 * k)) / static_cast<double>(num_side_nodes);
+    return X;
+} // node_position
+
+// Each node is connected to the next node in each direction and to the next
+// node along the diagonal. Every third spring uses the user-defined force
+// function, so that the two kinds of springs are interleaved.
+struct Spring
+{
+    IBRedundantInitializer::Edge e;
+    IBRedundantInitializer::SpringSpec spec;
+};
+
+std::vector<Spring>
+lattice_springs()
+{
+    std::vector<Spring> springs;
+    const double h = 0.7 / static_cast<double>(num_side_nodes);
+    for (int j = 0; j < num_side_nodes; ++j)
+    {
+        for (int i = 0; i < num_side_nodes; ++i)
+        {
+            const int k = i + num_side_nodes * j;
+            std::vector<int> neighbors;
+            if (i + 1 < num_side_nodes) neighbors.push_back(k + 1);
+            if (j + 1 < num_side_nodes) neighbors.push_back(k + num_side_nodes);
+            if (i + 1 < num_side_nodes && j + 1 < num_side_nodes) neighbors.push_back(k + num_side_nodes + 1);
+            for (const int l : neighbors)
+            {
+                Spring spring;
+                spring.e = std::make_pair(k, l);
+                spring.spec.parameters = { 1.0 + 0.1 * (springs.size() % 5), (l == k + 1 ? 0.8 : 1.2) * h };
+                if (springs.size() % 3 == 0)
+                {
+                    spring.spec.force_fcn_idx = 1;
+                    spring.spec.parameters.push_back(10.0);
+                }
+                springs.push_back(spring);
+            }
+        }
+    }
+    return springs;
+} // lattice_springs
+
+// A spring with an additional cubic term in the tension.
+double
+cubic_spring_force(const double R,
+                   const double* const params,
+                   const int /*lag_mastr_idx*/,
+                   const int /*lag_slave_idx*/)
+{
+    const double stretch = R - params[1];
+    return params[0] * stretch + params[2] * stretch * stretch * stretch;
+} // cubic_spring_force
+
+void
+generate_structure(const unsigned int& /*strct_num*/,
+                   const int& /*ln*/,
+                   int& num_vertices,
+                   std::vector<IBTK::Point>& vertex_posn)
+{
+    num_vertices = num_side_nodes * num_side_nodes;
+    vertex_posn.resize(num_vertices);
+    for (int k = 0; k < num_vertices; ++k) vertex_posn[k] = node_position(k);
+    return;
+} // generate_structure
+
+void
+generate_springs(
+    const unsigned int& /*strct_num*/,
+    const int& /*ln*/,
+    std::multimap<int, IBRedundantInitializer::Edge>& spring_map,
+    std::map<IBRedundantInitializer::Edge, IBRedundantInitializer::SpringSpec, IBRedundantInitializer::EdgeComp>&
+        spring_spec)
+{
+    for (const Spring& spring : lattice_springs())
+    {
+        spring_map.insert(std::make_pair(spring.e.first, spring.e));
+        spring_spec.insert(std::make_pair(spring.e, spring.spec));
+    }
+    return;
+} // generate_springs
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        // prevent a warning about timer initializations
+        TimerManager::createManager(nullptr);
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBMethod> ib_method_ops = new IBMethod("IBMethod", app_initializer->getComponentDatabase("IBMethod"));
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IB solver.
+        num_side_nodes = input_db->getInteger("NUM_SIDE_NODES");
+        Pointer<IBRedundantInitializer> ib_initializer = new IBRedundantInitializer(
+            "IBRedundantInitializer", app_initializer->getComponentDatabase("IBRedundantInitializer"));
+        ib_initializer->setStructureNamesOnLevel(0, std::vector<std::string>(1, "lattice"));
+        ib_initializer->registerInitStructureFunction(generate_structure);
+        ib_initializer->registerInitSpringDataFunction(generate_springs);
+        ib_method_ops->registerLInitStrategy(ib_initializer);
+        Pointer<IBStandardForceGen> ib_force_fcn = new IBStandardForceGen();
+        ib_force_fcn->registerSpringForceFunction(1, &cubic_spring_force);
+        ib_method_ops->registerIBLagrangianForceFunction(ib_force_fcn);
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+        ib_method_ops->freeLInitStrategy();
+        ib_initializer.setNull();
+
+        // Compute the spring forces with IBStandardForceGen.
+        LDataManager* l_data_manager = ib_method_ops->getLDataManager();
+        const int ln = 0;
+        ib_force_fcn->initializeLevelData(patch_hierarchy, ln, 0.0, true, l_data_manager);
+        Pointer<LData> X_data = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, ln);
+        Pointer<LData> U_data = l_data_manager->getLData(LDataManager::VEL_DATA_NAME, ln);
+        Pointer<LData> F_data = l_data_manager->createLData("F", ln, NDIM);
+        ib_force_fcn->computeLagrangianForce(F_data, X_data, U_data, patch_hierarchy, ln, 0.0, l_data_manager);
+
+        // Compute the reference forces one spring at a time. The nodes have
+        // not moved, so every process can compute the forces on all nodes.
+        const int num_nodes = num_side_nodes * num_side_nodes;
+        std::vector<IBTK::Vector> F_ref(num_nodes, IBTK::Vector::Zero());
+        const std::vector<Spring> springs = lattice_springs();
+        int num_custom_springs = 0;
+        for (const Spring& spring : springs)
+        {
+            const int mastr_idx = spring.e.first;
+            const int slave_idx = spring.e.second;
+            const IBTK::Vector D = node_position(slave_idx) - node_position(mastr_idx);
+            const double R = D.norm();
+            const double* const params = spring.spec.parameters.data();
+            double T;
+            if (spring.spec.force_fcn_idx == 1)
+            {
+                T = cubic_spring_force(R, params, mastr_idx, slave_idx);
+                ++num_custom_springs;
+            }
+            else
+            {
+                T = default_spring_force(R, params, mastr_idx, slave_idx);
+            }
+            F_ref[mastr_idx] += (T / R) * D;
+            F_ref[slave_idx] -= (T / R) * D;
+        }
+
+        double max_diff = 0.0;
+        double max_value = 0.0;
+        {
+            const boost::multi_array_ref<double, 2>& F = *F_data->getLocalFormVecArray();
+            for (const LNode* const node_idx : l_data_manager->getLMesh(ln)->getLocalNodes())
+            {
+                const int lag_idx = node_idx->getLagrangianIndex();
+                const int local_idx = node_idx->getLocalPETScIndex();
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    max_diff = std::max(max_diff, std::abs(F[local_idx][d] - F_ref[lag_idx][d]));
+                    max_value = std::max(max_value, std::abs(F_ref[lag_idx][d]));
+                }
+            }
+            F_data->restoreArrays();
+        }
+        max_diff = SAMRAI_MPI::maxReduction(max_diff);
+        max_value = SAMRAI_MPI::maxReduction(max_value);
+
+        if (SAMRAI_MPI::getRank() == 0)
+        {
+            std::ofstream out("output");
+            out << "number of springs with the default force function: "
+                << static_cast<int>(springs.size()) - num_custom_springs << "\n";
+            out << "number of springs with a user-defined force function: " << num_custom_springs << "\n";
+            out << "spring forces "
+                << (max_value > 0.0 && max_diff <= input_db->getDouble("TOLERANCE") * max_value ? "agree" :
+                                                                                                  "do not agree")
+                << " with the direct evaluation\n";
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
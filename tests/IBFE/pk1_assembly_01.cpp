@@ -0,0 +1,307 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for basic libMesh objects
+#include <libmesh/equation_systems.h>
+#include <libmesh/linear_partitioner.h>
+#include <libmesh/mesh.h>
+#include <libmesh/mesh_generation.h>
+#include <libmesh/petsc_vector.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBFEMethod.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/FEDataManager.h>
+#include <ibtk/libmesh_utilities.h>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+// This test verifies that assembling the right-hand side of the interior
+// elastic force density with several threads (the num_force_assembly_threads
+// input option of IBFEMethod) gives the same vector as assembling it with a
+// single thread, and that batched PK1 stress functions give the same vector as
+// the equivalent pointwise stress functions.
+
+namespace
+{
+// IBFEMethod does not expose the force assembly routine, so access it through
+// a derived class.
+class TestIBFEMethod : public IBFEMethod
+{
+public:
+    using IBFEMethod::IBFEMethod;
+
+    int getNumberOfForceAssemblyThreads() const
+    {
+        return d_num_force_assembly_threads;
+    }
+
+    void assembleForceDensityRHS(PetscVector<double>& G_rhs_vec,
+                                 PetscVector<double>& X_vec,
+                                 const int num_force_assembly_threads)
+    {
+        const int input_num_force_assembly_threads = d_num_force_assembly_threads;
+        d_num_force_assembly_threads = num_force_assembly_threads;
+        G_rhs_vec.zero();
+        assembleInteriorForceDensityRHS(G_rhs_vec, X_vec, nullptr, 0.0, 0);
+        int ierr = VecGhostUpdateBegin(G_rhs_vec.vec(), ADD_VALUES, SCATTER_REVERSE);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecGhostUpdateEnd(G_rhs_vec.vec(), ADD_VALUES, SCATTER_REVERSE);
+        IBTK_CHKERRQ(ierr);
+        d_num_force_assembly_threads = input_num_force_assembly_threads;
+        return;
+    }
+
+    // Replace the registered stress functions by batched ones, keeping the
+    // quadrature rules.
+    void replacePK1StressFunctions(const std::vector<PK1StressBatchFcnPtr>& batch_fcns)
+    {
+        TBOX_ASSERT(batch_fcns.size() == d_PK1_stress_fcn_data[0].size());
+        for (unsigned int k = 0; k < batch_fcns.size(); ++k)
+        {
+            d_PK1_stress_fcn_data[0][k].fcn = nullptr;
+            d_PK1_stress_fcn_data[0][k].batch_fcn = batch_fcns[k];
+        }
+        return;
+    }
+};
+
+// Coordinate mapping function. The structure is deformed nonuniformly so that
+// the stress varies from element to element.
+void
+coordinate_mapping_function(libMesh::Point& X, const libMesh::Point& s, void* /*ctx*/)
+{
+    X(0) = s(0) + 0.25 + 0.2 * s(1) * s(1);
+    X(1) = s(1) + 0.25 + 0.05 * std::sin(4.0 * s(0));
+#if (NDIM == 3)
+    X(2) = s(2) + 0.25 + 0.1 * s(0) * s(1);
+#endif
+    return;
+} // coordinate_mapping_function
+
+// Stress tensor functions of a compressible neo-Hookean material.
+double mu_s = 1.0;
+double lambda_s = 4.0;
+void
+PK1_dev_stress_function(TensorValue<double>& PP,
+                        const TensorValue<double>& FF,
+                        const libMesh::Point& /*X*/,
+                        const libMesh::Point& /*s*/,
+                        Elem* const /*elem*/,
+                        const vector<const vector<double>*>& /*var_data*/,
+                        const vector<const vector<VectorValue<double> >*>& /*grad_var_data*/,
+                        double /*time*/,
+                        void* /*ctx*/)
+{
+    PP = mu_s * (FF - tensor_inverse_transpose(FF, NDIM));
+    return;
+} // PK1_dev_stress_function
+
+void
+PK1_dil_stress_function(TensorValue<double>& PP,
+                        const TensorValue<double>& FF,
+                        const libMesh::Point& /*X*/,
+                        const libMesh::Point& /*s*/,
+                        Elem* const /*elem*/,
+                        const vector<const vector<double>*>& /*var_data*/,
+                        const vector<const vector<VectorValue<double> >*>& /*grad_var_data*/,
+                        double /*time*/,
+                        void* /*ctx*/)
+{
+    PP = lambda_s * std::log(FF.det()) * tensor_inverse_transpose(FF, NDIM);
+    return;
+} // PK1_dil_stress_function
+
+// Batched versions of the stress tensor functions.
+void
+PK1_dev_stress_batch_function(TensorValue<double>* PP,
+                              const TensorValue<double>* FF,
+                              const libMesh::Point* /*X*/,
+                              const libMesh::Point* /*s*/,
+                              const unsigned int n_points,
+                              Elem* const /*elem*/,
+                              const vector<vector<const vector<double>*> >& /*var_data*/,
+                              const vector<vector<const vector<VectorValue<double> >*> >& /*grad_var_data*/,
+                              double /*time*/,
+                              void* /*ctx*/)
+{
+    for (unsigned int qp = 0; qp < n_points; ++qp)
+    {
+        PP[qp] = mu_s * (FF[qp] - tensor_inverse_transpose(FF[qp], NDIM));
+    }
+    return;
+} // PK1_dev_stress_batch_function
+
+void
+PK1_dil_stress_batch_function(TensorValue<double>* PP,
+                              const TensorValue<double>* FF,
+                              const libMesh::Point* /*X*/,
+                              const libMesh::Point* /*s*/,
+                              const unsigned int n_points,
+                              Elem* const /*elem*/,
+                              const vector<vector<const vector<double>*> >& /*var_data*/,
+                              const vector<vector<const vector<VectorValue<double> >*> >& /*grad_var_data*/,
+                              double /*time*/,
+                              void* /*ctx*/)
+{
+    for (unsigned int qp = 0; qp < n_points; ++qp)
+    {
+        PP[qp] = lambda_s * std::log(FF[qp].det()) * tensor_inverse_transpose(FF[qp], NDIM);
+    }
+    return;
+} // PK1_dil_stress_batch_function
+} // namespace
+
+int
+main(int argc, char** argv)
+{
+    // Initialize libMesh, PETSc, MPI, and SAMRAI.
+    LibMeshInit init(argc, argv);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        // prevent a warning about timer initializations
+        TimerManager::createManager(nullptr);
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create a simple FE mesh. Use a simple partitioning scheme so that
+        // the partitioning does not depend on the libMesh version.
+        ReplicatedMesh mesh(init.comm(), NDIM);
+        const int num_elems = input_db->getInteger("NUM_ELEMS");
+        const ElemType elem_type = Utility::string_to_enum<ElemType>(input_db->getString("ELEM_TYPE"));
+#if (NDIM == 2)
+        MeshTools::Generation::build_square(mesh, num_elems, num_elems, 0.0, 0.5, 0.0, 0.5, elem_type);
+#endif
+#if (NDIM == 3)
+        MeshTools::Generation::build_cube(
+            mesh, num_elems, num_elems, num_elems, 0.0, 0.5, 0.0, 0.5, 0.0, 0.5, elem_type);
+#endif
+        mesh.prepare_for_use();
+        LinearPartitioner partitioner;
+        partitioner.partition(mesh);
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"),
+            false);
+        Pointer<TestIBFEMethod> ib_method_ops =
+            new TestIBFEMethod("IBFEMethod",
+                               app_initializer->getComponentDatabase("IBFEMethod"),
+                               &mesh,
+                               app_initializer->getComponentDatabase("GriddingAlgorithm")->getInteger("max_levels"),
+                               false);
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator,
+                                              false);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"), false);
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy =
+            new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry, false);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer,
+                                        false);
+
+        // Configure the IBFE solver.
+        ib_method_ops->registerInitialCoordinateMappingFunction(coordinate_mapping_function);
+        ib_method_ops->registerPK1StressFunction(IBFEMethod::PK1StressFcnData(PK1_dev_stress_function));
+        ib_method_ops->registerPK1StressFunction(IBFEMethod::PK1StressFcnData(PK1_dil_stress_function));
+        ib_method_ops->initializeFEEquationSystems();
+        ib_method_ops->initializeFEData();
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Assemble the force density right-hand side with the number of
+        // threads given in the input file and with a single thread.
+        FEDataManager* fe_data_manager = ib_method_ops->getFEDataManager();
+        std::unique_ptr<PetscVector<double> > X_vec =
+            fe_data_manager->buildIBGhostedVector(IBFEMethod::COORDS_SYSTEM_NAME);
+        copy_and_synch(*fe_data_manager->getSolutionVector(IBFEMethod::COORDS_SYSTEM_NAME), *X_vec);
+        std::unique_ptr<PetscVector<double> > G_threaded_vec =
+            fe_data_manager->buildIBGhostedVector(IBFEMethod::FORCE_SYSTEM_NAME);
+        std::unique_ptr<PetscVector<double> > G_serial_vec =
+            fe_data_manager->buildIBGhostedVector(IBFEMethod::FORCE_SYSTEM_NAME);
+        const int num_threads = ib_method_ops->getNumberOfForceAssemblyThreads();
+        ib_method_ops->assembleForceDensityRHS(*G_threaded_vec, *X_vec, num_threads);
+        ib_method_ops->assembleForceDensityRHS(*G_serial_vec, *X_vec, 1);
+
+        // Assemble it again with batched versions of the same stress
+        // functions.
+        std::unique_ptr<PetscVector<double> > G_batched_vec =
+            fe_data_manager->buildIBGhostedVector(IBFEMethod::FORCE_SYSTEM_NAME);
+        ib_method_ops->replacePK1StressFunctions({ PK1_dev_stress_batch_function, PK1_dil_stress_batch_function });
+        ib_method_ops->assembleForceDensityRHS(*G_batched_vec, *X_vec, 1);
+
+        // The threads sum their contributions in a fixed order that differs
+        // from the serial order, so only expect agreement up to roundoff.
+        const double tol = input_db->getDouble("TOLERANCE");
+        const double max_value = G_serial_vec->linfty_norm();
+        G_threaded_vec->add(-1.0, *G_serial_vec);
+        const double max_threaded_diff = G_threaded_vec->linfty_norm();
+        G_batched_vec->add(-1.0, *G_serial_vec);
+        const double max_batched_diff = G_batched_vec->linfty_norm();
+
+        plog << "number of force assembly threads: " << num_threads << "\n";
+        plog << "threaded assembly "
+             << (max_value > 0.0 && max_threaded_diff <= tol * max_value ? "agrees" : "does not agree")
+             << " with serial assembly\n";
+        plog << "batched stress functions "
+             << (max_value > 0.0 && max_batched_diff <= tol * max_value ? "agree" : "do not agree")
+             << " with pointwise stress functions\n";
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+} // main
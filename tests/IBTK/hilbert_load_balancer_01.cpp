@@ -0,0 +1,250 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CellData.h>
+#include <GriddingAlgorithm.h>
+#include <ProcessorMapping.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/HilbertLoadBalancer.h>
+#include <ibtk/MergingLoadBalancer.h>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+#include <algorithm>
+#include <fstream>
+#include <vector>
+
+// This test verifies that HilbertLoadBalancer partitions a patch level
+// according to a nonuniform workload. The workload is large in a ball in one
+// corner of the domain (as it would be near a Lagrangian structure), the
+// workload data are set on the existing coarsest level, and the coarsest level
+// is then load balanced both by HilbertLoadBalancer and by
+// MergingLoadBalancer. For the Hilbert partitioning we check that the boxes
+// cover the domain, that the processor assignments are contiguous along the
+// curve (i.e., nondecreasing in the box order), and that the workload of each
+// processor exceeds the average workload by at most the workload of a single
+// box. We also check that the Hilbert partitioning differs from the merging
+// partitioning. Both processor mappings are written to the log file.
+
+namespace
+{
+double peak_workload;
+double peak_radius;
+IntVector<NDIM> peak_center;
+
+double
+cell_workload(const hier::Index<NDIM>& i)
+{
+    double r_sq = 0.0;
+    for (unsigned int d = 0; d < NDIM; ++d) r_sq += (i(d) - peak_center(d)) * (i(d) - peak_center(d));
+    return r_sq < peak_radius * peak_radius ? peak_workload : 1.0;
+} // cell_workload
+
+double
+box_workload(const Box<NDIM>& box)
+{
+    double workload = 0.0;
+    for (Box<NDIM>::Iterator b(box); b; b++) workload += cell_workload(b());
+    return workload;
+} // box_workload
+
+// Returns the processor that owns each cell of the domain, or -1 if no box
+// (or more than one box) contains the cell.
+std::vector<int>
+cell_owners(const BoxArray<NDIM>& boxes, const ProcessorMapping& mapping, const Box<NDIM>& domain_box)
+{
+    std::vector<int> owners(domain_box.size(), -2);
+    for (int k = 0; k < boxes.size(); ++k)
+    {
+        for (Box<NDIM>::Iterator b(boxes[k]); b; b++)
+        {
+            int offset = 0, stride = 1;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                offset += (b()(d) - domain_box.lower(d)) * stride;
+                stride *= domain_box.numberCells(d);
+            }
+            owners[offset] = owners[offset] == -2 ? mapping.getProcessorAssignment(k) : -1;
+        }
+    }
+    std::replace(owners.begin(), owners.end(), -2, -1);
+    return owners;
+} // cell_owners
+
+void
+log_mapping(const std::string& name, const BoxArray<NDIM>& boxes, const ProcessorMapping& mapping)
+{
+    plog << name << " processor mapping:\n";
+    for (int k = 0; k < boxes.size(); ++k)
+    {
+        plog << "  box " << k << ": " << boxes[k] << " on processor " << mapping.getProcessorAssignment(k) << "\n";
+    }
+    return;
+} // log_mapping
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        // prevent a warning about timer initializations
+        TimerManager::createManager(nullptr);
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "load_balancer.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<HilbertLoadBalancer> hilbert_load_balancer =
+            new HilbertLoadBalancer("HilbertLoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<MergingLoadBalancer> merging_load_balancer =
+            new MergingLoadBalancer("MergingLoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        hilbert_load_balancer);
+
+        // Create the workload variable.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<CellVariable<NDIM, double> > workload_var = new CellVariable<NDIM, double>("workload");
+        const int workload_idx =
+            var_db->registerVariableAndContext(workload_var, var_db->getContext("context"), IntVector<NDIM>(0));
+
+        // Create the coarsest level and set the workload on it.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        peak_workload = input_db->getDouble("PEAK_WORKLOAD");
+        peak_radius = input_db->getDouble("PEAK_RADIUS");
+        for (unsigned int d = 0; d < NDIM; ++d) peak_center(d) = input_db->getInteger("PEAK_CENTER");
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+        level->allocatePatchData(workload_idx, 0.0);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > workload_data = patch->getPatchData(workload_idx);
+            for (Box<NDIM>::Iterator b(patch->getBox()); b; b++)
+            {
+                (*workload_data)(CellIndex<NDIM>(b())) = cell_workload(b());
+            }
+        }
+        hilbert_load_balancer->setWorkloadPatchDataIndex(workload_idx);
+        merging_load_balancer->setWorkloadPatchDataIndex(workload_idx);
+
+        // Load balance the coarsest level again with both load balancers.
+        const BoxArray<NDIM>& physical_domain = grid_geometry->getPhysicalDomain();
+        const BoxList<NDIM> in_boxes(physical_domain);
+        const Box<NDIM> domain_box = physical_domain.getBoundingBox();
+        const IntVector<NDIM> min_size(input_db->getInteger("SMALLEST_PATCH_SIZE"));
+        const IntVector<NDIM> max_size(input_db->getInteger("LARGEST_PATCH_SIZE"));
+        BoxArray<NDIM> hilbert_boxes, merging_boxes;
+        ProcessorMapping hilbert_mapping, merging_mapping;
+        hilbert_load_balancer->loadBalanceBoxes(hilbert_boxes,
+                                                hilbert_mapping,
+                                                in_boxes,
+                                                patch_hierarchy,
+                                                0,
+                                                physical_domain,
+                                                IntVector<NDIM>(1),
+                                                min_size,
+                                                max_size,
+                                                IntVector<NDIM>(1),
+                                                IntVector<NDIM>(1));
+        merging_load_balancer->loadBalanceBoxes(merging_boxes,
+                                                merging_mapping,
+                                                in_boxes,
+                                                patch_hierarchy,
+                                                0,
+                                                physical_domain,
+                                                IntVector<NDIM>(1),
+                                                min_size,
+                                                max_size,
+                                                IntVector<NDIM>(1),
+                                                IntVector<NDIM>(1));
+        log_mapping("HilbertLoadBalancer", hilbert_boxes, hilbert_mapping);
+        log_mapping("MergingLoadBalancer", merging_boxes, merging_mapping);
+
+        // Check the Hilbert partitioning. Every processor computes the same
+        // mapping, so no communication is needed.
+        const int n_nodes = SAMRAI_MPI::getNodes();
+        const std::vector<int> hilbert_owners = cell_owners(hilbert_boxes, hilbert_mapping, domain_box);
+        const std::vector<int> merging_owners = cell_owners(merging_boxes, merging_mapping, domain_box);
+        const bool boxes_cover_domain =
+            std::find(hilbert_owners.begin(), hilbert_owners.end(), -1) == hilbert_owners.end();
+        bool assignments_are_contiguous = true;
+        std::vector<double> rank_workloads(n_nodes, 0.0);
+        double max_box_workload = 0.0;
+        for (int k = 0; k < hilbert_boxes.size(); ++k)
+        {
+            const int rank = hilbert_mapping.getProcessorAssignment(k);
+            if (rank < 0 || rank >= n_nodes || (k > 0 && rank < hilbert_mapping.getProcessorAssignment(k - 1)))
+            {
+                assignments_are_contiguous = false;
+                continue;
+            }
+            const double workload = box_workload(hilbert_boxes[k]);
+            rank_workloads[rank] += workload;
+            max_box_workload = std::max(max_box_workload, workload);
+        }
+        const double total_workload = box_workload(domain_box);
+        const bool workloads_are_balanced =
+            *std::max_element(rank_workloads.begin(), rank_workloads.end()) <=
+            total_workload / static_cast<double>(n_nodes) + max_box_workload;
+        const bool partitions_differ = hilbert_owners != merging_owners;
+
+        if (SAMRAI_MPI::getRank() == 0)
+        {
+            std::ofstream out("output");
+            out << "HilbertLoadBalancer:\n";
+            out << "  boxes " << (boxes_cover_domain ? "cover" : "do not cover") << " the domain\n";
+            out << "  processor assignments " << (assignments_are_contiguous ? "are" : "are not")
+                << " contiguous along the curve\n";
+            out << "  processor workloads " << (workloads_are_balanced ? "are" : "are not")
+                << " balanced to within one box\n";
+            out << "  partitioning " << (partitions_differ ? "differs" : "does not differ")
+                << " from the MergingLoadBalancer partitioning\n";
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
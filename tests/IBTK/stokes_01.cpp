@@ -0,0 +1,210 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <HierarchyDataOpsManager.h>
+#include <LoadBalancer.h>
+#include <PoissonSpecifications.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/HierarchyGhostCellInterpolation.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+#include <fstream>
+#include <vector>
+
+// This test verifies that HierarchyMathOps::stokes() gives the same result as
+// the sequence of calls to grad(), laplace(), and div() that it replaces on a
+// hierarchy with several levels. Both versions synchronize the velocity at
+// coarse-fine interfaces, so each one is applied to its own copy of the
+// velocity field.
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        // prevent a warning about timer initializations
+        TimerManager::createManager(nullptr);
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "stokes.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+
+        Pointer<SideVariable<NDIM, double> > u_var = new SideVariable<NDIM, double>("u");
+        Pointer<SideVariable<NDIM, double> > a_u_var = new SideVariable<NDIM, double>("a_u");
+        Pointer<CellVariable<NDIM, double> > p_var = new CellVariable<NDIM, double>("p");
+        Pointer<CellVariable<NDIM, double> > a_p_var = new CellVariable<NDIM, double>("a_p");
+
+        const int u_ref_idx = var_db->registerVariableAndContext(u_var, ctx, IntVector<NDIM>(1));
+        const int u_fused_idx = var_db->registerClonedPatchDataIndex(u_var, u_ref_idx);
+        const int a_u_ref_idx = var_db->registerVariableAndContext(a_u_var, ctx, IntVector<NDIM>(0));
+        const int a_u_fused_idx = var_db->registerClonedPatchDataIndex(a_u_var, a_u_ref_idx);
+        const int p_idx = var_db->registerVariableAndContext(p_var, ctx, IntVector<NDIM>(1));
+        const int a_p_ref_idx = var_db->registerVariableAndContext(a_p_var, ctx, IntVector<NDIM>(0));
+        const int a_p_fused_idx = var_db->registerClonedPatchDataIndex(a_p_var, a_p_ref_idx);
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+
+        // Set the simulation time to be zero.
+        const double data_time = 0.0;
+
+        // Allocate data on each level of the patch hierarchy.
+        const std::vector<int> patch_indices = {
+            u_ref_idx, u_fused_idx, a_u_ref_idx, a_u_fused_idx, p_idx, a_p_ref_idx, a_p_fused_idx
+        };
+        for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            for (const int idx : patch_indices) level->allocatePatchData(idx, data_time);
+        }
+
+        // Set up the input data. The velocity is set on all levels, so the
+        // values on coarse faces along coarse-fine interfaces are not averages
+        // of the overlying fine values until they are synchronized.
+        muParserCartGridFunction u_fcn("u", app_initializer->getComponentDatabase("u"), grid_geometry);
+        muParserCartGridFunction p_fcn("p", app_initializer->getComponentDatabase("p"), grid_geometry);
+        u_fcn.setDataOnPatchHierarchy(u_ref_idx, u_var, patch_hierarchy, data_time);
+        u_fcn.setDataOnPatchHierarchy(u_fused_idx, u_var, patch_hierarchy, data_time);
+        p_fcn.setDataOnPatchHierarchy(p_idx, p_var, patch_hierarchy, data_time);
+
+        // Fill ghost cells.
+        typedef HierarchyGhostCellInterpolation::InterpolationTransactionComponent InterpolationTransactionComponent;
+        std::vector<InterpolationTransactionComponent> transactions;
+        for (const int u_idx : { u_ref_idx, u_fused_idx })
+        {
+            transactions.push_back(InterpolationTransactionComponent(
+                u_idx, "CONSERVATIVE_LINEAR_REFINE", false, "CONSERVATIVE_COARSEN", "LINEAR", false));
+        }
+        transactions.push_back(InterpolationTransactionComponent(
+            p_idx, "LINEAR_REFINE", false, "CONSERVATIVE_COARSEN", "LINEAR", false));
+        Pointer<HierarchyGhostCellInterpolation> ghost_fill_op = new HierarchyGhostCellInterpolation();
+        ghost_fill_op->initializeOperatorState(transactions, patch_hierarchy);
+        ghost_fill_op->fillData(data_time);
+
+        PoissonSpecifications poisson_spec("poisson_spec");
+        poisson_spec.setCConstant(input_db->getDouble("C"));
+        poisson_spec.setDConstant(input_db->getDouble("D"));
+
+        // Apply the operator one piece at a time, in the same way as
+        // StaggeredStokesOperator::apply() did before the fused operator was
+        // introduced...
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        Pointer<HierarchyGhostCellInterpolation> no_fill;
+        hier_math_ops.grad(a_u_ref_idx, a_u_var, false, 1.0, p_idx, p_var, no_fill, data_time);
+        hier_math_ops.laplace(
+            a_u_ref_idx, a_u_var, poisson_spec, u_ref_idx, u_var, no_fill, data_time, 1.0, a_u_ref_idx, a_u_var);
+        hier_math_ops.div(a_p_ref_idx, a_p_var, -1.0, u_ref_idx, u_var, no_fill, data_time, true);
+
+        // ...and all at once.
+        hier_math_ops.stokes(a_u_fused_idx,
+                             a_u_var,
+                             true,
+                             a_p_fused_idx,
+                             a_p_var,
+                             poisson_spec,
+                             u_fused_idx,
+                             u_var,
+                             p_idx,
+                             p_var,
+                             no_fill,
+                             data_time,
+                             true);
+
+        // Compare the results. The floating point operations are not performed
+        // in the same order, so the results only agree up to round-off.
+        const int dx_side_idx = hier_math_ops.getSideWeightPatchDescriptorIndex();
+        const int dx_cell_idx = hier_math_ops.getCellWeightPatchDescriptorIndex();
+        Pointer<HierarchyDataOpsReal<NDIM, double> > hier_sc_data_ops =
+            HierarchyDataOpsManager<NDIM>::getManager()->getOperationsDouble(a_u_var, patch_hierarchy, true);
+        Pointer<HierarchyDataOpsReal<NDIM, double> > hier_cc_data_ops =
+            HierarchyDataOpsManager<NDIM>::getManager()->getOperationsDouble(a_p_var, patch_hierarchy, true);
+        const double a_u_norm = hier_sc_data_ops->maxNorm(a_u_ref_idx, dx_side_idx);
+        const double a_p_norm = hier_cc_data_ops->maxNorm(a_p_ref_idx, dx_cell_idx);
+        hier_sc_data_ops->subtract(a_u_fused_idx, a_u_fused_idx, a_u_ref_idx);
+        hier_cc_data_ops->subtract(a_p_fused_idx, a_p_fused_idx, a_p_ref_idx);
+        const double a_u_diff = hier_sc_data_ops->maxNorm(a_u_fused_idx, dx_side_idx);
+        const double a_p_diff = hier_cc_data_ops->maxNorm(a_p_fused_idx, dx_cell_idx);
+
+        if (SAMRAI_MPI::getRank() == 0)
+        {
+            std::ofstream out("output");
+            out << "number of levels: " << patch_hierarchy->getNumberOfLevels() << "\n";
+            out << "velocity: " << (a_u_norm > 0.0 ? "nonzero" : "zero") << " result, "
+                << (a_u_diff <= 1.0e-12 * a_u_norm ? "fused and unfused operators agree" :
+                                                     "fused and unfused operators differ")
+                << "\n";
+            out << "pressure: " << (a_p_norm > 0.0 ? "nonzero" : "zero") << " result, "
+                << (a_p_diff <= 1.0e-12 * a_p_norm ? "fused and unfused operators agree" :
+                                                     "fused and unfused operators differ")
+                << "\n";
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
@@ -0,0 +1,278 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+#include <petscvec.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CellData.h>
+#include <GriddingAlgorithm.h>
+#include <HierarchyDataOpsManager.h>
+#include <LoadBalancer.h>
+#include <NodeData.h>
+#include <NodeVariable.h>
+#include <SAMRAIVectorReal.h>
+#include <SideData.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/PETScSAMRAIVectorReal.h>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// This test verifies that the multi-vector operations of PETScSAMRAIVectorReal
+// (VecMDot, VecMTDot, and VecMAXPY), which process several vectors in a single
+// pass over the patch data, give the same results as the corresponding
+// sequence of SAMRAIVectorReal operations on each vector. The vectors have
+// cell-, side-, and node-centered components with different depths and
+// nonzero ghost cell widths, and each component has a control volume, so that
+// the fused implementations are used. The number of vectors is varied so that
+// the vectors are processed in one or in several blocks.
+
+namespace
+{
+void
+update_max_difference(double& max_diff, const ArrayData<NDIM, double>& data_0, const ArrayData<NDIM, double>& data_1)
+{
+    const int size = data_0.getBox().size();
+    for (int d = 0; d < data_0.getDepth(); ++d)
+    {
+        const double* const values_0 = data_0.getPointer(d);
+        const double* const values_1 = data_1.getPointer(d);
+        for (int k = 0; k < size; ++k) max_diff = std::max(max_diff, std::abs(values_0[k] - values_1[k]));
+    }
+    return;
+} // update_max_difference
+
+// Returns the largest difference between the values of two vectors, including
+// their ghost values.
+double
+max_difference(const SAMRAIVectorReal<NDIM, double>& u, const SAMRAIVectorReal<NDIM, double>& v)
+{
+    double max_diff = 0.0;
+    Pointer<PatchHierarchy<NDIM> > hierarchy = u.getPatchHierarchy();
+    for (int comp = 0; comp < u.getNumberOfComponents(); ++comp)
+    {
+        for (int ln = u.getCoarsestLevelNumber(); ln <= u.getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<PatchData<NDIM> > u_data = patch->getPatchData(u.getComponentDescriptorIndex(comp));
+                Pointer<PatchData<NDIM> > v_data = patch->getPatchData(v.getComponentDescriptorIndex(comp));
+                Pointer<CellData<NDIM, double> > u_cc_data = u_data, v_cc_data = v_data;
+                Pointer<NodeData<NDIM, double> > u_nc_data = u_data, v_nc_data = v_data;
+                Pointer<SideData<NDIM, double> > u_sc_data = u_data, v_sc_data = v_data;
+                if (u_cc_data) update_max_difference(max_diff, u_cc_data->getArrayData(), v_cc_data->getArrayData());
+                if (u_nc_data) update_max_difference(max_diff, u_nc_data->getArrayData(), v_nc_data->getArrayData());
+                if (u_sc_data)
+                {
+                    for (unsigned int axis = 0; axis < NDIM; ++axis)
+                    {
+                        update_max_difference(
+                            max_diff, u_sc_data->getArrayData(axis), v_sc_data->getArrayData(axis));
+                    }
+                }
+            }
+        }
+    }
+    return SAMRAI_MPI::maxReduction(max_diff);
+} // max_difference
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        // prevent a warning about timer initializations
+        TimerManager::createManager(nullptr);
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "vector_ops.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+
+        Pointer<CellVariable<NDIM, double> > c_var = new CellVariable<NDIM, double>("c");
+        Pointer<CellVariable<NDIM, double> > c_vec_var = new CellVariable<NDIM, double>("c_vec", NDIM + 1);
+        Pointer<SideVariable<NDIM, double> > s_var = new SideVariable<NDIM, double>("s");
+        Pointer<NodeVariable<NDIM, double> > n_var = new NodeVariable<NDIM, double>("n", 2);
+        Pointer<NodeVariable<NDIM, double> > n_cv_var = new NodeVariable<NDIM, double>("n_cv");
+
+        const int c_idx = var_db->registerVariableAndContext(c_var, ctx, IntVector<NDIM>(1));
+        const int c_vec_idx = var_db->registerVariableAndContext(c_vec_var, ctx, IntVector<NDIM>(2));
+        const int s_idx = var_db->registerVariableAndContext(s_var, ctx, IntVector<NDIM>(1));
+        const int n_idx = var_db->registerVariableAndContext(n_var, ctx, IntVector<NDIM>(2));
+        const int n_cv_idx = var_db->registerVariableAndContext(n_cv_var, ctx, IntVector<NDIM>(0));
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+
+        // Allocate data on each level of the patch hierarchy.
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            for (const int idx : { c_idx, c_vec_idx, s_idx, n_idx, n_cv_idx }) level->allocatePatchData(idx, 0.0);
+        }
+
+        // The cell and side components use the standard control volumes; the
+        // node control volumes only need to be positive. The vector-valued
+        // cell component shares a single control volume between its depths.
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        const int c_cv_idx = hier_math_ops.getCellWeightPatchDescriptorIndex();
+        const int s_cv_idx = hier_math_ops.getSideWeightPatchDescriptorIndex();
+        Pointer<HierarchyDataOpsReal<NDIM, double> > hier_nc_data_ops =
+            HierarchyDataOpsManager<NDIM>::getManager()->getOperationsDouble(n_cv_var, patch_hierarchy, true);
+        hier_nc_data_ops->setToScalar(n_cv_idx, 0.25);
+
+        Pointer<SAMRAIVectorReal<NDIM, double> > x_vec =
+            new SAMRAIVectorReal<NDIM, double>("x", patch_hierarchy, 0, finest_ln);
+        x_vec->addComponent(c_var, c_idx, c_cv_idx);
+        x_vec->addComponent(c_vec_var, c_vec_idx, c_cv_idx);
+        x_vec->addComponent(s_var, s_idx, s_cv_idx);
+        x_vec->addComponent(n_var, n_idx, n_cv_idx);
+        x_vec->setToScalar(-1.0, /*interior_only*/ false);
+        x_vec->setRandomValues(1.0, 0.0);
+        Vec x = PETScSAMRAIVectorReal::createPETScVector(x_vec);
+
+        std::ofstream out;
+        if (SAMRAI_MPI::getRank() == 0) out.open("output");
+        const tbox::Array<int> num_vectors = input_db->getIntegerArray("NUM_VECTORS");
+        for (int i = 0; i < num_vectors.size(); ++i)
+        {
+            const int nv = num_vectors[i];
+            // Set up the vectors. The ghost values are set to nonzero values
+            // that differ between the vectors.
+            std::vector<Pointer<SAMRAIVectorReal<NDIM, double> > > y_vecs(nv);
+            std::vector<Vec> y(nv);
+            std::vector<double> alpha(nv);
+            for (int k = 0; k < nv; ++k)
+            {
+                y_vecs[k] = x_vec->cloneVector("y_" + std::to_string(k));
+                y_vecs[k]->allocateVectorData();
+                y_vecs[k]->setToScalar(1.0 + k, /*interior_only*/ false);
+                y_vecs[k]->setRandomValues(1.0, 0.0);
+                y[k] = PETScSAMRAIVectorReal::createPETScVector(y_vecs[k]);
+                // Include the coefficients that are treated specially by the
+                // component-by-component implementation.
+                alpha[k] = (k % 3 == 0) ? 1.0 : (k % 3 == 1) ? -1.0 : 0.5 + 0.125 * k;
+            }
+
+            // Inner products.
+            std::vector<double> dots(nv), t_dots(nv), ref_dots(nv);
+            VecMDot(x, nv, y.data(), dots.data());
+            VecMTDot(x, nv, y.data(), t_dots.data());
+            double max_dot = 0.0, max_dot_diff = 0.0, max_t_dot_diff = 0.0;
+            for (int k = 0; k < nv; ++k)
+            {
+                ref_dots[k] = x_vec->dot(y_vecs[k]);
+                max_dot = std::max(max_dot, std::abs(ref_dots[k]));
+                max_dot_diff = std::max(max_dot_diff, std::abs(dots[k] - ref_dots[k]));
+                max_t_dot_diff = std::max(max_t_dot_diff, std::abs(t_dots[k] - ref_dots[k]));
+            }
+
+            // Linear combinations. Both versions update the ghost values.
+            Pointer<SAMRAIVectorReal<NDIM, double> > z_vec = x_vec->cloneVector("z");
+            Pointer<SAMRAIVectorReal<NDIM, double> > z_ref_vec = x_vec->cloneVector("z_ref");
+            z_vec->allocateVectorData();
+            z_ref_vec->allocateVectorData();
+            z_vec->copyVector(x_vec, /*interior_only*/ false);
+            z_ref_vec->copyVector(x_vec, /*interior_only*/ false);
+            Vec z = PETScSAMRAIVectorReal::createPETScVector(z_vec);
+            VecMAXPY(z, nv, alpha.data(), y.data());
+            for (int k = 0; k < nv; ++k)
+            {
+                z_ref_vec->axpy(alpha[k], y_vecs[k], z_ref_vec, /*interior_only*/ false);
+            }
+            const double max_maxpy_diff = max_difference(*z_vec, *z_ref_vec);
+
+            if (SAMRAI_MPI::getRank() == 0)
+            {
+                out << "nv = " << nv << ":\n";
+                out << "  VecMDot  " << (max_dot_diff <= 1.0e-12 * max_dot ? "agrees" : "does not agree")
+                    << " with SAMRAIVectorReal::dot()\n";
+                out << "  VecMTDot " << (max_t_dot_diff <= 1.0e-12 * max_dot ? "agrees" : "does not agree")
+                    << " with SAMRAIVectorReal::dot()\n";
+                out << "  VecMAXPY " << (max_maxpy_diff <= 1.0e-12 ? "agrees" : "does not agree")
+                    << " with SAMRAIVectorReal::axpy(), including ghost values\n";
+            }
+
+            PETScSAMRAIVectorReal::destroyPETScVector(z);
+            z_vec->freeVectorComponents();
+            z_ref_vec->freeVectorComponents();
+            for (int k = 0; k < nv; ++k)
+            {
+                PETScSAMRAIVectorReal::destroyPETScVector(y[k]);
+                y_vecs[k]->freeVectorComponents();
+            }
+        }
+        PETScSAMRAIVectorReal::destroyPETScVector(x);
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
@@ -0,0 +1,229 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <CellData.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/FastSweepingLSMethod.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/HierarchyMathOps.h>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <limits>
+
+// This test verifies that the fast iterative method and the fast sweeping
+// method implemented by FastSweepingLSMethod compute the same distance
+// function. The interface is a circle (or a sphere) that is away from the
+// boundary, the domain is divided into several patches that are distributed
+// over several processors, and the lower boundaries of the domain are treated
+// as physical walls. Since the walls are closer to the cells near the lower
+// corner of the domain than the interface is, we also check that the computed
+// distance outside the interface never exceeds the distance to the walls.
+
+namespace
+{
+struct CircularInterface
+{
+    IBTK::Vector X0;
+    double R;
+};
+
+// The exact signed distance from the interface.
+double
+interface_distance(const CircularInterface& circle, const IBTK::Vector& X)
+{
+    return (X - circle.X0).norm() - circle.R;
+} // interface_distance
+
+// Set the exact signed distance in the cells next to the interface and large
+// values (with the correct sign) elsewhere.
+void
+circular_interface_neighborhood(int D_idx,
+                                Pointer<HierarchyMathOps> hier_math_ops,
+                                double /*time*/,
+                                bool /*initial_time*/,
+                                void* ctx)
+{
+    const CircularInterface& circle = *static_cast<CircularInterface*>(ctx);
+    Pointer<PatchHierarchy<NDIM> > patch_hierarchy = hier_math_ops->getPatchHierarchy();
+    for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const patch_x_lower = pgeom->getXLower();
+            const double* const patch_dx = pgeom->getDx();
+            Pointer<CellData<NDIM, double> > D_data = patch->getPatchData(D_idx);
+            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+            {
+                const CellIndex<NDIM> i(b());
+                IBTK::Vector X;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    X[d] = patch_x_lower[d] + patch_dx[d] * (static_cast<double>(i(d) - patch_box.lower(d)) + 0.5);
+                }
+                const double distance = interface_distance(circle, X);
+                if (std::abs(distance) < 1.5 * patch_dx[0])
+                {
+                    (*D_data)(i) = distance;
+                }
+                else
+                {
+                    (*D_data)(i) = distance > 0.0 ? 1.0e8 : -1.0e8;
+                }
+            }
+        }
+    }
+    return;
+} // circular_interface_neighborhood
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        // prevent a warning about timer initializations
+        TimerManager::createManager(nullptr);
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "level_set.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create the distance variable. The two methods store their results
+        // in different patch data indices.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<CellVariable<NDIM, double> > D_var = new CellVariable<NDIM, double>("D");
+        const int D_sweep_idx = var_db->registerVariableAndContext(D_var, var_db->getContext("sweep"));
+        const int D_fim_idx = var_db->registerVariableAndContext(D_var, var_db->getContext("fim"));
+
+        // Initialize the patch hierarchy, which consists of a single level.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+        level->allocatePatchData(D_sweep_idx, 0.0);
+        level->allocatePatchData(D_fim_idx, 0.0);
+        Pointer<HierarchyMathOps> hier_math_ops = new HierarchyMathOps("HierarchyMathOps", patch_hierarchy);
+
+        // Compute the distance function with both methods.
+        CircularInterface circle;
+        input_db->getDoubleArray("X0", circle.X0.data(), NDIM);
+        circle.R = input_db->getDouble("R");
+        Pointer<FastSweepingLSMethod> sweep_ops = new FastSweepingLSMethod(
+            "FastSweepingLSMethod", app_initializer->getComponentDatabase("FastSweepingLSMethod"), false);
+        Pointer<FastSweepingLSMethod> fim_ops = new FastSweepingLSMethod(
+            "FastIterativeLSMethod", app_initializer->getComponentDatabase("FastIterativeLSMethod"), false);
+        sweep_ops->registerInterfaceNeighborhoodLocatingFcn(&circular_interface_neighborhood, &circle);
+        fim_ops->registerInterfaceNeighborhoodLocatingFcn(&circular_interface_neighborhood, &circle);
+        sweep_ops->initializeLSData(D_sweep_idx, hier_math_ops, 0, 0.0, /*initial_time*/ true);
+        fim_ops->initializeLSData(D_fim_idx, hier_math_ops, 0, 0.0, /*initial_time*/ true);
+
+        // Compare the results. The walls are the lower boundaries of the
+        // domain.
+        const double* const x_lower = grid_geometry->getXLower();
+        double max_diff = 0.0;
+        int num_cells_farther_than_walls = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const patch_x_lower = pgeom->getXLower();
+            const double* const patch_dx = pgeom->getDx();
+            Pointer<CellData<NDIM, double> > D_sweep_data = patch->getPatchData(D_sweep_idx);
+            Pointer<CellData<NDIM, double> > D_fim_data = patch->getPatchData(D_fim_idx);
+            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+            {
+                const CellIndex<NDIM> i(b());
+                const double D_sweep = (*D_sweep_data)(i);
+                const double D_fim = (*D_fim_data)(i);
+                max_diff = std::max(max_diff, std::abs(D_sweep - D_fim));
+
+                double wall_distance = std::numeric_limits<double>::max();
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    const double X =
+                        patch_x_lower[d] + patch_dx[d] * (static_cast<double>(i(d) - patch_box.lower(d)) + 0.5);
+                    wall_distance = std::min(wall_distance, X - x_lower[d]);
+                }
+                for (const double D : { D_sweep, D_fim })
+                {
+                    if (D > 0.0 && D > wall_distance + 1.0e-8) ++num_cells_farther_than_walls;
+                }
+            }
+        }
+        max_diff = SAMRAI_MPI::maxReduction(max_diff);
+        num_cells_farther_than_walls = SAMRAI_MPI::sumReduction(num_cells_farther_than_walls);
+
+        if (SAMRAI_MPI::getRank() == 0)
+        {
+            std::ofstream out("output");
+            out << "number of patches: " << (level->getNumberOfPatches() > 1 ? "more than one" : "one") << "\n";
+            out << "fast iterative method "
+                << (max_diff <= input_db->getDouble("TOLERANCE") ? "agrees" : "does not agree")
+                << " with fast sweeping\n";
+            out << "distances outside the interface "
+                << (num_cells_farther_than_walls == 0 ? "are" : "are not") << " bounded by the wall distances\n";
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
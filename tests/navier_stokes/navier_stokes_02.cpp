@@ -0,0 +1,169 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscksp.h>
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/PETScKrylovLinearSolver.h>
+#include <ibtk/muParserCartGridFunction.h>
+#include <ibtk/muParserRobinBcCoefs.h>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+// This test verifies that INSStaggeredHierarchyIntegrator updates its solvers
+// in place, instead of reinitializing them, when the time step size changes.
+// The time step size alternates between two values, and the number of times
+// that the solvers are initialized is counted from the log written by the
+// integrator.
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        // prevent a warning about timer initializations
+        TimerManager::createManager(nullptr);
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "INS.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const std::string log_file_name = app_initializer->getComponentDatabase("Main")->getString("log_file_name");
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<INSStaggeredHierarchyIntegrator> time_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create initial condition specification objects.
+        Pointer<CartGridFunction> u_init = new muParserCartGridFunction(
+            "u_init", app_initializer->getComponentDatabase("VelocityInitialConditions"), grid_geometry);
+        time_integrator->registerVelocityInitialConditions(u_init);
+        Pointer<CartGridFunction> p_init = new muParserCartGridFunction(
+            "p_init", app_initializer->getComponentDatabase("PressureInitialConditions"), grid_geometry);
+        time_integrator->registerPressureInitialConditions(p_init);
+
+        // Create boundary condition specification objects.
+        vector<RobinBcCoefStrategy<NDIM>*> u_bc_coefs(NDIM);
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const std::string bc_coefs_name = "u_bc_coefs_" + std::to_string(d);
+            const std::string bc_coefs_db_name = "VelocityBcCoefs_" + std::to_string(d);
+            u_bc_coefs[d] = new muParserRobinBcCoefs(
+                bc_coefs_name, app_initializer->getComponentDatabase(bc_coefs_db_name), grid_geometry);
+        }
+        time_integrator->registerPhysicalBoundaryConditions(u_bc_coefs);
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Deallocate initialization objects.
+        app_initializer.setNull();
+
+        // Alternate between two time step sizes, so that the time step size
+        // changes at every step.
+        const int num_steps = input_db->getInteger("NUM_STEPS");
+        const double dt_0 = input_db->getDouble("DT_0");
+        const double dt_1 = input_db->getDouble("DT_1");
+        std::ofstream out;
+        if (SAMRAI_MPI::getRank() == 0) out.open("output");
+        for (int step = 0; step < num_steps; ++step)
+        {
+            const double dt = (step % 2 == 0) ? dt_0 : dt_1;
+            time_integrator->advanceHierarchy(dt);
+
+            // Check that the solver that was updated in place still converges.
+            KSPConvergedReason reason = KSP_DIVERGED_ITS;
+            Pointer<StaggeredStokesSolver> stokes_solver = time_integrator->getStokesSolver();
+            auto p_stokes_solver = dynamic_cast<PETScKrylovLinearSolver*>(stokes_solver.getPointer());
+            if (p_stokes_solver) KSPGetConvergedReason(p_stokes_solver->getPETScKSP(), &reason);
+            if (SAMRAI_MPI::getRank() == 0)
+            {
+                out << "step " << step << ": Stokes solver " << (reason > 0 ? "converged" : "did not converge")
+                    << "\n";
+            }
+        }
+
+        // Count the number of times that the solvers were initialized.
+        plog << std::flush;
+        if (SAMRAI_MPI::getRank() == 0)
+        {
+            const std::vector<std::string> solver_names = { "velocity subdomain solver",
+                                                            "pressure subdomain solver",
+                                                            "incompressible Stokes solver" };
+            std::vector<int> num_inits(solver_names.size(), 0);
+            std::ifstream log(log_file_name);
+            std::string line;
+            while (std::getline(log, line))
+            {
+                for (unsigned int k = 0; k < solver_names.size(); ++k)
+                {
+                    if (line.find("initializing " + solver_names[k]) != std::string::npos) ++num_inits[k];
+                }
+            }
+            for (unsigned int k = 0; k < solver_names.size(); ++k)
+            {
+                out << solver_names[k] << " initializations: " << num_inits[k] << "\n";
+            }
+        }
+
+        for (unsigned int d = 0; d < NDIM; ++d) delete u_bc_coefs[d];
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
@@ -0,0 +1,113 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#include <ibamr/WaveUtilities.h>
+
+#include <tbox/SAMRAIManager.h>
+#include <tbox/SAMRAI_MPI.h>
+
+#include <petscsys.h>
+
+#include <SAMRAI_config.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <vector>
+
+// This test verifies that IrregularWaveComponents computes the same surface
+// elevations and velocities with and without caching. The times are requested
+// out of order and the number of horizontal and vertical positions exceeds the
+// cache sizes, so that entries are both reused and evicted.
+
+using namespace SAMRAI;
+
+int
+main(int argc, char** argv)
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    tbox::SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    tbox::SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    tbox::SAMRAIManager::startup();
+
+    {
+        const int num_waves = 25;
+        const double depth = 0.6;
+        std::vector<double> amplitude(num_waves), wave_number(num_waves), omega(num_waves), phase(num_waves);
+        for (int i = 0; i < num_waves; ++i)
+        {
+            omega[i] = 2.0 + 0.25 * i;
+            wave_number[i] = omega[i] * omega[i] / 9.81 * (1.0 + 0.1 * std::sin(3.1 * i));
+            amplitude[i] = 0.01 * (1.0 + 0.5 * std::cos(1.3 * i));
+            phase[i] = std::fmod(2.7 * i * i + 0.4, 2.0 * M_PI);
+        }
+
+        IBAMR::IrregularWaveComponents uncached, default_cached, small_cached;
+        uncached.setCacheSizes(0, 0);
+        small_cached.setCacheSizes(2, 16);
+        for (IBAMR::IrregularWaveComponents* components : { &uncached, &default_cached, &small_cached })
+        {
+            components->setComponentWaves(depth, amplitude, wave_number, omega, phase);
+        }
+
+        const std::vector<double> times = { 0.0, 0.1, 0.05, 0.1, 0.2, 0.0, 0.05, 0.3, 0.1, 0.2, 0.4, 0.0 };
+        const int num_x = 40, num_z = 40;
+        int num_evaluations = 0;
+        double max_value = 0.0;
+        double max_diff_default = 0.0, max_diff_small = 0.0;
+        for (const double time : times)
+        {
+            for (int i = 0; i < num_x; ++i)
+            {
+                const double x = 3.0 * (i + 0.5) / num_x;
+                const double eta = uncached.getSurfaceElevation(x, time);
+                max_value = std::max(max_value, std::abs(eta));
+                max_diff_default =
+                    std::max(max_diff_default, std::abs(default_cached.getSurfaceElevation(x, time) - eta));
+                max_diff_small = std::max(max_diff_small, std::abs(small_cached.getSurfaceElevation(x, time) - eta));
+                ++num_evaluations;
+
+                // Visit the vertical positions in a different order for each
+                // horizontal position.
+                for (int j = 0; j < num_z; ++j)
+                {
+                    const double z_plus_d = depth * ((j * (i + 1)) % num_z + 0.5) / num_z;
+                    for (int comp_idx = 0; comp_idx < 2; ++comp_idx)
+                    {
+                        const double u = uncached.getVelocity(x, z_plus_d, time, comp_idx);
+                        max_value = std::max(max_value, std::abs(u));
+                        max_diff_default = std::max(
+                            max_diff_default, std::abs(default_cached.getVelocity(x, z_plus_d, time, comp_idx) - u));
+                        max_diff_small = std::max(max_diff_small,
+                                                  std::abs(small_cached.getVelocity(x, z_plus_d, time, comp_idx) - u));
+                        ++num_evaluations;
+                    }
+                }
+            }
+        }
+
+        if (tbox::SAMRAI_MPI::getRank() == 0)
+        {
+            std::ofstream out("output");
+            out << "number of evaluations: " << num_evaluations << "\n";
+            out << "default cache sizes: " << (max_value > 0.0 && max_diff_default == 0.0 ? "agree" : "do not agree")
+                << " with uncached evaluation\n";
+            out << "small cache sizes: " << (max_value > 0.0 && max_diff_small == 0.0 ? "agree" : "do not agree")
+                << " with uncached evaluation\n";
+        }
+    }
+
+    tbox::SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main